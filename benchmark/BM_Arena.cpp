@@ -0,0 +1,353 @@
+/**
+ * @file BM_Arena.cpp
+ * @brief Benchmark random-probe lookups on 4 KiB versus huge-page backed tables
+ * @details Looks up random keys in linear-probing tables from 16 MiB to 4 GiB whose buckets
+ *          come from the heap, from an Arena with 4 KiB pages, with transparent huge pages
+ *          or with explicit huge pages. Beyond the reach of the data TLB every probe of a
+ *          4 KiB-backed table also pays a page walk; 2 MiB pages cover 512 times as much
+ *          memory per TLB entry. Also compares a wide CountMinSketch on the heap and in a
+ *          huge-page arena. Sizes that exceed the available physical memory are skipped.
+ *
+ *          The `huge_page_fraction` counter reports how much of the process's anonymous
+ *          memory the kernel actually backed with huge pages (Linux, from smaps_rollup).
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#if defined( __linux__ )
+#	include <unistd.h>
+#endif
+
+#include <nfx/core/Arena.h>
+#include <nfx/core/CountMinSketch.h>
+#include <nfx/core/Hashing.h>
+
+#include "PerfCounters.h"
+
+namespace nfx::core::benchmark
+{
+	//=====================================================================
+	// Arena benchmark suite
+	//=====================================================================
+
+	/** @brief Keys looked up per iteration. */
+	static constexpr size_t ARENA_BATCH_KEYS{ 4096 };
+
+	/** @brief Keys stored in the table; iterations cycle through all of them. */
+	static constexpr size_t ARENA_KEY_COUNT{ size_t{ 1 } << 22 };
+
+	/** @brief Table seed passed to seedMix(). */
+	static constexpr uint32_t ARENA_SEED{ 0xA7E4A };
+
+	/** @brief Where the table's buckets live (benchmark argument). */
+	enum class Backing : int64_t
+	{
+		Heap = 0,		 ///< operator new (default malloc and THP policy)
+		SmallPages,		 ///< Arena, 4 KiB pages
+		TransparentHuge, ///< Arena, MADV_HUGEPAGE
+		ExplicitHuge	 ///< Arena, MAP_HUGETLB (falls back to transparent when the pool is empty)
+	};
+
+	/** @brief One 16-byte bucket; key 0 marks an empty slot. */
+	struct Bucket
+	{
+		uint64_t key;
+		uint64_t value;
+	};
+
+	//=====================================================================
+	// Helpers
+	//=====================================================================
+
+	/** @brief Leaves a quarter of the available physical memory free (Linux; always true elsewhere). */
+	static bool fitsInMemory( size_t bytes ) noexcept
+	{
+#if defined( __linux__ )
+		const long pages = ::sysconf( _SC_AVPHYS_PAGES );
+		const long pageSize = ::sysconf( _SC_PAGESIZE );
+		if ( pages > 0 && pageSize > 0 )
+		{
+			return bytes <= static_cast<size_t>( pages ) / 4 * 3 * static_cast<size_t>( pageSize );
+		}
+#endif
+		return true;
+	}
+
+	/** @brief Anonymous memory of this process backed by huge pages, in bytes (0 if unknown). */
+	static size_t anonymousHugePageBytes()
+	{
+		std::ifstream rollup{ "/proc/self/smaps_rollup" };
+		std::string line;
+		while ( std::getline( rollup, line ) )
+		{
+			if ( line.starts_with( "AnonHugePages:" ) )
+			{
+				return std::stoull( line.substr( 14 ) ) * 1024;
+			}
+		}
+
+		return 0;
+	}
+
+	/** @brief Arena options for a backing, or nullopt for the heap. */
+	static std::optional<nfx::core::memory::ArenaOptions> arenaOptions( Backing backing )
+	{
+		switch ( backing )
+		{
+			case Backing::SmallPages:
+				return nfx::core::memory::ArenaOptions{ nfx::core::memory::PageSize::Small };
+			case Backing::TransparentHuge:
+				return nfx::core::memory::ArenaOptions{ nfx::core::memory::PageSize::TransparentHuge };
+			case Backing::ExplicitHuge:
+				return nfx::core::memory::ArenaOptions{ nfx::core::memory::PageSize::ExplicitHuge };
+			default:
+				return std::nullopt;
+		}
+	}
+
+	//=====================================================================
+	// Test data generation
+	//=====================================================================
+
+	/** @brief Linear-probing table of `bytes / sizeof( Bucket )` slots on a chosen backing. */
+	class ProbeTable final
+	{
+	public:
+		/**
+		 * @brief Gets the shared table of the requested size and backing, rebuilding it if either changed.
+		 * @return The table, or nullptr if it cannot be allocated
+		 */
+		static const ProbeTable* get( size_t bytes, Backing backing )
+		{
+			static std::unique_ptr<ProbeTable> s_table;
+			if ( s_table && s_table->m_size * sizeof( Bucket ) == bytes && s_table->m_backing == backing )
+			{
+				return s_table.get();
+			}
+
+			s_table.reset(); // Release the previous table before allocating the next
+			if ( !fitsInMemory( bytes ) )
+			{
+				return nullptr;
+			}
+
+			s_table.reset( new ProbeTable{ bytes, backing } );
+			if ( s_table->m_buckets == nullptr )
+			{
+				s_table.reset();
+			}
+
+			return s_table.get();
+		}
+
+		/** @brief Next ARENA_BATCH_KEYS keys, cycling through the whole key set. */
+		std::span<const uint64_t> window( size_t& offset ) const noexcept
+		{
+			const std::span<const uint64_t> keys{ m_keys.data() + offset, ARENA_BATCH_KEYS };
+			offset = ( offset + ARENA_BATCH_KEYS ) % m_keys.size();
+			return keys;
+		}
+
+		uint64_t find( uint64_t key ) const noexcept
+		{
+			const uint32_t hash = static_cast<uint32_t>( nfx::core::hashing::hashInteger( key ) );
+			for ( size_t slot = nfx::core::hashing::seedMix( ARENA_SEED, hash, m_size );; slot = ( slot + 1 ) & ( m_size - 1 ) )
+			{
+				const Bucket& bucket = m_buckets[slot];
+				if ( bucket.key == key || bucket.key == 0 )
+				{
+					return bucket.value;
+				}
+			}
+		}
+
+		Backing backing() const noexcept
+		{
+			return m_backing;
+		}
+
+		size_t bytes() const noexcept
+		{
+			return m_size * sizeof( Bucket );
+		}
+
+	private:
+		ProbeTable( size_t bytes, Backing backing )
+			: m_size{ bytes / sizeof( Bucket ) },
+			  m_backing{ backing }
+		{
+			if ( const auto options = arenaOptions( backing ) )
+			{
+				m_arena.emplace( *options );
+				m_buckets = m_arena->allocate<Bucket>( m_size );
+			}
+			else
+			{
+				m_heap.reset( new ( std::nothrow ) Bucket[m_size] );
+				m_buckets = m_heap.get();
+			}
+			if ( m_buckets == nullptr )
+			{
+				return;
+			}
+
+			// Zero every bucket so all pages are faulted in before timing
+			std::fill_n( m_buckets, m_size, Bucket{ 0, 0 } );
+
+			const size_t count = std::min( ARENA_KEY_COUNT, m_size / 2 );
+			m_keys.reserve( count );
+			for ( uint64_t i = 1; m_keys.size() < count; ++i )
+			{
+				const uint64_t key = i * 0x9E3779B97F4A7C15ull;
+				const uint32_t hash = static_cast<uint32_t>( nfx::core::hashing::hashInteger( key ) );
+				size_t slot = nfx::core::hashing::seedMix( ARENA_SEED, hash, m_size );
+				while ( m_buckets[slot].key != 0 )
+				{
+					slot = ( slot + 1 ) & ( m_size - 1 );
+				}
+				m_buckets[slot] = Bucket{ key, i };
+				m_keys.push_back( key );
+			}
+		}
+
+		size_t m_size;
+		Backing m_backing;
+		std::optional<nfx::core::memory::Arena> m_arena;
+		std::unique_ptr<Bucket[]> m_heap;
+		Bucket* m_buckets{ nullptr };
+		std::vector<uint64_t> m_keys;
+	};
+
+	/** @brief Publishes the fraction of the table the kernel backed with huge pages. */
+	static void reportHugePages( ::benchmark::State& state, size_t bytes )
+	{
+		state.counters["huge_page_fraction"] = std::min( 1.0, static_cast<double>( anonymousHugePageBytes() ) / static_cast<double>( bytes ) );
+	}
+
+	//=====================================================================
+	// Random-probe lookup benchmarks
+	//=====================================================================
+
+	static void BM_Arena_RandomProbe( ::benchmark::State& state )
+	{
+		const ProbeTable* table = ProbeTable::get( static_cast<size_t>( state.range( 0 ) ), static_cast<Backing>( state.range( 1 ) ) );
+		if ( table == nullptr )
+		{
+			state.SkipWithError( "table does not fit in available memory" );
+			return;
+		}
+
+		size_t offset = 0;
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			uint64_t total = 0;
+			for ( const uint64_t key : table->window( offset ) )
+			{
+				total += table->find( key );
+			}
+			::benchmark::DoNotOptimize( total );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * ARENA_BATCH_KEYS ) );
+		reportHugePages( state, table->bytes() );
+	}
+
+	//=====================================================================
+	// Sketch placement benchmarks
+	//=====================================================================
+
+	template <typename Sketch>
+	static void runSketchAdds( ::benchmark::State& state, Sketch& sketch, size_t bytes )
+	{
+		std::vector<uint64_t> hashes( ARENA_BATCH_KEYS );
+		uint64_t next = 0;
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			for ( auto& hash : hashes )
+			{
+				hash = nfx::core::hashing::hashInteger( ++next );
+			}
+			sketch.add( hashes );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * hashes.size() ) );
+		reportHugePages( state, bytes );
+	}
+
+	static void BM_Arena_CountMinSketch( ::benchmark::State& state )
+	{
+		const size_t width = static_cast<size_t>( state.range( 0 ) );
+		const size_t bytes = nfx::core::sketch::CountMinSketch<>::depth() * width * sizeof( uint32_t );
+		if ( !fitsInMemory( bytes ) )
+		{
+			state.SkipWithError( "sketch does not fit in available memory" );
+			return;
+		}
+
+		if ( const auto options = arenaOptions( static_cast<Backing>( state.range( 1 ) ) ) )
+		{
+			nfx::core::memory::Arena arena{ *options };
+			nfx::core::sketch::CountMinSketch<4, nfx::core::memory::ArenaAllocator<uint32_t>> sketch{ width, arena };
+			runSketchAdds( state, sketch, bytes );
+		}
+		else
+		{
+			nfx::core::sketch::CountMinSketch<> sketch{ width };
+			runSketchAdds( state, sketch, bytes );
+		}
+	}
+
+	//=====================================================================
+	// Arguments
+	//=====================================================================
+
+	/** @brief 16 MiB .. 4 GiB on every backing. */
+	static void tableArguments( ::benchmark::internal::Benchmark* benchmark )
+	{
+		benchmark->ArgNames( { "bytes", "backing" } );
+		for ( int64_t bytes = int64_t{ 16 } << 20; bytes <= int64_t{ 1 } << 32; bytes *= 4 )
+		{
+			for ( int64_t backing = 0; backing <= static_cast<int64_t>( Backing::ExplicitHuge ); ++backing )
+			{
+				benchmark->Args( { bytes, backing } );
+			}
+		}
+	}
+
+	/** @brief 2^20 .. 2^24 counters per row (16 .. 256 MiB) on the heap and on transparent huge pages. */
+	static void sketchArguments( ::benchmark::internal::Benchmark* benchmark )
+	{
+		benchmark->ArgNames( { "width", "backing" } );
+		for ( int64_t width = int64_t{ 1 } << 20; width <= int64_t{ 1 } << 24; width *= 4 )
+		{
+			benchmark->Args( { width, static_cast<int64_t>( Backing::Heap ) } );
+			benchmark->Args( { width, static_cast<int64_t>( Backing::SmallPages ) } );
+			benchmark->Args( { width, static_cast<int64_t>( Backing::TransparentHuge ) } );
+		}
+	}
+} // namespace nfx::core::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+BENCHMARK( nfx::core::benchmark::BM_Arena_RandomProbe )
+	->Apply( nfx::core::benchmark::tableArguments );
+BENCHMARK( nfx::core::benchmark::BM_Arena_CountMinSketch )
+	->Apply( nfx::core::benchmark::sketchArguments );
+
+BENCHMARK_MAIN();
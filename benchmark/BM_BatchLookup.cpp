@@ -0,0 +1,324 @@
+/**
+ * @file BM_BatchLookup.cpp
+ * @brief Benchmark batched and coroutine-interleaved lookups against one-at-a-time probing
+ * @details Looks up random keys in linear-probing tables from 1 MiB to 4 GiB. Tables that
+ *          fit in cache show each pipeline's overhead; tables beyond the last-level cache show
+ *          the memory-level-parallelism gain of prefetching a whole group of buckets before
+ *          the first compare (lookupBatch) or of switching to another in-flight lookup after
+ *          each prefetch (interleaveLookups). Sizes that cannot be allocated, or that exceed the available
+ *          physical memory, are skipped.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <span>
+#include <vector>
+
+#if defined( __linux__ )
+#	include <unistd.h>
+#endif
+
+#include <nfx/core/BatchLookup.h>
+#include <nfx/core/Hashing.h>
+#include <nfx/core/InterleavedLookup.h>
+
+#include "PerfCounters.h"
+
+namespace nfx::core::benchmark
+{
+	//=====================================================================
+	// Batched lookup benchmark suite
+	//=====================================================================
+
+	/** @brief Keys looked up per iteration. */
+	static constexpr size_t LOOKUP_BATCH_KEYS{ 4096 };
+
+	/**
+	 * @brief Keys stored in the table (at most half its slots).
+	 * @details Iterations walk through the whole key set, so on large tables the touched
+	 *          buckets (256 MiB of cache lines) cannot stay cached between iterations.
+	 */
+	static constexpr size_t LOOKUP_KEY_COUNT{ size_t{ 1 } << 22 };
+
+	/** @brief Table seed passed to seedMix(). */
+	static constexpr uint32_t LOOKUP_SEED{ 0x5EED };
+
+	/** @brief One 16-byte bucket; key 0 marks an empty slot. */
+	struct Bucket
+	{
+		uint64_t key;
+		uint64_t value;
+	};
+
+	//=====================================================================
+	// Test data generation
+	//=====================================================================
+
+	/** @brief Linear-probing table of `bytes / sizeof( Bucket )` slots holding the lookup keys. */
+	class LookupTable final
+	{
+	public:
+		/**
+		 * @brief Gets the shared table of the requested size, rebuilding it if the size changed.
+		 * @return The table, or nullptr if it cannot be allocated
+		 */
+		static const LookupTable* get( size_t bytes )
+		{
+			static std::unique_ptr<LookupTable> s_table;
+			if ( s_table && s_table->m_size * sizeof( Bucket ) == bytes )
+			{
+				return s_table.get();
+			}
+
+			s_table.reset(); // Release the previous table before allocating the next
+			if ( !fitsInMemory( bytes ) )
+			{
+				return nullptr;
+			}
+
+			std::unique_ptr<Bucket[]> buckets{ new ( std::nothrow ) Bucket[bytes / sizeof( Bucket )]() }; // Zeroed: every page is touched
+			if ( !buckets )
+			{
+				return nullptr;
+			}
+
+			s_table.reset( new LookupTable{ std::move( buckets ), bytes / sizeof( Bucket ) } );
+			return s_table.get();
+		}
+
+		/** @brief Next LOOKUP_BATCH_KEYS keys, cycling through the whole key set. */
+		std::span<const uint64_t> window( size_t& offset ) const noexcept
+		{
+			if ( offset + LOOKUP_BATCH_KEYS > m_keys.size() )
+			{
+				offset = 0;
+			}
+			const std::span<const uint64_t> keys{ m_keys.data() + offset, LOOKUP_BATCH_KEYS };
+			offset += LOOKUP_BATCH_KEYS;
+
+			return keys;
+		}
+
+		size_t size() const noexcept
+		{
+			return m_size;
+		}
+
+		const Bucket* bucket( uint32_t slot ) const noexcept
+		{
+			return &m_buckets[slot];
+		}
+
+		uint32_t slotOf( uint64_t key ) const noexcept
+		{
+			return nfx::core::hashing::seedMix( LOOKUP_SEED, nfx::core::hashing::LookupHash{}( key ), m_size );
+		}
+
+		/** @brief Coroutine form of slotOf() + probe(): suspends once, after prefetching the bucket. */
+		nfx::core::hashing::LookupTask<uint64_t> probeAsync( uint64_t key ) const
+		{
+			const uint32_t slot = slotOf( key );
+			co_await nfx::core::hashing::prefetchAndSuspend( bucket( slot ) );
+			co_return probe( key, slot );
+		}
+
+		uint64_t probe( uint64_t key, uint32_t slot ) const noexcept
+		{
+			const uint32_t mask = static_cast<uint32_t>( m_size - 1 );
+			for ( ; m_buckets[slot].key != 0; slot = ( slot + 1 ) & mask )
+			{
+				if ( m_buckets[slot].key == key )
+				{
+					return m_buckets[slot].value;
+				}
+			}
+
+			return 0;
+		}
+
+	private:
+		LookupTable( std::unique_ptr<Bucket[]> buckets, size_t size )
+			: m_buckets{ std::move( buckets ) }, m_size{ size }
+		{
+			const uint32_t mask = static_cast<uint32_t>( m_size - 1 );
+			const size_t count = std::min( LOOKUP_KEY_COUNT, m_size / 2 );
+			m_keys.reserve( count );
+			for ( uint64_t i = 1; i <= count; ++i )
+			{
+				const uint64_t key = nfx::core::hashing::hashInteger( i ) | 1; // Never the empty marker
+				uint32_t slot = slotOf( key );
+				while ( m_buckets[slot].key != 0 )
+				{
+					slot = ( slot + 1 ) & mask;
+				}
+				m_buckets[slot] = { key, i };
+				m_keys.push_back( key );
+			}
+		}
+
+		/** @brief Leaves a quarter of the available physical memory free (Linux; always true elsewhere). */
+		static bool fitsInMemory( size_t bytes ) noexcept
+		{
+#if defined( __linux__ )
+			const long pages = ::sysconf( _SC_AVPHYS_PAGES );
+			const long pageSize = ::sysconf( _SC_PAGESIZE );
+			if ( pages > 0 && pageSize > 0 )
+			{
+				return bytes <= static_cast<size_t>( pages ) / 4 * 3 * static_cast<size_t>( pageSize );
+			}
+#endif
+			return true;
+		}
+
+		std::unique_ptr<Bucket[]> m_buckets;
+		size_t m_size;
+		std::vector<uint64_t> m_keys;
+	};
+
+	/** @brief Gets the table for `state.range( 0 )` bytes or marks the run as skipped. */
+	static const LookupTable* tableFor( ::benchmark::State& state )
+	{
+		const LookupTable* table = LookupTable::get( static_cast<size_t>( state.range( 0 ) ) );
+		if ( table == nullptr )
+		{
+			state.SkipWithError( "table does not fit in available memory" );
+		}
+
+		return table;
+	}
+
+	//=====================================================================
+	// Lookup benchmarks
+	//=====================================================================
+
+	static void BM_Lookup_OneAtATime( ::benchmark::State& state )
+	{
+		// Baseline: hash, map, load and compare each key before starting the next
+		const LookupTable* table = tableFor( state );
+		if ( table == nullptr )
+		{
+			return;
+		}
+
+		size_t offset{ 0 };
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			uint64_t total{ 0 };
+			for ( const uint64_t key : table->window( offset ) )
+			{
+				total += table->probe( key, table->slotOf( key ) );
+			}
+			::benchmark::DoNotOptimize( total );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * LOOKUP_BATCH_KEYS ) );
+	}
+
+	template <size_t BatchSize>
+	static void BM_Lookup_Batched( ::benchmark::State& state )
+	{
+		const LookupTable* table = tableFor( state );
+		if ( table == nullptr )
+		{
+			return;
+		}
+
+		std::vector<uint64_t> values( LOOKUP_BATCH_KEYS );
+		size_t offset{ 0 };
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			nfx::core::hashing::lookupBatch<BatchSize>(
+				table->window( offset ), std::span<uint64_t>{ values }, LOOKUP_SEED, table->size(),
+				[table]( uint32_t slot ) { return static_cast<const void*>( table->bucket( slot ) ); },
+				[table]( uint64_t key, uint32_t slot ) { return table->probe( key, slot ); } );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * LOOKUP_BATCH_KEYS ) );
+	}
+
+	static void BM_Lookup_Interleaved( ::benchmark::State& state )
+	{
+		const LookupTable* table = tableFor( state );
+		if ( table == nullptr )
+		{
+			return;
+		}
+
+		const size_t width = state.range( 1 ) > 0 ? static_cast<size_t>( state.range( 1 ) ) : nfx::core::hashing::constants::INTERLEAVE_WIDTH;
+		const auto lookup = [table]( uint64_t key ) { return table->probeAsync( key ); };
+		std::vector<uint64_t> values( LOOKUP_BATCH_KEYS );
+		size_t offset{ 0 };
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			nfx::core::hashing::interleaveLookups( table->window( offset ), std::span<uint64_t>{ values }, lookup, width );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * LOOKUP_BATCH_KEYS ) );
+	}
+
+	//=====================================================================
+	// Table sizes
+	//=====================================================================
+
+	/** @brief 1 MiB .. 4 GiB in steps of 4x. */
+	static void tableSizes( ::benchmark::internal::Benchmark* benchmark )
+	{
+		benchmark->ArgName( "bytes" );
+		for ( int64_t bytes = int64_t{ 1 } << 20; bytes <= int64_t{ 1 } << 32; bytes *= 4 )
+		{
+			benchmark->Arg( bytes );
+		}
+	}
+
+	/** @brief 1 MiB .. 4 GiB with the default interleaving width (0). */
+	static void interleavedTableSizes( ::benchmark::internal::Benchmark* benchmark )
+	{
+		benchmark->ArgNames( { "bytes", "width" } );
+		for ( int64_t bytes = int64_t{ 1 } << 20; bytes <= int64_t{ 1 } << 32; bytes *= 4 )
+		{
+			benchmark->Args( { bytes, 0 } );
+		}
+	}
+} // namespace nfx::core::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// One-at-a-time vs. batched, by table size
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_Lookup_OneAtATime )
+	->Apply( nfx::core::benchmark::tableSizes );
+BENCHMARK( nfx::core::benchmark::BM_Lookup_Batched<nfx::core::hashing::constants::LOOKUP_BATCH_SIZE> )
+	->Apply( nfx::core::benchmark::tableSizes );
+BENCHMARK( nfx::core::benchmark::BM_Lookup_Interleaved )
+	->Apply( nfx::core::benchmark::interleavedTableSizes );
+
+//----------------------------------------------
+// Group size and interleaving width, 256 MiB table
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_Lookup_Batched<4> )
+	->Arg( int64_t{ 1 } << 28 );
+BENCHMARK( nfx::core::benchmark::BM_Lookup_Batched<8> )
+	->Arg( int64_t{ 1 } << 28 );
+BENCHMARK( nfx::core::benchmark::BM_Lookup_Batched<32> )
+	->Arg( int64_t{ 1 } << 28 );
+BENCHMARK( nfx::core::benchmark::BM_Lookup_Interleaved )
+	->ArgNames( { "bytes", "width" } )
+	->Args( { int64_t{ 1 } << 28, 4 } )
+	->Args( { int64_t{ 1 } << 28, 16 } )
+	->Args( { int64_t{ 1 } << 28, 32 } );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,148 @@
+/**
+ * @file BM_CPU.cpp
+ * @brief Benchmark CPU feature query cost
+ * @details Compares feature queries served from the features() snapshot with the
+ *          previous function-local static pattern and with a raw CPUID instruction,
+ *          and measures cache hierarchy queries and detection
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/core/CPU.h>
+
+#include "PerfCounters.h"
+
+namespace nfx::core::benchmark
+{
+	//=====================================================================
+	// CPU feature query benchmark suite
+	//=====================================================================
+
+	/** @brief Queries per benchmark iteration, so loop overhead does not dominate. */
+	static constexpr int QUERY_BATCH{ 1024 };
+
+	/** @brief The former pattern: one thread-safe static per query. */
+	static bool functionLocalStaticQuery() noexcept
+	{
+		static const bool s_supported = nfx::core::cpu::detail::detectFeatures().sse42;
+		return s_supported;
+	}
+
+	//=====================================================================
+	// Query benchmarks
+	//=====================================================================
+
+	static void BM_Features_Snapshot( ::benchmark::State& state )
+	{
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			int supported{ 0 };
+			for ( int i = 0; i < QUERY_BATCH; ++i )
+			{
+				supported += nfx::core::cpu::features().avx2 ? 1 : 0;
+				::benchmark::DoNotOptimize( supported );
+			}
+		}
+
+		state.SetItemsProcessed( state.iterations() * QUERY_BATCH );
+	}
+
+	static void BM_Features_HasSSE42Support( ::benchmark::State& state )
+	{
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			int supported{ 0 };
+			for ( int i = 0; i < QUERY_BATCH; ++i )
+			{
+				supported += nfx::core::cpu::hasSSE42Support() ? 1 : 0;
+				::benchmark::DoNotOptimize( supported );
+			}
+		}
+
+		state.SetItemsProcessed( state.iterations() * QUERY_BATCH );
+	}
+
+	static void BM_Features_FunctionLocalStatic( ::benchmark::State& state )
+	{
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			int supported{ 0 };
+			for ( int i = 0; i < QUERY_BATCH; ++i )
+			{
+				supported += functionLocalStaticQuery() ? 1 : 0;
+				::benchmark::DoNotOptimize( supported );
+			}
+		}
+
+		state.SetItemsProcessed( state.iterations() * QUERY_BATCH );
+	}
+
+	static void BM_Features_Detect( ::benchmark::State& state )
+	{
+		// Full CPUID sweep, the cost paid once at startup
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			auto detected = nfx::core::cpu::detail::detectFeatures();
+			::benchmark::DoNotOptimize( detected );
+		}
+	}
+
+	//=====================================================================
+	// Cache hierarchy benchmarks
+	//=====================================================================
+
+	static void BM_CacheTopology_Query( ::benchmark::State& state )
+	{
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			size_t total{ 0 };
+			for ( int i = 0; i < QUERY_BATCH; ++i )
+			{
+				total += nfx::core::cpu::cacheTopology().dataCacheSize( 2 );
+				::benchmark::DoNotOptimize( total );
+			}
+		}
+
+		state.SetItemsProcessed( state.iterations() * QUERY_BATCH );
+	}
+
+	static void BM_CacheTopology_DetectCpuid( ::benchmark::State& state )
+	{
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			auto topology = nfx::core::cpu::detail::detectCachesCpuid();
+			::benchmark::DoNotOptimize( topology );
+		}
+	}
+
+	static void BM_CacheTopology_DetectSysfs( ::benchmark::State& state )
+	{
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			auto topology = nfx::core::cpu::detail::detectCachesSysfs();
+			::benchmark::DoNotOptimize( topology );
+		}
+	}
+} // namespace nfx::core::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+BENCHMARK( nfx::core::benchmark::BM_Features_Snapshot );
+BENCHMARK( nfx::core::benchmark::BM_Features_HasSSE42Support );
+BENCHMARK( nfx::core::benchmark::BM_Features_FunctionLocalStatic );
+BENCHMARK( nfx::core::benchmark::BM_Features_Detect );
+
+BENCHMARK( nfx::core::benchmark::BM_CacheTopology_Query );
+BENCHMARK( nfx::core::benchmark::BM_CacheTopology_DetectCpuid );
+BENCHMARK( nfx::core::benchmark::BM_CacheTopology_DetectSysfs );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,182 @@
+/**
+ * @file BM_Checksum.cpp
+ * @brief Benchmark CRC32-C checksum throughput
+ * @details Checksums 64 B to 1 MiB blocks with the dispatched crc32c(), every kernel on
+ *          its own (slicing-by-8 software, one SSE4.2 stream, 2-4 interleaved streams)
+ *          and the byte-at-a-time hashStringView() loop, reporting bytes per second.
+ *          Also measures in-place verification of blocks carrying a trailing CRC.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <nfx/core/Checksum.h>
+#include <nfx/core/CPU.h>
+#include <nfx/core/Hashing.h>
+
+#include "PerfCounters.h"
+
+namespace nfx::core::benchmark
+{
+	//=====================================================================
+	// Checksum benchmark suite
+	//=====================================================================
+
+	/** @brief Largest checksummed block. */
+	static constexpr size_t CHECKSUM_MAX_BYTES{ 1 << 20 };
+
+	//=====================================================================
+	// Test data generation
+	//=====================================================================
+
+	static const std::vector<std::byte>& checksumBuffer()
+	{
+		static const std::vector<std::byte> s_buffer = []() {
+			std::vector<std::byte> buffer( CHECKSUM_MAX_BYTES );
+			std::mt19937 gen( 42 );
+			for ( auto& byte : buffer )
+			{
+				byte = static_cast<std::byte>( gen() );
+			}
+			return buffer;
+		}();
+
+		return s_buffer;
+	}
+
+	/** @brief 64 B .. 1 MiB in powers of 4. */
+	static void blockSizes( ::benchmark::internal::Benchmark* benchmark )
+	{
+		benchmark->ArgName( "bytes" );
+		for ( int64_t bytes = 64; bytes <= static_cast<int64_t>( CHECKSUM_MAX_BYTES ); bytes *= 4 )
+		{
+			benchmark->Arg( bytes );
+		}
+	}
+
+	//=====================================================================
+	// Throughput benchmarks
+	//=====================================================================
+
+	template <typename Checksum>
+	static void runChecksum( ::benchmark::State& state, Checksum checksum )
+	{
+		const std::span<const std::byte> block{ checksumBuffer().data(), static_cast<size_t>( state.range( 0 ) ) };
+
+		const PerfCounterScope perf{ state, block.size() };
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( block.data() );
+			uint32_t crc = checksum( block );
+			::benchmark::DoNotOptimize( crc );
+		}
+
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * block.size() ) );
+	}
+
+	static void BM_Crc32c( ::benchmark::State& state )
+	{
+		state.SetLabel( std::string{ nfx::core::checksum::crc32cImplementation() } );
+		runChecksum( state, []( std::span<const std::byte> block ) { return nfx::core::checksum::crc32c( block ); } );
+	}
+
+	static void BM_Crc32c_Software( ::benchmark::State& state )
+	{
+		runChecksum( state, []( std::span<const std::byte> block ) {
+			return nfx::core::checksum::detail::crc32cSoftware( 0xFFFFFFFF, block.data(), block.size() ) ^ 0xFFFFFFFF;
+		} );
+	}
+
+#if defined( __x86_64__ ) || defined( _M_X64 )
+	static void BM_Crc32c_HardwareSerial( ::benchmark::State& state )
+	{
+		if ( !nfx::core::cpu::hasSSE42Support() )
+		{
+			state.SkipWithError( "SSE4.2 not supported" );
+			return;
+		}
+		runChecksum( state, []( std::span<const std::byte> block ) {
+			return nfx::core::checksum::detail::crc32cHardware( 0xFFFFFFFF, block.data(), block.size() ) ^ 0xFFFFFFFF;
+		} );
+	}
+
+	template <size_t Streams>
+	static void BM_Crc32c_HardwareInterleaved( ::benchmark::State& state )
+	{
+		if ( !nfx::core::cpu::hasSSE42Support() )
+		{
+			state.SkipWithError( "SSE4.2 not supported" );
+			return;
+		}
+		runChecksum( state, []( std::span<const std::byte> block ) {
+			return nfx::core::checksum::detail::crc32cHardwareInterleaved<Streams>( 0xFFFFFFFF, block.data(), block.size() ) ^ 0xFFFFFFFF;
+		} );
+	}
+#endif
+
+	static void BM_Crc32c_HashStringView( ::benchmark::State& state )
+	{
+		// Baseline: the byte-at-a-time CRC32-C step behind hashStringView()
+		runChecksum( state, []( std::span<const std::byte> block ) {
+			return nfx::core::hashing::hashStringView<0xFFFFFFFF>( std::string_view{ reinterpret_cast<const char*>( block.data() ), block.size() } ) ^ 0xFFFFFFFF;
+		} );
+	}
+
+	//=====================================================================
+	// Verification benchmarks
+	//=====================================================================
+
+	static void BM_Crc32c_VerifyInPlace( ::benchmark::State& state )
+	{
+		std::vector<std::byte> block( checksumBuffer().begin(), checksumBuffer().begin() + state.range( 0 ) );
+		nfx::core::checksum::storeCrc32c( block );
+
+		const PerfCounterScope perf{ state, block.size() };
+		for ( auto _ : state )
+		{
+			bool valid = nfx::core::checksum::verifyCrc32c( block );
+			::benchmark::DoNotOptimize( valid );
+		}
+
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * block.size() ) );
+	}
+} // namespace nfx::core::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// Throughput
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_Crc32c )
+	->Apply( nfx::core::benchmark::blockSizes );
+BENCHMARK( nfx::core::benchmark::BM_Crc32c_Software )
+	->Apply( nfx::core::benchmark::blockSizes );
+#if defined( __x86_64__ ) || defined( _M_X64 )
+BENCHMARK( nfx::core::benchmark::BM_Crc32c_HardwareSerial )
+	->Apply( nfx::core::benchmark::blockSizes );
+BENCHMARK( nfx::core::benchmark::BM_Crc32c_HardwareInterleaved<2> )
+	->Apply( nfx::core::benchmark::blockSizes );
+BENCHMARK( nfx::core::benchmark::BM_Crc32c_HardwareInterleaved<3> )
+	->Apply( nfx::core::benchmark::blockSizes );
+BENCHMARK( nfx::core::benchmark::BM_Crc32c_HardwareInterleaved<4> )
+	->Apply( nfx::core::benchmark::blockSizes );
+#endif
+BENCHMARK( nfx::core::benchmark::BM_Crc32c_HashStringView )
+	->Apply( nfx::core::benchmark::blockSizes );
+
+//----------------------------------------------
+// Verification
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_Crc32c_VerifyInPlace )
+	->Apply( nfx::core::benchmark::blockSizes );
+
+BENCHMARK_MAIN();
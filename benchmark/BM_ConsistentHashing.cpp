@@ -0,0 +1,308 @@
+/**
+ * @file BM_ConsistentHashing.cpp
+ * @brief Benchmark consistent hashing shard routing
+ * @details Benchmarks per-key routing cost of jump consistent hash and rendezvous hashing
+ *          against a plain modulo baseline, and reports the fraction of keys remapped
+ *          when a node is added or removed
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <nfx/core/ConsistentHashing.h>
+#include <nfx/core/Hashing.h>
+
+#include "PerfCounters.h"
+
+namespace nfx::core::benchmark
+{
+	//=====================================================================
+	// Consistent hashing benchmark suite
+	//=====================================================================
+
+	//=====================================================================
+	// Test data generation
+	//=====================================================================
+
+	static const std::vector<std::string>& keyStrings()
+	{
+		static const std::vector<std::string> s_keys = []() {
+			std::vector<std::string> keys;
+			keys.reserve( 1 << 16 );
+			for ( size_t i = 0; i < ( 1 << 16 ); ++i )
+			{
+				keys.push_back( "user:" + std::to_string( i * 7919 ) );
+			}
+			return keys;
+		}();
+
+		return s_keys;
+	}
+
+	static const std::vector<uint64_t>& keyHashes()
+	{
+		static const std::vector<uint64_t> s_hashes = []() {
+			std::vector<uint64_t> hashes;
+			hashes.reserve( keyStrings().size() );
+			for ( const auto& key : keyStrings() )
+			{
+				hashes.push_back( nfx::core::hashing::hashInteger( static_cast<uint64_t>( nfx::core::hashing::hashStringView( key ) ) ) );
+			}
+			return hashes;
+		}();
+
+		return s_hashes;
+	}
+
+	static std::vector<nfx::core::hashing::RendezvousNode> makeNodes( size_t count )
+	{
+		std::vector<nfx::core::hashing::RendezvousNode> nodes;
+		nodes.reserve( count );
+		for ( size_t n = 0; n < count; ++n )
+		{
+			nodes.push_back( { nfx::core::hashing::hashInteger( static_cast<uint64_t>( n + 1 ) ), 1.0 } );
+		}
+
+		return nodes;
+	}
+
+	//=====================================================================
+	// Routing cost benchmarks
+	//=====================================================================
+
+	static void BM_Modulo_Baseline( ::benchmark::State& state )
+	{
+		// Baseline: hash the string key and take it modulo the node count
+		const auto& keys = keyStrings();
+		const uint32_t buckets = static_cast<uint32_t>( state.range( 0 ) );
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			for ( const auto& key : keys )
+			{
+				uint32_t shard = nfx::core::hashing::hashStringView( key ) % buckets;
+				::benchmark::DoNotOptimize( shard );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * keys.size() ) );
+	}
+
+	static void BM_JumpConsistentHash( ::benchmark::State& state )
+	{
+		const auto& hashes = keyHashes();
+		const uint32_t buckets = static_cast<uint32_t>( state.range( 0 ) );
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			for ( const uint64_t hash : hashes )
+			{
+				uint32_t shard = nfx::core::hashing::jumpConsistentHash( hash, buckets );
+				::benchmark::DoNotOptimize( shard );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * hashes.size() ) );
+	}
+
+	static void BM_JumpConsistentHash_Batch( ::benchmark::State& state )
+	{
+		const auto& hashes = keyHashes();
+		const uint32_t buckets = static_cast<uint32_t>( state.range( 0 ) );
+		std::vector<uint32_t> shards( hashes.size() );
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			nfx::core::hashing::jumpConsistentHash( hashes, buckets, shards );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * hashes.size() ) );
+	}
+
+	static void BM_RendezvousHash( ::benchmark::State& state )
+	{
+		const auto& hashes = keyHashes();
+		const auto nodes = makeNodes( static_cast<size_t>( state.range( 0 ) ) );
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			for ( const uint64_t hash : hashes )
+			{
+				size_t node = nfx::core::hashing::rendezvousHash( hash, nodes );
+				::benchmark::DoNotOptimize( node );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * hashes.size() ) );
+	}
+
+	static void BM_RendezvousHash_Batch( ::benchmark::State& state )
+	{
+		const auto& hashes = keyHashes();
+		const auto nodes = makeNodes( static_cast<size_t>( state.range( 0 ) ) );
+		std::vector<size_t> selected( hashes.size() );
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			nfx::core::hashing::rendezvousHash( hashes, nodes, selected );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * hashes.size() ) );
+	}
+
+	static void BM_RendezvousHash_Unweighted( ::benchmark::State& state )
+	{
+		const auto& hashes = keyHashes();
+		std::vector<uint64_t> ids;
+		for ( const auto& node : makeNodes( static_cast<size_t>( state.range( 0 ) ) ) )
+		{
+			ids.push_back( node.id );
+		}
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			for ( const uint64_t hash : hashes )
+			{
+				size_t node = nfx::core::hashing::rendezvousHash( hash, std::span<const uint64_t>{ ids } );
+				::benchmark::DoNotOptimize( node );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * hashes.size() ) );
+	}
+
+	//=====================================================================
+	// Remapping benchmarks
+	//=====================================================================
+
+	static void BM_Remap_AddNode( ::benchmark::State& state )
+	{
+		// Fraction of keys that change shard when growing from N to N + 1 (ideal: 1 / (N + 1))
+		const auto& keys = keyStrings();
+		const auto& hashes = keyHashes();
+		const uint32_t buckets = static_cast<uint32_t>( state.range( 0 ) );
+
+		size_t movedModulo = 0;
+		size_t movedJump = 0;
+		size_t movedRendezvous = 0;
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			const auto before = makeNodes( buckets );
+			const auto after = makeNodes( buckets + 1 );
+			movedModulo = movedJump = movedRendezvous = 0;
+
+			for ( size_t i = 0; i < hashes.size(); ++i )
+			{
+				const uint32_t keyHash = nfx::core::hashing::hashStringView( keys[i] );
+				movedModulo += ( keyHash % buckets ) != ( keyHash % ( buckets + 1 ) ) ? 1 : 0;
+				movedJump += nfx::core::hashing::jumpConsistentHash( hashes[i], buckets ) !=
+									 nfx::core::hashing::jumpConsistentHash( hashes[i], buckets + 1 )
+								 ? 1
+								 : 0;
+				movedRendezvous += before[nfx::core::hashing::rendezvousHash( hashes[i], before )].id !=
+										   after[nfx::core::hashing::rendezvousHash( hashes[i], after )].id
+									   ? 1
+									   : 0;
+			}
+		}
+
+		const double total = static_cast<double>( hashes.size() );
+		state.counters["moved_modulo"] = static_cast<double>( movedModulo ) / total;
+		state.counters["moved_jump"] = static_cast<double>( movedJump ) / total;
+		state.counters["moved_rendezvous"] = static_cast<double>( movedRendezvous ) / total;
+		state.counters["moved_ideal"] = 1.0 / static_cast<double>( buckets + 1 );
+	}
+
+	static void BM_Remap_RemoveNode( ::benchmark::State& state )
+	{
+		// Fraction of keys that change node when one node in the middle leaves (ideal: 1 / N)
+		const auto& hashes = keyHashes();
+		const size_t count = static_cast<size_t>( state.range( 0 ) );
+
+		size_t movedRendezvous = 0;
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			const auto before = makeNodes( count );
+			auto after = before;
+			after.erase( after.begin() + static_cast<std::ptrdiff_t>( count / 2 ) );
+			movedRendezvous = 0;
+
+			for ( const uint64_t hash : hashes )
+			{
+				movedRendezvous += before[nfx::core::hashing::rendezvousHash( hash, before )].id !=
+										   after[nfx::core::hashing::rendezvousHash( hash, after )].id
+									   ? 1
+									   : 0;
+			}
+		}
+
+		state.counters["moved_rendezvous"] = static_cast<double>( movedRendezvous ) / static_cast<double>( hashes.size() );
+		state.counters["moved_ideal"] = 1.0 / static_cast<double>( count );
+	}
+} // namespace nfx::core::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// Routing cost
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_Modulo_Baseline )
+	->Arg( 10 )
+	->Arg( 100 )
+	->Arg( 1000 )
+	->Repetitions( 3 );
+BENCHMARK( nfx::core::benchmark::BM_JumpConsistentHash )
+	->Arg( 10 )
+	->Arg( 100 )
+	->Arg( 1000 )
+	->Repetitions( 3 );
+BENCHMARK( nfx::core::benchmark::BM_JumpConsistentHash_Batch )
+	->Arg( 10 )
+	->Arg( 100 )
+	->Arg( 1000 )
+	->Repetitions( 3 );
+BENCHMARK( nfx::core::benchmark::BM_RendezvousHash )
+	->Arg( 10 )
+	->Arg( 100 )
+	->Repetitions( 3 );
+BENCHMARK( nfx::core::benchmark::BM_RendezvousHash_Batch )
+	->Arg( 10 )
+	->Arg( 100 )
+	->Repetitions( 3 );
+BENCHMARK( nfx::core::benchmark::BM_RendezvousHash_Unweighted )
+	->Arg( 10 )
+	->Arg( 100 )
+	->Repetitions( 3 );
+
+//----------------------------------------------
+// Remapping
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_Remap_AddNode )
+	->Arg( 10 )
+	->Arg( 100 )
+	->Iterations( 1 )
+	->Unit( ::benchmark::kMillisecond );
+BENCHMARK( nfx::core::benchmark::BM_Remap_RemoveNode )
+	->Arg( 10 )
+	->Arg( 100 )
+	->Iterations( 1 )
+	->Unit( ::benchmark::kMillisecond );
+
+BENCHMARK_MAIN();
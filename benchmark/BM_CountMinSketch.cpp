@@ -0,0 +1,265 @@
+/**
+ * @file BM_CountMinSketch.cpp
+ * @brief Benchmark Count-Min sketch and top-k heavy-hitter tracking
+ * @details Benchmarks for update throughput (single, batch, merged per-thread sketches)
+ *          and estimate error against exact counts on a Zipfian key stream
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <nfx/core/CountMinSketch.h>
+#include <nfx/core/Hashing.h>
+
+#include "PerfCounters.h"
+
+namespace nfx::core::benchmark
+{
+	//=====================================================================
+	// Count-Min sketch benchmark suite
+	//=====================================================================
+
+	//=====================================================================
+	// Test data generation
+	//=====================================================================
+
+	/** @brief Generates keys drawn from a Zipf(s) distribution over [0, universe). */
+	static std::vector<uint64_t> generateZipfKeys( size_t count, size_t universe, double s )
+	{
+		std::vector<double> cdf( universe );
+		double sum = 0.0;
+		for ( size_t k = 0; k < universe; ++k )
+		{
+			sum += 1.0 / std::pow( static_cast<double>( k + 1 ), s );
+			cdf[k] = sum;
+		}
+
+		std::mt19937_64 gen( 42 );
+		std::uniform_real_distribution<double> dist( 0.0, sum );
+
+		std::vector<uint64_t> keys;
+		keys.reserve( count );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			const auto it = std::lower_bound( cdf.begin(), cdf.end(), dist( gen ) );
+			keys.push_back( static_cast<uint64_t>( it - cdf.begin() ) );
+		}
+
+		return keys;
+	}
+
+	static const std::vector<uint64_t>& zipfHashes()
+	{
+		static const std::vector<uint64_t> s_hashes = []() {
+			std::vector<uint64_t> hashes;
+			for ( const uint64_t key : generateZipfKeys( 1 << 20, 1 << 20, 1.0 ) )
+			{
+				hashes.push_back( nfx::core::hashing::hashInteger( key ) );
+			}
+			return hashes;
+		}();
+
+		return s_hashes;
+	}
+
+	//=====================================================================
+	// Update throughput benchmarks
+	//=====================================================================
+
+	static void BM_CountMinSketch_AddSingle( ::benchmark::State& state )
+	{
+		const auto& hashes = zipfHashes();
+		nfx::core::sketch::CountMinSketch<> cms{ static_cast<size_t>( state.range( 0 ) ) };
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			for ( const uint64_t hash : hashes )
+			{
+				cms.add( hash );
+			}
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * hashes.size() ) );
+	}
+
+	static void BM_CountMinSketch_AddBatch( ::benchmark::State& state )
+	{
+		const auto& hashes = zipfHashes();
+		nfx::core::sketch::CountMinSketch<> cms{ static_cast<size_t>( state.range( 0 ) ) };
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			cms.add( hashes );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * hashes.size() ) );
+	}
+
+	static void BM_CountMinSketch_AddWithTopK( ::benchmark::State& state )
+	{
+		const auto& hashes = zipfHashes();
+		nfx::core::sketch::CountMinSketch<> cms{ 1 << 14 };
+		nfx::core::sketch::TopK<uint64_t> topK{ 64 };
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			for ( const uint64_t hash : hashes )
+			{
+				topK.offer( hash, cms.add( hash ) );
+			}
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * hashes.size() ) );
+	}
+
+	static void BM_UnorderedMap_ExactCount( ::benchmark::State& state )
+	{
+		// Baseline: exact per-key counters in a full hash map
+		const auto& hashes = zipfHashes();
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			std::unordered_map<uint64_t, uint32_t> counts;
+			for ( const uint64_t hash : hashes )
+			{
+				++counts[hash];
+			}
+			::benchmark::DoNotOptimize( counts );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * hashes.size() ) );
+	}
+
+	static void BM_CountMinSketch_Merge( ::benchmark::State& state )
+	{
+		const auto& hashes = zipfHashes();
+		const size_t width = static_cast<size_t>( state.range( 0 ) );
+		nfx::core::sketch::CountMinSketch<> a{ width };
+		nfx::core::sketch::CountMinSketch<> b{ width };
+		b.add( hashes );
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			bool merged = a.merge( b );
+			::benchmark::DoNotOptimize( merged );
+		}
+
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * width * a.depth() * sizeof( uint32_t ) ) );
+	}
+
+	//=====================================================================
+	// Accuracy benchmarks
+	//=====================================================================
+
+	static void BM_CountMinSketch_ZipfError( ::benchmark::State& state )
+	{
+		// Reports overcount of the sketch versus exact counts, as a fraction of stream length
+		const auto& hashes = zipfHashes();
+		const size_t width = static_cast<size_t>( state.range( 0 ) );
+
+		std::unordered_map<uint64_t, uint32_t> exact;
+		for ( const uint64_t hash : hashes )
+		{
+			++exact[hash];
+		}
+
+		double meanError = 0.0;
+		double maxError = 0.0;
+		double topRecall = 0.0;
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			nfx::core::sketch::CountMinSketch<> cms{ width };
+			nfx::core::sketch::TopK<uint64_t> topK{ 100 };
+			for ( const uint64_t hash : hashes )
+			{
+				topK.offer( hash, cms.add( hash ) );
+			}
+
+			double total = 0.0;
+			maxError = 0.0;
+			for ( const auto& [hash, count] : exact )
+			{
+				const double error = static_cast<double>( cms.estimate( hash ) - count );
+				total += error;
+				maxError = std::max( maxError, error );
+			}
+			meanError = total / static_cast<double>( exact.size() );
+
+			std::vector<std::pair<uint32_t, uint64_t>> ranked;
+			for ( const auto& [hash, count] : exact )
+			{
+				ranked.emplace_back( count, hash );
+			}
+			std::partial_sort( ranked.begin(), ranked.begin() + 100, ranked.end(), std::greater<>{} );
+
+			size_t found = 0;
+			for ( size_t i = 0; i < 100; ++i )
+			{
+				found += topK.contains( ranked[i].second ) ? 1 : 0;
+			}
+			topRecall = static_cast<double>( found ) / 100.0;
+		}
+
+		const double streamLength = static_cast<double>( hashes.size() );
+		state.counters["mean_overcount"] = meanError;
+		state.counters["max_overcount_ratio"] = maxError / streamLength;
+		state.counters["top100_recall"] = topRecall;
+		state.counters["sketch_bytes"] = static_cast<double>( width * 4 * sizeof( uint32_t ) );
+	}
+} // namespace nfx::core::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// Update throughput
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_CountMinSketch_AddSingle )
+	->Arg( 1 << 12 )
+	->Arg( 1 << 16 )
+	->Arg( 1 << 20 )
+	->Repetitions( 3 );
+BENCHMARK( nfx::core::benchmark::BM_CountMinSketch_AddBatch )
+	->Arg( 1 << 12 )
+	->Arg( 1 << 16 )
+	->Arg( 1 << 20 )
+	->Repetitions( 3 );
+BENCHMARK( nfx::core::benchmark::BM_CountMinSketch_AddWithTopK )
+	->Repetitions( 3 );
+BENCHMARK( nfx::core::benchmark::BM_UnorderedMap_ExactCount )
+	->Repetitions( 3 );
+BENCHMARK( nfx::core::benchmark::BM_CountMinSketch_Merge )
+	->Arg( 1 << 12 )
+	->Arg( 1 << 16 )
+	->Repetitions( 3 );
+
+//----------------------------------------------
+// Accuracy
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_CountMinSketch_ZipfError )
+	->Arg( 1 << 10 )
+	->Arg( 1 << 12 )
+	->Arg( 1 << 14 )
+	->Iterations( 1 )
+	->Unit( ::benchmark::kMillisecond );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,96 @@
+/**
+ * @file BM_CycleTimer.cpp
+ * @brief Benchmark timer read overhead
+ * @details Compares the cost of one cycle-counter read in each ordering mode with
+ *          `std::chrono::steady_clock` and `high_resolution_clock`
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+
+#include <nfx/core/CycleTimer.h>
+
+#include "PerfCounters.h"
+
+namespace nfx::core::benchmark
+{
+	//=====================================================================
+	// Timer overhead benchmark suite
+	//=====================================================================
+
+	template <typename Clock>
+	static void BM_Timer_Chrono( ::benchmark::State& state )
+	{
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			auto now = Clock::now();
+			::benchmark::DoNotOptimize( now );
+		}
+	}
+
+	template <nfx::core::cpu::TscRead Mode>
+	static void BM_Timer_ReadCycles( ::benchmark::State& state )
+	{
+		if ( Mode == nfx::core::cpu::TscRead::End && !nfx::core::cpu::tscInfo().rdtscp )
+		{
+			state.SkipWithError( "RDTSCP not available" );
+			return;
+		}
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			uint64_t cycles = nfx::core::cpu::readCycles<Mode>();
+			::benchmark::DoNotOptimize( cycles );
+		}
+	}
+
+	static void BM_Timer_CycleTimerElapsedNanoseconds( ::benchmark::State& state )
+	{
+		// Full stopwatch: start read, end read and conversion
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			nfx::core::cpu::CycleTimer timer;
+			double elapsed = timer.elapsedNanoseconds();
+			::benchmark::DoNotOptimize( elapsed );
+		}
+	}
+
+	static void BM_Timer_SteadyClockInterval( ::benchmark::State& state )
+	{
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			const auto start = std::chrono::steady_clock::now();
+			double elapsed = std::chrono::duration<double, std::nano>( std::chrono::steady_clock::now() - start ).count();
+			::benchmark::DoNotOptimize( elapsed );
+		}
+	}
+} // namespace nfx::core::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// Single reads
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_Timer_Chrono<std::chrono::steady_clock> );
+BENCHMARK( nfx::core::benchmark::BM_Timer_Chrono<std::chrono::high_resolution_clock> );
+BENCHMARK( nfx::core::benchmark::BM_Timer_ReadCycles<nfx::core::cpu::TscRead::Relaxed> );
+BENCHMARK( nfx::core::benchmark::BM_Timer_ReadCycles<nfx::core::cpu::TscRead::Begin> );
+BENCHMARK( nfx::core::benchmark::BM_Timer_ReadCycles<nfx::core::cpu::TscRead::End> );
+BENCHMARK( nfx::core::benchmark::BM_Timer_ReadCycles<nfx::core::cpu::TscRead::Serialized> );
+
+//----------------------------------------------
+// Intervals
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_Timer_CycleTimerElapsedNanoseconds );
+BENCHMARK( nfx::core::benchmark::BM_Timer_SteadyClockInterval );
+
+BENCHMARK_MAIN();
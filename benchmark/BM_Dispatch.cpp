@@ -0,0 +1,191 @@
+/**
+ * @file BM_Dispatch.cpp
+ * @brief Benchmark runtime dispatch overhead
+ * @details Compares a direct call, a Dispatcher call through the cached pointer and a
+ *          per-call feature check, and runs every kernel tier supported by the host
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <nfx/core/Dispatch.h>
+
+#include "PerfCounters.h"
+
+namespace nfx::core::benchmark
+{
+	//=====================================================================
+	// Dispatch benchmark suite
+	//=====================================================================
+
+	using SumSignature = uint64_t( std::span<const uint8_t> );
+
+	//=====================================================================
+	// Kernels
+	//=====================================================================
+
+	static uint64_t sumScalar( std::span<const uint8_t> bytes )
+	{
+		uint64_t total{ 0 };
+		for ( const uint8_t b : bytes )
+		{
+			total += b;
+		}
+
+		return total;
+	}
+
+	NFX_CORE_TARGET( "avx2" )
+	static uint64_t sumAvx2( std::span<const uint8_t> bytes )
+	{
+		uint64_t total{ 0 };
+		for ( const uint8_t b : bytes )
+		{
+			total += b;
+		}
+
+		return total;
+	}
+
+	NFX_CORE_TARGET( "avx512f,avx512bw" )
+	static uint64_t sumAvx512( std::span<const uint8_t> bytes )
+	{
+		uint64_t total{ 0 };
+		for ( const uint8_t b : bytes )
+		{
+			total += b;
+		}
+
+		return total;
+	}
+
+	static constinit auto s_sum = nfx::core::cpu::makeDispatcher<SumSignature>(
+		nfx::core::cpu::DispatchCandidate<SumSignature>{ "avx512", nfx::core::cpu::Feature::AVX512F | nfx::core::cpu::Feature::AVX512BW | nfx::core::cpu::Feature::FastAvx512, &sumAvx512 },
+		nfx::core::cpu::DispatchCandidate<SumSignature>{ "avx2", nfx::core::cpu::Feature::AVX2, &sumAvx2 },
+		nfx::core::cpu::DispatchCandidate<SumSignature>{ "scalar", nfx::core::cpu::Feature::None, &sumScalar } );
+
+	static std::vector<uint8_t> makeBytes( size_t count )
+	{
+		std::vector<uint8_t> bytes( count );
+		std::iota( bytes.begin(), bytes.end(), uint8_t{ 1 } );
+
+		return bytes;
+	}
+
+	//=====================================================================
+	// Call overhead benchmarks
+	//=====================================================================
+
+	static void BM_Dispatch_DirectCall( ::benchmark::State& state )
+	{
+		const auto bytes = makeBytes( static_cast<size_t>( state.range( 0 ) ) );
+
+		const PerfCounterScope perf{ state, bytes.size() };
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( bytes.data() );
+			uint64_t total = sumScalar( bytes );
+			::benchmark::DoNotOptimize( total );
+		}
+
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * bytes.size() ) );
+	}
+
+	static void BM_Dispatch_CachedPointer( ::benchmark::State& state )
+	{
+		const auto bytes = makeBytes( static_cast<size_t>( state.range( 0 ) ) );
+		s_sum.resolve( nfx::core::cpu::Feature::None );
+
+		const PerfCounterScope perf{ state, bytes.size() };
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( bytes.data() );
+			uint64_t total = s_sum( bytes );
+			::benchmark::DoNotOptimize( total );
+		}
+
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * bytes.size() ) );
+		s_sum.reset();
+	}
+
+	static void BM_Dispatch_PerCallCheck( ::benchmark::State& state )
+	{
+		// The boilerplate the dispatcher replaces: query features on every call
+		const auto bytes = makeBytes( static_cast<size_t>( state.range( 0 ) ) );
+
+		const PerfCounterScope perf{ state, bytes.size() };
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( bytes.data() );
+			const auto& features = nfx::core::cpu::features();
+			uint64_t total = features.avx512bw ? sumAvx512( bytes ) : features.avx2 ? sumAvx2( bytes )
+																					 : sumScalar( bytes );
+			::benchmark::DoNotOptimize( total );
+		}
+
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * bytes.size() ) );
+	}
+
+	//=====================================================================
+	// Tier benchmarks
+	//=====================================================================
+
+	static void BM_Dispatch_Tier( ::benchmark::State& state )
+	{
+		// range(0): candidate index, best first
+		const auto& candidate = s_sum.candidates()[static_cast<size_t>( state.range( 0 ) )];
+		if ( !nfx::core::cpu::hasAll( nfx::core::cpu::dispatchFeatures(), candidate.required ) )
+		{
+			state.SkipWithError( "Tier not supported on this host" );
+			return;
+		}
+
+		const auto bytes = makeBytes( static_cast<size_t>( state.range( 1 ) ) );
+		s_sum.resolve( candidate.required );
+		state.SetLabel( std::string{ s_sum.selectedName() } );
+
+		const PerfCounterScope perf{ state, bytes.size() };
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( bytes.data() );
+			uint64_t total = s_sum( bytes );
+			::benchmark::DoNotOptimize( total );
+		}
+
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * bytes.size() ) );
+		s_sum.reset();
+	}
+} // namespace nfx::core::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// Call overhead
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_Dispatch_DirectCall )
+	->Arg( 16 )
+	->Arg( 4096 );
+BENCHMARK( nfx::core::benchmark::BM_Dispatch_CachedPointer )
+	->Arg( 16 )
+	->Arg( 4096 );
+BENCHMARK( nfx::core::benchmark::BM_Dispatch_PerCallCheck )
+	->Arg( 16 )
+	->Arg( 4096 );
+
+//----------------------------------------------
+// Tiers
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_Dispatch_Tier )
+	->ArgNames( { "tier", "bytes" } )
+	->ArgsProduct( { { 0, 1, 2 }, { 4096 } } );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,565 @@
+/**
+ * @file BM_HashQuality.cpp
+ * @brief Hash quality and probe-length benchmark harness
+ * @details Runs each nfx hash over structured key sets (sequential, common-prefix, UUID,
+ *          strided) and reports avalanche bias, bucket chi-squared and probe lengths in a
+ *          simulated linear-probing table. The timed loop is a full lookup (hash, probe,
+ *          key compare), so hashes can be ranked by end-to-end lookup cost.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/core/Hashing.h>
+
+#include "PerfCounters.h"
+
+namespace nfx::core::benchmark
+{
+	//=====================================================================
+	// Hash quality benchmark suite
+	//=====================================================================
+
+	/** @brief Keys inserted into the simulated table (load factor 0.75). */
+	static constexpr size_t QUALITY_KEY_COUNT{ 3 << 14 };
+
+	/** @brief Slots in the simulated open-addressing table. */
+	static constexpr size_t QUALITY_TABLE_SIZE{ 1 << 16 };
+
+	/** @brief Buckets used for the chi-squared uniformity test. */
+	static constexpr size_t QUALITY_CHI_BUCKETS{ 1 << 12 };
+
+	/** @brief Keys sampled for the avalanche matrix. */
+	static constexpr size_t QUALITY_AVALANCHE_SAMPLES{ 512 };
+
+	//=====================================================================
+	// Hashes under test
+	//=====================================================================
+
+	/*
+	 * Each adapter maps a key to the value a table would mask with (size - 1).
+	 * `bits` is the width of the meaningful output and `inputBits` the number of low key
+	 * bits the hash reads (unbounded for strings); both bound the avalanche test.
+	 */
+
+	//----------------------------------------------
+	// String hashes
+	//----------------------------------------------
+
+	struct LarsonHasher
+	{
+		static constexpr int bits = 32;
+		static constexpr size_t inputBits = std::numeric_limits<size_t>::max();
+
+		uint64_t operator()( std::string_view key ) const noexcept
+		{
+			uint32_t hash{ 0 };
+			for ( const char ch : key )
+			{
+				hash = nfx::core::hashing::Larson( hash, static_cast<uint8_t>( ch ) );
+			}
+			return hash;
+		}
+	};
+
+	struct Fnv1aHasher
+	{
+		static constexpr int bits = 32;
+		static constexpr size_t inputBits = std::numeric_limits<size_t>::max();
+
+		uint64_t operator()( std::string_view key ) const noexcept
+		{
+			uint32_t hash{ nfx::core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS };
+			for ( const char ch : key )
+			{
+				hash = nfx::core::hashing::fnv1a( hash, static_cast<uint8_t>( ch ) );
+			}
+			return hash;
+		}
+	};
+
+	struct HashStringViewHasher
+	{
+		static constexpr int bits = 32;
+		static constexpr size_t inputBits = std::numeric_limits<size_t>::max();
+
+		uint64_t operator()( std::string_view key ) const noexcept
+		{
+			return nfx::core::hashing::hashStringView( key );
+		}
+	};
+
+	struct HashStringViewSeedMixHasher
+	{
+		static constexpr int bits = 32;
+		static constexpr size_t inputBits = std::numeric_limits<size_t>::max();
+
+		uint64_t operator()( std::string_view key ) const noexcept
+		{
+			// Full 32-bit mask so the table applies its own (size - 1)
+			return nfx::core::hashing::seedMix( 0x1A21DA, nfx::core::hashing::hashStringView( key ), size_t{ 1 } << 32 );
+		}
+	};
+
+	struct StdStringHasher
+	{
+		static constexpr int bits = 64;
+		static constexpr size_t inputBits = std::numeric_limits<size_t>::max();
+
+		uint64_t operator()( std::string_view key ) const noexcept
+		{
+			return std::hash<std::string_view>{}( key );
+		}
+	};
+
+	//----------------------------------------------
+	// Integer hashes
+	//----------------------------------------------
+
+	struct HashInteger64Hasher
+	{
+		static constexpr int bits = 64;
+		static constexpr size_t inputBits = 64;
+
+		uint64_t operator()( uint64_t key ) const noexcept
+		{
+			return nfx::core::hashing::hashInteger( key );
+		}
+	};
+
+	struct HashInteger32Hasher
+	{
+		static constexpr int bits = 32;
+		static constexpr size_t inputBits = 32;
+
+		uint64_t operator()( uint64_t key ) const noexcept
+		{
+			return nfx::core::hashing::hashInteger( static_cast<uint32_t>( key ) );
+		}
+	};
+
+	struct CombineHasher
+	{
+		static constexpr int bits = 64;
+		static constexpr size_t inputBits = 64;
+
+		uint64_t operator()( uint64_t key ) const noexcept
+		{
+			return nfx::core::hashing::combine( size_t{ 0 }, static_cast<size_t>( key ) );
+		}
+	};
+
+	struct SeedMixHasher
+	{
+		static constexpr int bits = 32;
+		static constexpr size_t inputBits = 32;
+
+		uint64_t operator()( uint64_t key ) const noexcept
+		{
+			return nfx::core::hashing::seedMix( 0x1A21DA, static_cast<uint32_t>( key ), size_t{ 1 } << 32 );
+		}
+	};
+
+	struct StdIntegerHasher
+	{
+		static constexpr int bits = 64;
+		static constexpr size_t inputBits = 64;
+
+		uint64_t operator()( uint64_t key ) const noexcept
+		{
+			return std::hash<uint64_t>{}( key );
+		}
+	};
+
+	//=====================================================================
+	// Test data generation
+	//=====================================================================
+
+	enum class KeySet
+	{
+		Sequential, ///< 0, 1, 2, ... (decimal text for string hashes)
+		Prefix,		///< Long shared prefix with a zero-padded counter
+		Uuid,		///< Random version-4 UUID text
+		Strided,	///< Multiples of 4096, like aligned pointers or page numbers
+		Random		///< Uniform random 64-bit integers
+	};
+
+	static std::vector<std::string> generateStringKeys( KeySet set )
+	{
+		std::vector<std::string> keys;
+		keys.reserve( QUALITY_KEY_COUNT );
+
+		std::mt19937_64 gen( 42 );
+		char buffer[64];
+		for ( size_t i = 0; i < QUALITY_KEY_COUNT; ++i )
+		{
+			switch ( set )
+			{
+				case KeySet::Prefix:
+				{
+					std::snprintf( buffer, sizeof( buffer ), "https://api.example.com/v1/users/%010zu", i );
+					keys.emplace_back( buffer );
+					break;
+				}
+				case KeySet::Uuid:
+				{
+					const uint64_t hi = gen();
+					const uint64_t lo = gen();
+					std::snprintf( buffer, sizeof( buffer ), "%08x-%04x-4%03x-%04x-%012llx",
+						static_cast<unsigned>( hi >> 32 ), static_cast<unsigned>( ( hi >> 16 ) & 0xFFFF ),
+						static_cast<unsigned>( hi & 0xFFF ), static_cast<unsigned>( 0x8000 | ( ( lo >> 48 ) & 0x3FFF ) ),
+						static_cast<unsigned long long>( lo & 0xFFFFFFFFFFFFULL ) );
+					keys.emplace_back( buffer );
+					break;
+				}
+				default:
+				{
+					keys.push_back( std::to_string( i ) );
+					break;
+				}
+			}
+		}
+
+		return keys;
+	}
+
+	static std::vector<uint64_t> generateIntegerKeys( KeySet set )
+	{
+		std::vector<uint64_t> keys;
+		keys.reserve( QUALITY_KEY_COUNT );
+
+		std::mt19937_64 gen( 42 );
+		for ( uint64_t i = 0; i < QUALITY_KEY_COUNT; ++i )
+		{
+			switch ( set )
+			{
+				case KeySet::Strided:
+				{
+					keys.push_back( i << 12 );
+					break;
+				}
+				case KeySet::Random:
+				{
+					keys.push_back( gen() );
+					break;
+				}
+				default:
+				{
+					keys.push_back( i );
+					break;
+				}
+			}
+		}
+
+		return keys;
+	}
+
+	//----------------------------------------------
+	// Key bit access for the avalanche test
+	//----------------------------------------------
+
+	static size_t keyBits( const std::string& key ) noexcept
+	{
+		return key.size() * 8;
+	}
+
+	static size_t keyBits( uint64_t ) noexcept
+	{
+		return 64;
+	}
+
+	static std::string flipBit( std::string key, size_t bit ) noexcept
+	{
+		key[bit / 8] = static_cast<char>( static_cast<uint8_t>( key[bit / 8] ) ^ ( 1u << ( bit % 8 ) ) );
+		return key;
+	}
+
+	static uint64_t flipBit( uint64_t key, size_t bit ) noexcept
+	{
+		return key ^ ( uint64_t{ 1 } << bit );
+	}
+
+	//=====================================================================
+	// Quality metrics
+	//=====================================================================
+
+	/**
+	 * @brief Strict avalanche criterion over the input-bit x output-bit matrix.
+	 * @details Each cell is the probability that flipping the input bit flips the output
+	 *          bit; bias is |2p - 1| (0 = ideal, 1 = bit never or always flips).
+	 */
+	template <typename Hasher, typename Key>
+	static void measureAvalanche( const std::vector<Key>& keys, double& worstBias, double& meanBias )
+	{
+		const Hasher hasher;
+		const size_t samples = std::min( keys.size(), QUALITY_AVALANCHE_SAMPLES );
+
+		// String key lengths vary; cover the bits every sampled key has and the hash reads
+		size_t inputBits = std::min( keyBits( keys[0] ), Hasher::inputBits );
+		for ( size_t k = 0; k < samples; ++k )
+		{
+			inputBits = std::min( inputBits, keyBits( keys[k] ) );
+		}
+
+		std::vector<uint32_t> flips( inputBits * Hasher::bits, 0 );
+		for ( size_t k = 0; k < samples; ++k )
+		{
+			const uint64_t base = hasher( keys[k] );
+			for ( size_t in = 0; in < inputBits; ++in )
+			{
+				const uint64_t diff = base ^ hasher( flipBit( keys[k], in ) );
+				for ( int out = 0; out < Hasher::bits; ++out )
+				{
+					flips[in * Hasher::bits + static_cast<size_t>( out )] += static_cast<uint32_t>( ( diff >> out ) & 1 );
+				}
+			}
+		}
+
+		worstBias = 0.0;
+		double total = 0.0;
+		for ( const uint32_t count : flips )
+		{
+			const double bias = std::abs( 2.0 * static_cast<double>( count ) / static_cast<double>( samples ) - 1.0 );
+			worstBias = std::max( worstBias, bias );
+			total += bias;
+		}
+		meanBias = total / static_cast<double>( flips.size() );
+	}
+
+	/**
+	 * @brief Chi-squared of the low-bit bucket distribution, as a z-score.
+	 * @details 0 is ideal; values beyond ~3 indicate clustering the table will feel.
+	 */
+	static double measureChiSquaredZ( const std::vector<uint64_t>& hashes )
+	{
+		std::vector<uint32_t> buckets( QUALITY_CHI_BUCKETS, 0 );
+		for ( const uint64_t hash : hashes )
+		{
+			++buckets[hash & ( QUALITY_CHI_BUCKETS - 1 )];
+		}
+
+		const double expected = static_cast<double>( hashes.size() ) / static_cast<double>( QUALITY_CHI_BUCKETS );
+		double chiSquared = 0.0;
+		for ( const uint32_t count : buckets )
+		{
+			const double delta = static_cast<double>( count ) - expected;
+			chiSquared += delta * delta / expected;
+		}
+
+		const double freedom = static_cast<double>( QUALITY_CHI_BUCKETS - 1 );
+		return ( chiSquared - freedom ) / std::sqrt( 2.0 * freedom );
+	}
+
+	//=====================================================================
+	// Simulated open-addressing table
+	//=====================================================================
+
+	struct ProbeSlot
+	{
+		uint64_t hash{ 0 };
+		uint32_t keyIndex{ UINT32_MAX }; ///< UINT32_MAX marks an empty slot
+	};
+
+	/** @brief Linear-probing table indexed by the low bits of the hash, as the nfx tables are. */
+	static std::vector<ProbeSlot> buildTable( const std::vector<uint64_t>& hashes )
+	{
+		std::vector<ProbeSlot> table( QUALITY_TABLE_SIZE );
+		for ( uint32_t i = 0; i < hashes.size(); ++i )
+		{
+			size_t slot = hashes[i] & ( QUALITY_TABLE_SIZE - 1 );
+			while ( table[slot].keyIndex != UINT32_MAX )
+			{
+				slot = ( slot + 1 ) & ( QUALITY_TABLE_SIZE - 1 );
+			}
+			table[slot] = { hashes[i], i };
+		}
+
+		return table;
+	}
+
+	/** @brief Slots inspected by a successful lookup of each key (1 = home slot). */
+	static void measureProbes( const std::vector<ProbeSlot>& table, const std::vector<uint64_t>& hashes, double& meanProbes, double& maxProbes )
+	{
+		size_t total = 0;
+		size_t worst = 0;
+		for ( uint32_t i = 0; i < hashes.size(); ++i )
+		{
+			size_t slot = hashes[i] & ( QUALITY_TABLE_SIZE - 1 );
+			size_t probes = 1;
+			while ( table[slot].keyIndex != i )
+			{
+				slot = ( slot + 1 ) & ( QUALITY_TABLE_SIZE - 1 );
+				++probes;
+			}
+			total += probes;
+			worst = std::max( worst, probes );
+		}
+
+		meanProbes = static_cast<double>( total ) / static_cast<double>( hashes.size() );
+		maxProbes = static_cast<double>( worst );
+	}
+
+	//=====================================================================
+	// Quality benchmarks
+	//=====================================================================
+
+	template <typename Hasher, typename Key>
+	static void runQuality( ::benchmark::State& state, const std::vector<Key>& keys )
+	{
+		const Hasher hasher;
+
+		std::vector<uint64_t> hashes;
+		hashes.reserve( keys.size() );
+		for ( const auto& key : keys )
+		{
+			hashes.push_back( hasher( key ) );
+		}
+		const auto table = buildTable( hashes );
+
+		// Timed: end-to-end lookup of every key (hash, probe sequence, key compare).
+		// Scoped so the perf counters stop before the avalanche and probe passes below.
+		{
+			const PerfCounterScope perf{ state };
+			for ( auto _ : state )
+			{
+				size_t found = 0;
+				for ( const auto& key : keys )
+				{
+					const uint64_t hash = hasher( key );
+					size_t slot = hash & ( QUALITY_TABLE_SIZE - 1 );
+					while ( table[slot].keyIndex != UINT32_MAX )
+					{
+						if ( table[slot].hash == hash && keys[table[slot].keyIndex] == key )
+						{
+							++found;
+							break;
+						}
+						slot = ( slot + 1 ) & ( QUALITY_TABLE_SIZE - 1 );
+					}
+				}
+				::benchmark::DoNotOptimize( found );
+			}
+		}
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * keys.size() ) );
+
+		double worstBias = 0.0;
+		double meanBias = 0.0;
+		double meanProbes = 0.0;
+		double maxProbes = 0.0;
+		measureAvalanche<Hasher>( keys, worstBias, meanBias );
+		measureProbes( table, hashes, meanProbes, maxProbes );
+
+		state.counters["avalanche_worst"] = worstBias;
+		state.counters["avalanche_mean"] = meanBias;
+		state.counters["chi2_z"] = measureChiSquaredZ( hashes );
+		state.counters["probe_mean"] = meanProbes;
+		state.counters["probe_max"] = maxProbes;
+	}
+
+	template <typename Hasher, KeySet Set>
+	static void BM_StringQuality( ::benchmark::State& state )
+	{
+		runQuality<Hasher>( state, generateStringKeys( Set ) );
+	}
+
+	template <typename Hasher, KeySet Set>
+	static void BM_IntegerQuality( ::benchmark::State& state )
+	{
+		runQuality<Hasher>( state, generateIntegerKeys( Set ) );
+	}
+} // namespace nfx::core::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// String hashes
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_StringQuality<nfx::core::benchmark::LarsonHasher, nfx::core::benchmark::KeySet::Sequential> )
+	->Iterations( 20 );
+BENCHMARK( nfx::core::benchmark::BM_StringQuality<nfx::core::benchmark::LarsonHasher, nfx::core::benchmark::KeySet::Prefix> )
+	->Iterations( 20 );
+BENCHMARK( nfx::core::benchmark::BM_StringQuality<nfx::core::benchmark::LarsonHasher, nfx::core::benchmark::KeySet::Uuid> )
+	->Iterations( 20 );
+
+BENCHMARK( nfx::core::benchmark::BM_StringQuality<nfx::core::benchmark::Fnv1aHasher, nfx::core::benchmark::KeySet::Sequential> )
+	->Iterations( 20 );
+BENCHMARK( nfx::core::benchmark::BM_StringQuality<nfx::core::benchmark::Fnv1aHasher, nfx::core::benchmark::KeySet::Prefix> )
+	->Iterations( 20 );
+BENCHMARK( nfx::core::benchmark::BM_StringQuality<nfx::core::benchmark::Fnv1aHasher, nfx::core::benchmark::KeySet::Uuid> )
+	->Iterations( 20 );
+
+BENCHMARK( nfx::core::benchmark::BM_StringQuality<nfx::core::benchmark::HashStringViewHasher, nfx::core::benchmark::KeySet::Sequential> )
+	->Iterations( 20 );
+BENCHMARK( nfx::core::benchmark::BM_StringQuality<nfx::core::benchmark::HashStringViewHasher, nfx::core::benchmark::KeySet::Prefix> )
+	->Iterations( 20 );
+BENCHMARK( nfx::core::benchmark::BM_StringQuality<nfx::core::benchmark::HashStringViewHasher, nfx::core::benchmark::KeySet::Uuid> )
+	->Iterations( 20 );
+
+BENCHMARK( nfx::core::benchmark::BM_StringQuality<nfx::core::benchmark::HashStringViewSeedMixHasher, nfx::core::benchmark::KeySet::Sequential> )
+	->Iterations( 20 );
+BENCHMARK( nfx::core::benchmark::BM_StringQuality<nfx::core::benchmark::HashStringViewSeedMixHasher, nfx::core::benchmark::KeySet::Prefix> )
+	->Iterations( 20 );
+BENCHMARK( nfx::core::benchmark::BM_StringQuality<nfx::core::benchmark::HashStringViewSeedMixHasher, nfx::core::benchmark::KeySet::Uuid> )
+	->Iterations( 20 );
+
+BENCHMARK( nfx::core::benchmark::BM_StringQuality<nfx::core::benchmark::StdStringHasher, nfx::core::benchmark::KeySet::Sequential> )
+	->Iterations( 20 );
+BENCHMARK( nfx::core::benchmark::BM_StringQuality<nfx::core::benchmark::StdStringHasher, nfx::core::benchmark::KeySet::Prefix> )
+	->Iterations( 20 );
+BENCHMARK( nfx::core::benchmark::BM_StringQuality<nfx::core::benchmark::StdStringHasher, nfx::core::benchmark::KeySet::Uuid> )
+	->Iterations( 20 );
+
+//----------------------------------------------
+// Integer hashes
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_IntegerQuality<nfx::core::benchmark::HashInteger64Hasher, nfx::core::benchmark::KeySet::Sequential> )
+	->Iterations( 20 );
+BENCHMARK( nfx::core::benchmark::BM_IntegerQuality<nfx::core::benchmark::HashInteger64Hasher, nfx::core::benchmark::KeySet::Strided> )
+	->Iterations( 20 );
+BENCHMARK( nfx::core::benchmark::BM_IntegerQuality<nfx::core::benchmark::HashInteger64Hasher, nfx::core::benchmark::KeySet::Random> )
+	->Iterations( 20 );
+
+BENCHMARK( nfx::core::benchmark::BM_IntegerQuality<nfx::core::benchmark::HashInteger32Hasher, nfx::core::benchmark::KeySet::Sequential> )
+	->Iterations( 20 );
+BENCHMARK( nfx::core::benchmark::BM_IntegerQuality<nfx::core::benchmark::HashInteger32Hasher, nfx::core::benchmark::KeySet::Strided> )
+	->Iterations( 20 );
+BENCHMARK( nfx::core::benchmark::BM_IntegerQuality<nfx::core::benchmark::HashInteger32Hasher, nfx::core::benchmark::KeySet::Random> )
+	->Iterations( 20 );
+
+BENCHMARK( nfx::core::benchmark::BM_IntegerQuality<nfx::core::benchmark::CombineHasher, nfx::core::benchmark::KeySet::Sequential> )
+	->Iterations( 20 );
+BENCHMARK( nfx::core::benchmark::BM_IntegerQuality<nfx::core::benchmark::CombineHasher, nfx::core::benchmark::KeySet::Strided> )
+	->Iterations( 20 );
+BENCHMARK( nfx::core::benchmark::BM_IntegerQuality<nfx::core::benchmark::CombineHasher, nfx::core::benchmark::KeySet::Random> )
+	->Iterations( 20 );
+
+BENCHMARK( nfx::core::benchmark::BM_IntegerQuality<nfx::core::benchmark::SeedMixHasher, nfx::core::benchmark::KeySet::Sequential> )
+	->Iterations( 20 );
+BENCHMARK( nfx::core::benchmark::BM_IntegerQuality<nfx::core::benchmark::SeedMixHasher, nfx::core::benchmark::KeySet::Strided> )
+	->Iterations( 20 );
+BENCHMARK( nfx::core::benchmark::BM_IntegerQuality<nfx::core::benchmark::SeedMixHasher, nfx::core::benchmark::KeySet::Random> )
+	->Iterations( 20 );
+
+BENCHMARK( nfx::core::benchmark::BM_IntegerQuality<nfx::core::benchmark::StdIntegerHasher, nfx::core::benchmark::KeySet::Sequential> )
+	->Iterations( 20 );
+BENCHMARK( nfx::core::benchmark::BM_IntegerQuality<nfx::core::benchmark::StdIntegerHasher, nfx::core::benchmark::KeySet::Strided> )
+	->Iterations( 20 );
+BENCHMARK( nfx::core::benchmark::BM_IntegerQuality<nfx::core::benchmark::StdIntegerHasher, nfx::core::benchmark::KeySet::Random> )
+	->Iterations( 20 );
+
+BENCHMARK_MAIN();
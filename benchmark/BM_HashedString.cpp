@@ -0,0 +1,183 @@
+/**
+ * @file BM_HashedString.cpp
+ * @brief Benchmark a multi-layer lookup path with and without pre-hashed keys
+ * @details Every lookup passes a router (jump consistent hash), an admission sketch
+ *          (Count-Min estimate) and a sharded linear-probing table. The baseline calls
+ *          hashStringView() in every layer and compares key bytes; the HashedStringView
+ *          path hashes once and compares cached hashes before bytes.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/core/ConsistentHashing.h>
+#include <nfx/core/CountMinSketch.h>
+#include <nfx/core/HashedString.h>
+#include <nfx/core/Hashing.h>
+#include <nfx/core/KeyEquality.h>
+
+#include "PerfCounters.h"
+
+namespace nfx::core::benchmark
+{
+	//=====================================================================
+	// Pre-hashed string benchmark suite
+	//=====================================================================
+
+	/** @brief Shards behind the router. */
+	static constexpr uint32_t LAYER_SHARD_COUNT{ 16 };
+
+	/** @brief Slots per shard table (25% load with LAYER_KEY_COUNT keys). */
+	static constexpr size_t LAYER_SHARD_SLOTS{ 1024 };
+
+	/** @brief Distinct keys stored and looked up. */
+	static constexpr size_t LAYER_KEY_COUNT{ 4096 };
+
+	//=====================================================================
+	// Test data generation
+	//=====================================================================
+
+	/** @brief Stored key with its cached hash, as a table keeps it. */
+	struct LayerSlot
+	{
+		std::string_view key;
+		uint32_t hash{ 0 };
+		uint32_t value{ 0 };
+	};
+
+	/** @brief Router, admission sketch and shard tables shared by both lookup paths. */
+	struct LayeredStore
+	{
+		std::vector<std::string> keys;
+		nfx::core::sketch::CountMinSketch<> admission{ 1 << 14 };
+		std::vector<std::vector<LayerSlot>> shards;
+
+		explicit LayeredStore( size_t keyLength )
+			: shards( LAYER_SHARD_COUNT, std::vector<LayerSlot>( LAYER_SHARD_SLOTS ) )
+		{
+			std::mt19937 gen( 42 );
+			std::uniform_int_distribution<int> chars( 'a', 'z' );
+			for ( size_t i = 0; i < LAYER_KEY_COUNT; ++i )
+			{
+				std::string key = "tenant/" + std::to_string( i ) + "/";
+				while ( key.size() < keyLength )
+				{
+					key.push_back( static_cast<char>( chars( gen ) ) );
+				}
+				keys.push_back( std::move( key ) );
+			}
+
+			for ( uint32_t i = 0; i < keys.size(); ++i )
+			{
+				const uint32_t hash = nfx::core::hashing::hashStringView( keys[i] );
+				admission.add( hash );
+
+				auto& table = shards[route( hash )];
+				uint32_t slot = nfx::core::hashing::seedMix( 1, hash, table.size() );
+				while ( !table[slot].key.empty() )
+				{
+					slot = ( slot + 1 ) & ( LAYER_SHARD_SLOTS - 1 );
+				}
+				table[slot] = { keys[i], hash, i + 1 };
+			}
+		}
+
+		static uint32_t route( uint32_t hash ) noexcept
+		{
+			return nfx::core::hashing::jumpConsistentHash( nfx::core::hashing::hashInteger( static_cast<uint64_t>( hash ) ), LAYER_SHARD_COUNT );
+		}
+	};
+
+	//=====================================================================
+	// Lookup path benchmarks
+	//=====================================================================
+
+	static void BM_Layers_RehashEveryLayer( ::benchmark::State& state )
+	{
+		const LayeredStore store{ static_cast<size_t>( state.range( 0 ) ) };
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			uint64_t total{ 0 };
+			for ( const std::string& text : store.keys )
+			{
+				const std::string_view key{ text };
+
+				// Router
+				const auto& table = store.shards[LayeredStore::route( nfx::core::hashing::hashStringView( key ) )];
+
+				// Admission sketch
+				total += store.admission.estimate( nfx::core::hashing::hashStringView( key ) );
+
+				// Shard table
+				for ( uint32_t slot = nfx::core::hashing::seedMix( 1, nfx::core::hashing::hashStringView( key ), table.size() );
+					  !table[slot].key.empty(); slot = ( slot + 1 ) & ( LAYER_SHARD_SLOTS - 1 ) )
+				{
+					if ( table[slot].key == key )
+					{
+						total += table[slot].value;
+						break;
+					}
+				}
+			}
+			::benchmark::DoNotOptimize( total );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * LAYER_KEY_COUNT ) );
+	}
+
+	static void BM_Layers_HashedStringView( ::benchmark::State& state )
+	{
+		const LayeredStore store{ static_cast<size_t>( state.range( 0 ) ) };
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			uint64_t total{ 0 };
+			for ( const std::string& text : store.keys )
+			{
+				const nfx::core::hashing::HashedStringView key{ text }; // Hashed once
+
+				const auto& table = store.shards[LayeredStore::route( nfx::core::hashing::hashStringView( key ) )];
+
+				total += store.admission.estimate( key.hash() );
+
+				for ( uint32_t slot = nfx::core::hashing::seedMix( 1, key, table.size() );
+					  !table[slot].key.empty(); slot = ( slot + 1 ) & ( LAYER_SHARD_SLOTS - 1 ) )
+				{
+					if ( nfx::core::hashing::hashedKeysEqual( table[slot].hash, table[slot].key, key.hash(), key.view() ) )
+					{
+						total += table[slot].value;
+						break;
+					}
+				}
+			}
+			::benchmark::DoNotOptimize( total );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * LAYER_KEY_COUNT ) );
+	}
+} // namespace nfx::core::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+BENCHMARK( nfx::core::benchmark::BM_Layers_RehashEveryLayer )
+	->ArgName( "key_length" )
+	->Arg( 16 )
+	->Arg( 32 )
+	->Arg( 64 );
+BENCHMARK( nfx::core::benchmark::BM_Layers_HashedStringView )
+	->ArgName( "key_length" )
+	->Arg( 16 )
+	->Arg( 32 )
+	->Arg( 64 );
+
+BENCHMARK_MAIN();
@@ -17,6 +17,8 @@
 #include <nfx/core/Hashing.h>
 #include <nfx/core/CPU.h>
 
+#include "PerfCounters.h"
+
 namespace nfx::core::benchmark
 {
 	//=====================================================================
@@ -69,6 +71,18 @@ namespace nfx::core::benchmark
 		return integers;
 	}
 
+	/** @brief Total characters in a string set, for per-byte counters. */
+	static size_t totalBytes( const std::vector<std::string>& strings )
+	{
+		size_t bytes = 0;
+		for ( const auto& str : strings )
+		{
+			bytes += str.size();
+		}
+
+		return bytes;
+	}
+
 	// Test data sets
 	static const auto shortStrings = generateTestStrings( 100, 3, 8 );
 	static const auto mediumStrings = generateTestStrings( 100, 10, 25 );
@@ -88,6 +102,8 @@ namespace nfx::core::benchmark
 		const uint32_t initialHash = nfx::core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS;
 		const uint8_t testByte = 'A';
 
+		const PerfCounterScope perf{ state };
+
 		for ( auto _ : state )
 		{
 			uint32_t hash = nfx::core::hashing::fnv1a<nfx::core::hashing::constants::DEFAULT_FNV_PRIME>( initialHash, testByte );
@@ -100,6 +116,8 @@ namespace nfx::core::benchmark
 		const uint32_t initialHash = 0;
 		const uint8_t testByte = 'A';
 
+		const PerfCounterScope perf{ state };
+
 		for ( auto _ : state )
 		{
 			uint32_t hash = nfx::core::hashing::crc32( initialHash, testByte );
@@ -112,6 +130,8 @@ namespace nfx::core::benchmark
 		const uint32_t initialHash = 0;
 		const uint8_t testByte = 'A';
 
+		const PerfCounterScope perf{ state };
+
 		for ( auto _ : state )
 		{
 			uint32_t hash = nfx::core::hashing::Larson( initialHash, testByte );
@@ -129,6 +149,8 @@ namespace nfx::core::benchmark
 		const uint32_t hash = 0xABCDEF01;
 		const size_t tableSize = 1024;
 
+		const PerfCounterScope perf{ state };
+
 		for ( auto _ : state )
 		{
 			uint32_t result = nfx::core::hashing::seedMix( seed, hash, tableSize );
@@ -136,6 +158,135 @@ namespace nfx::core::benchmark
 		}
 	}
 
+	static void BM_SeedMix64_Function( ::benchmark::State& state )
+	{
+		const uint64_t seed = 12345;
+		const uint64_t hash = 0xABCDEF0123456789ULL;
+		const size_t tableSize = size_t{ 1 } << 36;
+
+		const PerfCounterScope perf{ state };
+
+		for ( auto _ : state )
+		{
+			size_t result = nfx::core::hashing::seedMix64( seed, hash, tableSize );
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	//----------------------------------------------
+	// Range reduction
+	//----------------------------------------------
+
+	/*
+	 * Each benchmark reduces the same 4096 hashes into a table of state.range( 0 ) slots.
+	 * The divisor is only known at runtime, as it is for a resizable table.
+	 */
+
+	static const std::vector<uint32_t>& rangeHashes()
+	{
+		static const std::vector<uint32_t> s_hashes = []() {
+			std::vector<uint32_t> hashes;
+			for ( uint32_t i = 0; i < 4096; ++i )
+			{
+				hashes.push_back( static_cast<uint32_t>( nfx::core::hashing::hashInteger( i ) ) );
+			}
+			return hashes;
+		}();
+
+		return s_hashes;
+	}
+
+	static void BM_Reduce_Mask( ::benchmark::State& state )
+	{
+		// Baseline: power-of-2 mask (table rounded up to the next power of 2)
+		const auto& hashes = rangeHashes();
+		size_t tableSize = 1;
+		while ( tableSize < static_cast<size_t>( state.range( 0 ) ) )
+		{
+			tableSize <<= 1;
+		}
+		::benchmark::DoNotOptimize( tableSize );
+
+		const PerfCounterScope perf{ state };
+
+		for ( auto _ : state )
+		{
+			for ( const uint32_t hash : hashes )
+			{
+				uint32_t result = nfx::core::hashing::seedMix( 0, hash, tableSize );
+				::benchmark::DoNotOptimize( result );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * hashes.size() ) );
+		state.counters["slots"] = static_cast<double>( tableSize );
+	}
+
+	static void BM_Reduce_Modulo( ::benchmark::State& state )
+	{
+		// Baseline: hardware divide
+		const auto& hashes = rangeHashes();
+		uint32_t tableSize = static_cast<uint32_t>( state.range( 0 ) );
+		::benchmark::DoNotOptimize( tableSize );
+
+		const PerfCounterScope perf{ state };
+
+		for ( auto _ : state )
+		{
+			for ( const uint32_t hash : hashes )
+			{
+				uint32_t result = static_cast<uint32_t>( nfx::core::hashing::seedMix( 0, hash, size_t{ 1 } << 32 ) ) % tableSize;
+				::benchmark::DoNotOptimize( result );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * hashes.size() ) );
+		state.counters["slots"] = static_cast<double>( tableSize );
+	}
+
+	static void BM_Reduce_FastRange( ::benchmark::State& state )
+	{
+		const auto& hashes = rangeHashes();
+		size_t tableSize = static_cast<size_t>( state.range( 0 ) );
+		::benchmark::DoNotOptimize( tableSize );
+
+		const PerfCounterScope perf{ state };
+
+		for ( auto _ : state )
+		{
+			for ( const uint32_t hash : hashes )
+			{
+				uint32_t result = nfx::core::hashing::seedMixRange( 0, hash, tableSize );
+				::benchmark::DoNotOptimize( result );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * hashes.size() ) );
+		state.counters["slots"] = static_cast<double>( tableSize );
+	}
+
+	static void BM_Reduce_FastMod( ::benchmark::State& state )
+	{
+		const auto& hashes = rangeHashes();
+		uint32_t tableSize = static_cast<uint32_t>( state.range( 0 ) );
+		::benchmark::DoNotOptimize( tableSize );
+		const nfx::core::hashing::FastMod fastSize{ tableSize };
+
+		const PerfCounterScope perf{ state };
+
+		for ( auto _ : state )
+		{
+			for ( const uint32_t hash : hashes )
+			{
+				uint32_t result = nfx::core::hashing::seedMix( 0, hash, fastSize );
+				::benchmark::DoNotOptimize( result );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * hashes.size() ) );
+		state.counters["slots"] = static_cast<double>( tableSize );
+	}
+
 	//=====================================================================
 	// String hashing benchmarks
 	//=====================================================================
@@ -146,6 +297,8 @@ namespace nfx::core::benchmark
 
 	static void BM_HashStringView_Short( ::benchmark::State& state )
 	{
+		const PerfCounterScope perf{ state, totalBytes( shortStrings ) };
+
 		for ( auto _ : state )
 		{
 			uint32_t totalHash = 0;
@@ -159,6 +312,8 @@ namespace nfx::core::benchmark
 
 	static void BM_HashStringView_Medium( ::benchmark::State& state )
 	{
+		const PerfCounterScope perf{ state, totalBytes( mediumStrings ) };
+
 		for ( auto _ : state )
 		{
 			uint32_t totalHash = 0;
@@ -172,6 +327,8 @@ namespace nfx::core::benchmark
 
 	static void BM_HashStringView_Long( ::benchmark::State& state )
 	{
+		const PerfCounterScope perf{ state, totalBytes( longStrings ) };
+
 		for ( auto _ : state )
 		{
 			uint32_t totalHash = 0;
@@ -189,6 +346,8 @@ namespace nfx::core::benchmark
 
 	static void BM_ManualFNV1a_Short( ::benchmark::State& state )
 	{
+		const PerfCounterScope perf{ state, totalBytes( shortStrings ) };
+
 		for ( auto _ : state )
 		{
 			uint32_t totalHash = 0;
@@ -207,6 +366,8 @@ namespace nfx::core::benchmark
 
 	static void BM_ManualFNV1a_Medium( ::benchmark::State& state )
 	{
+		const PerfCounterScope perf{ state, totalBytes( mediumStrings ) };
+
 		for ( auto _ : state )
 		{
 			uint32_t totalHash = 0;
@@ -225,6 +386,8 @@ namespace nfx::core::benchmark
 
 	static void BM_ManualFNV1a_Long( ::benchmark::State& state )
 	{
+		const PerfCounterScope perf{ state, totalBytes( longStrings ) };
+
 		for ( auto _ : state )
 		{
 			uint32_t totalHash = 0;
@@ -247,6 +410,8 @@ namespace nfx::core::benchmark
 
 	static void BM_ManualCRC32_Short( ::benchmark::State& state )
 	{
+		const PerfCounterScope perf{ state, totalBytes( shortStrings ) };
+
 		for ( auto _ : state )
 		{
 			uint32_t totalHash = 0;
@@ -265,6 +430,8 @@ namespace nfx::core::benchmark
 
 	static void BM_ManualCRC32_Medium( ::benchmark::State& state )
 	{
+		const PerfCounterScope perf{ state, totalBytes( mediumStrings ) };
+
 		for ( auto _ : state )
 		{
 			uint32_t totalHash = 0;
@@ -283,6 +450,8 @@ namespace nfx::core::benchmark
 
 	static void BM_ManualCRC32_Long( ::benchmark::State& state )
 	{
+		const PerfCounterScope perf{ state, totalBytes( longStrings ) };
+
 		for ( auto _ : state )
 		{
 			uint32_t totalHash = 0;
@@ -307,6 +476,8 @@ namespace nfx::core::benchmark
 	{
 		std::hash<std::string> hasher;
 
+		const PerfCounterScope perf{ state, totalBytes( shortStrings ) };
+
 		for ( auto _ : state )
 		{
 			size_t totalHash = 0;
@@ -322,6 +493,8 @@ namespace nfx::core::benchmark
 	{
 		std::hash<std::string> hasher;
 
+		const PerfCounterScope perf{ state, totalBytes( mediumStrings ) };
+
 		for ( auto _ : state )
 		{
 			size_t totalHash = 0;
@@ -337,6 +510,8 @@ namespace nfx::core::benchmark
 	{
 		std::hash<std::string> hasher;
 
+		const PerfCounterScope perf{ state, totalBytes( longStrings ) };
+
 		for ( auto _ : state )
 		{
 			size_t totalHash = 0;
@@ -354,6 +529,8 @@ namespace nfx::core::benchmark
 
 	static void BM_HashInteger_uint32( ::benchmark::State& state )
 	{
+		const PerfCounterScope perf{ state };
+
 		for ( auto _ : state )
 		{
 			size_t totalHash = 0;
@@ -367,6 +544,8 @@ namespace nfx::core::benchmark
 
 	static void BM_HashInteger_uint64( ::benchmark::State& state )
 	{
+		const PerfCounterScope perf{ state };
+
 		for ( auto _ : state )
 		{
 			size_t totalHash = 0;
@@ -381,6 +560,8 @@ namespace nfx::core::benchmark
 
 	static void BM_HashInteger_int32( ::benchmark::State& state )
 	{
+		const PerfCounterScope perf{ state };
+
 		for ( auto _ : state )
 		{
 			size_t totalHash = 0;
@@ -401,6 +582,8 @@ namespace nfx::core::benchmark
 	{
 		std::hash<uint32_t> hasher;
 
+		const PerfCounterScope perf{ state };
+
 		for ( auto _ : state )
 		{
 			size_t totalHash = 0;
@@ -416,6 +599,8 @@ namespace nfx::core::benchmark
 	{
 		std::hash<uint64_t> hasher;
 
+		const PerfCounterScope perf{ state };
+
 		for ( auto _ : state )
 		{
 			size_t totalHash = 0;
@@ -440,6 +625,8 @@ namespace nfx::core::benchmark
 	{
 		const std::string testStr = "performance_test_string_for_comparison";
 
+		const PerfCounterScope perf{ state, testStr.size() };
+
 		for ( auto _ : state )
 		{
 			uint32_t hash = nfx::core::hashing::hashStringView<nfx::core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS>( testStr );
@@ -452,6 +639,8 @@ namespace nfx::core::benchmark
 		const std::string testStr = "performance_test_string_for_comparison";
 		std::hash<std::string> hasher;
 
+		const PerfCounterScope perf{ state, testStr.size() };
+
 		for ( auto _ : state )
 		{
 			size_t hash = hasher( testStr );
@@ -475,6 +664,8 @@ namespace nfx::core::benchmark
 			}
 		}
 
+		const PerfCounterScope perf{ state, totalBytes( repeatedStrings ) };
+
 		for ( auto _ : state )
 		{
 			uint32_t totalHash = 0;
@@ -498,6 +689,8 @@ namespace nfx::core::benchmark
 			sequentialStrings.push_back( "string_" + std::to_string( i ) );
 		}
 
+		const PerfCounterScope perf{ state, totalBytes( sequentialStrings ) };
+
 		for ( auto _ : state )
 		{
 			uint32_t totalHash = 0;
@@ -513,6 +706,8 @@ namespace nfx::core::benchmark
 	{
 		auto randomStrings = generateTestStrings( 1000, 8, 32 );
 
+		const PerfCounterScope perf{ state, totalBytes( randomStrings ) };
+
 		for ( auto _ : state )
 		{
 			uint32_t totalHash = 0;
@@ -541,6 +736,29 @@ BENCHMARK( nfx::core::benchmark::BM_Larson_SingleStep )
 	->Repetitions( 3 );
 BENCHMARK( nfx::core::benchmark::BM_SeedMix_Function )
 	->Repetitions( 3 );
+BENCHMARK( nfx::core::benchmark::BM_SeedMix64_Function )
+	->Repetitions( 3 );
+
+//----------------------------------------------
+// Range reduction
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_Reduce_Mask )
+	->Arg( 1000 )
+	->Arg( 1000003 )
+	->Repetitions( 3 );
+BENCHMARK( nfx::core::benchmark::BM_Reduce_Modulo )
+	->Arg( 1000 )
+	->Arg( 1000003 )
+	->Repetitions( 3 );
+BENCHMARK( nfx::core::benchmark::BM_Reduce_FastRange )
+	->Arg( 1000 )
+	->Arg( 1000003 )
+	->Repetitions( 3 );
+BENCHMARK( nfx::core::benchmark::BM_Reduce_FastMod )
+	->Arg( 1000 )
+	->Arg( 1000003 )
+	->Repetitions( 3 );
 
 //----------------------------------------------
 // String hashing comparisons
@@ -0,0 +1,385 @@
+/**
+ * @file BM_HashingThreads.cpp
+ * @brief Multi-threaded scaling benchmarks for hashing workloads
+ * @details Runs string, integer and bulk hashing paths on 1..N threads. Every thread
+ *          allocates and first-touches its own key set (NUMA-local under the default
+ *          first-touch policy) and also reads one shared read-only key set. Reports
+ *          aggregate throughput, per-thread throughput and scaling efficiency relative
+ *          to a single-thread measurement of the same body.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nfx/core/ConsistentHashing.h>
+#include <nfx/core/CountMinSketch.h>
+#include <nfx/core/CPU.h>
+#include <nfx/core/Hashing.h>
+#include <nfx/core/HyperLogLog.h>
+
+#include "PerfCounters.h"
+
+namespace nfx::core::benchmark
+{
+	//=====================================================================
+	// Multi-threaded hashing benchmark suite
+	//=====================================================================
+
+	/** @brief Keys per set; 4096 strings of ~24 bytes stay within a per-core L2. */
+	static constexpr size_t THREADS_KEY_COUNT{ 4096 };
+
+	//=====================================================================
+	// Test data generation
+	//=====================================================================
+
+	static std::vector<std::string> makeStringKeys( size_t seed )
+	{
+		std::vector<std::string> keys;
+		keys.reserve( THREADS_KEY_COUNT );
+		for ( size_t i = 0; i < THREADS_KEY_COUNT; ++i )
+		{
+			keys.push_back( "session:" + std::to_string( seed ) + ":" + std::to_string( i * 2654435761u ) );
+		}
+
+		return keys;
+	}
+
+	static std::vector<uint64_t> makeIntegerKeys( size_t seed )
+	{
+		std::vector<uint64_t> keys( THREADS_KEY_COUNT );
+		for ( size_t i = 0; i < keys.size(); ++i )
+		{
+			keys[i] = ( seed << 32 ) + i * 7919;
+		}
+
+		return keys;
+	}
+
+	/** @brief Read-only key sets shared by all threads (built once, before timing). */
+	static const std::vector<std::string>& sharedStringKeys()
+	{
+		static const std::vector<std::string> s_keys = makeStringKeys( 0 );
+		return s_keys;
+	}
+
+	static const std::vector<uint64_t>& sharedIntegerKeys()
+	{
+		static const std::vector<uint64_t> s_keys = makeIntegerKeys( 0 );
+		return s_keys;
+	}
+
+	//=====================================================================
+	// Scaling report
+	//=====================================================================
+
+	/** @brief Single-thread throughput of one benchmark body, measured once per process. */
+	struct ScalingBaseline
+	{
+		std::once_flag measured;
+		double rate{ 0.0 };
+	};
+
+	/**
+	 * @brief Measures the single-thread rate of `body` the first time any run of the benchmark starts.
+	 * @details Runs before the start barrier, inside std::call_once, so the other threads of the
+	 *          run wait and the measurement does not depend on which thread counts the
+	 *          `--benchmark_filter` selected or on the order they ran in.
+	 */
+	template <typename Body>
+	static double singleThreadRate( ScalingBaseline& baseline, size_t itemsPerIteration, Body& body )
+	{
+		std::call_once( baseline.measured, [&]() {
+			body(); // Warm caches and branch predictors
+
+			size_t iterations = 0;
+			const auto start = std::chrono::steady_clock::now();
+			std::chrono::duration<double> elapsed{ 0.0 };
+			do
+			{
+				body();
+				++iterations;
+				elapsed = std::chrono::steady_clock::now() - start;
+			} while ( elapsed.count() < 0.05 );
+
+			baseline.rate = static_cast<double>( iterations * itemsPerIteration ) / elapsed.count();
+		} );
+
+		return baseline.rate;
+	}
+
+	/**
+	 * @brief Publishes aggregate and per-thread throughput plus scaling efficiency.
+	 * @param[in] state Benchmark state of the calling thread
+	 * @param[in] items Items processed by the calling thread
+	 * @param[in] seconds Wall time of the calling thread's timed loop
+	 * @param[in] baselineRate Single-thread rate of the same body
+	 * @details Efficiency is per-thread throughput divided by single-thread throughput:
+	 *          1.0 is linear scaling; lower values show contention, shared-cache or
+	 *          memory-bandwidth limits.
+	 */
+	static void reportScaling( ::benchmark::State& state, size_t items, double seconds, double baselineRate )
+	{
+		const double rate = seconds > 0.0 ? static_cast<double>( items ) / seconds : 0.0;
+
+		state.SetItemsProcessed( static_cast<int64_t>( items ) );
+		state.counters["per_thread_rate"] = ::benchmark::Counter( rate, ::benchmark::Counter::kAvgThreads );
+		state.counters["efficiency"] = ::benchmark::Counter( baselineRate > 0.0 ? rate / baselineRate : 0.0, ::benchmark::Counter::kAvgThreads );
+	}
+
+	/** @brief Runs `body` once per benchmark iteration and reports scaling. */
+	template <typename Body>
+	static void runScaling( ::benchmark::State& state, size_t itemsPerIteration, ScalingBaseline& baseline, Body&& body )
+	{
+		const double baselineRate = singleThreadRate( baseline, itemsPerIteration, body );
+
+		// Clock from the first to the end of the last iteration: excludes the start and stop
+		// barriers and the skew between threads reaching them
+		std::chrono::steady_clock::time_point start;
+		std::chrono::steady_clock::time_point end;
+		bool first = true;
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			if ( first )
+			{
+				start = std::chrono::steady_clock::now();
+				first = false;
+			}
+			body();
+			end = std::chrono::steady_clock::now();
+		}
+		const std::chrono::duration<double> elapsed = end - start;
+
+		reportScaling( state, static_cast<size_t>( state.iterations() ) * itemsPerIteration, elapsed.count(), baselineRate );
+	}
+
+	//=====================================================================
+	// String hashing
+	//=====================================================================
+
+	static void BM_Threads_HashStringView_Local( ::benchmark::State& state )
+	{
+		static ScalingBaseline s_baseline;
+
+		// Allocated and first-touched by this thread
+		const auto keys = makeStringKeys( static_cast<size_t>( state.thread_index() ) + 1 );
+
+		runScaling( state, keys.size(), s_baseline, [&]() {
+			uint32_t total{ 0 };
+			for ( const auto& key : keys )
+			{
+				total += nfx::core::hashing::hashStringView( key );
+			}
+			::benchmark::DoNotOptimize( total );
+		} );
+	}
+
+	static void BM_Threads_HashStringView_Shared( ::benchmark::State& state )
+	{
+		static ScalingBaseline s_baseline;
+		const auto& keys = sharedStringKeys();
+
+		runScaling( state, keys.size(), s_baseline, [&]() {
+			uint32_t total{ 0 };
+			for ( const auto& key : keys )
+			{
+				total += nfx::core::hashing::hashStringView( key );
+			}
+			::benchmark::DoNotOptimize( total );
+		} );
+	}
+
+	//=====================================================================
+	// Integer hashing
+	//=====================================================================
+
+	static void BM_Threads_HashInteger_Local( ::benchmark::State& state )
+	{
+		static ScalingBaseline s_baseline;
+		const auto keys = makeIntegerKeys( static_cast<size_t>( state.thread_index() ) + 1 );
+
+		runScaling( state, keys.size(), s_baseline, [&]() {
+			size_t total{ 0 };
+			for ( const uint64_t key : keys )
+			{
+				total += nfx::core::hashing::hashInteger( key );
+			}
+			::benchmark::DoNotOptimize( total );
+		} );
+	}
+
+	static void BM_Threads_HashInteger_Shared( ::benchmark::State& state )
+	{
+		static ScalingBaseline s_baseline;
+		const auto& keys = sharedIntegerKeys();
+
+		runScaling( state, keys.size(), s_baseline, [&]() {
+			size_t total{ 0 };
+			for ( const uint64_t key : keys )
+			{
+				total += nfx::core::hashing::hashInteger( key );
+			}
+			::benchmark::DoNotOptimize( total );
+		} );
+	}
+
+	//=====================================================================
+	// Bulk paths
+	//=====================================================================
+
+	static void BM_Threads_JumpConsistentHash_Batch( ::benchmark::State& state )
+	{
+		static ScalingBaseline s_baseline;
+		const auto& keys = sharedIntegerKeys();
+		std::vector<uint32_t> shards( keys.size() );
+
+		runScaling( state, keys.size(), s_baseline, [&]() {
+			nfx::core::hashing::jumpConsistentHash( keys, 1000, shards );
+			::benchmark::ClobberMemory();
+		} );
+	}
+
+	static void BM_Threads_CountMinSketch_Batch( ::benchmark::State& state )
+	{
+		// One sketch per thread, as recommended for concurrent counting
+		static ScalingBaseline s_baseline;
+		const auto& keys = sharedIntegerKeys();
+		nfx::core::sketch::CountMinSketch<> sketch{ 1 << 14 };
+
+		runScaling( state, keys.size(), s_baseline, [&]() {
+			sketch.add( keys );
+			::benchmark::ClobberMemory();
+		} );
+	}
+
+	static void BM_Threads_HyperLogLog_Batch( ::benchmark::State& state )
+	{
+		static ScalingBaseline s_baseline;
+		const auto keys = makeIntegerKeys( static_cast<size_t>( state.thread_index() ) + 1 );
+		nfx::core::sketch::HyperLogLog<> sketch;
+
+		runScaling( state, keys.size(), s_baseline, [&]() {
+			sketch.add( keys );
+			::benchmark::ClobberMemory();
+		} );
+	}
+
+	//=====================================================================
+	// Shared state probes
+	//=====================================================================
+
+	static void BM_Threads_CpuFeatureQuery( ::benchmark::State& state )
+	{
+		// Shared features() snapshot in CPU.inl, read from every thread on every call
+		static ScalingBaseline s_baseline;
+
+		runScaling( state, 1024, s_baseline, [&]() {
+			int supported{ 0 };
+			for ( int i = 0; i < 1024; ++i )
+			{
+				supported += nfx::core::cpu::hasSSE42Support() ? 1 : 0;
+				::benchmark::DoNotOptimize( supported );
+			}
+		} );
+	}
+
+	/** @brief Per-thread result slot sharing cache lines with its neighbours. */
+	struct AdjacentSlot
+	{
+		uint64_t value;
+	};
+
+	/** @brief Per-thread result slot on its own cache line. */
+	struct alignas( 64 ) PaddedSlot
+	{
+		uint64_t value;
+	};
+
+	template <typename Slot>
+	static void runResultSlots( ::benchmark::State& state, ScalingBaseline& baseline )
+	{
+		static Slot s_slots[256];
+		const auto& keys = sharedIntegerKeys();
+		Slot& slot = s_slots[static_cast<size_t>( state.thread_index() ) % 256];
+
+		runScaling( state, keys.size(), baseline, [&]() {
+			for ( const uint64_t key : keys )
+			{
+				// Store every result, as a naive per-thread accumulator would
+				slot.value += nfx::core::hashing::hashInteger( key );
+				::benchmark::ClobberMemory();
+			}
+		} );
+	}
+
+	static void BM_Threads_ResultSlots_Adjacent( ::benchmark::State& state )
+	{
+		static ScalingBaseline s_baseline;
+		runResultSlots<AdjacentSlot>( state, s_baseline );
+	}
+
+	static void BM_Threads_ResultSlots_Padded( ::benchmark::State& state )
+	{
+		static ScalingBaseline s_baseline;
+		runResultSlots<PaddedSlot>( state, s_baseline );
+	}
+
+	//=====================================================================
+	// Thread range
+	//=====================================================================
+
+	static void threadRange( ::benchmark::internal::Benchmark* benchmark )
+	{
+		const int maxThreads = static_cast<int>( std::max( 1u, std::thread::hardware_concurrency() ) );
+		benchmark->ThreadRange( 1, maxThreads )->UseRealTime();
+	}
+} // namespace nfx::core::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// String and integer hashing
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_Threads_HashStringView_Local )
+	->Apply( nfx::core::benchmark::threadRange );
+BENCHMARK( nfx::core::benchmark::BM_Threads_HashStringView_Shared )
+	->Apply( nfx::core::benchmark::threadRange );
+BENCHMARK( nfx::core::benchmark::BM_Threads_HashInteger_Local )
+	->Apply( nfx::core::benchmark::threadRange );
+BENCHMARK( nfx::core::benchmark::BM_Threads_HashInteger_Shared )
+	->Apply( nfx::core::benchmark::threadRange );
+
+//----------------------------------------------
+// Bulk paths
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_Threads_JumpConsistentHash_Batch )
+	->Apply( nfx::core::benchmark::threadRange );
+BENCHMARK( nfx::core::benchmark::BM_Threads_CountMinSketch_Batch )
+	->Apply( nfx::core::benchmark::threadRange );
+BENCHMARK( nfx::core::benchmark::BM_Threads_HyperLogLog_Batch )
+	->Apply( nfx::core::benchmark::threadRange );
+
+//----------------------------------------------
+// Shared state probes
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_Threads_CpuFeatureQuery )
+	->Apply( nfx::core::benchmark::threadRange );
+BENCHMARK( nfx::core::benchmark::BM_Threads_ResultSlots_Adjacent )
+	->Apply( nfx::core::benchmark::threadRange );
+BENCHMARK( nfx::core::benchmark::BM_Threads_ResultSlots_Padded )
+	->Apply( nfx::core::benchmark::threadRange );
+
+BENCHMARK_MAIN();
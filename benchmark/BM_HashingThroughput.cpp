@@ -0,0 +1,139 @@
+/**
+ * @file BM_HashingThroughput.cpp
+ * @brief Throughput-by-size sweep for the string hashes
+ * @details Hashes one buffer from 1 byte to 1 MiB in powers of two, from an aligned and an
+ *          unaligned start, and reports bytes and items per second for each algorithm.
+ *          Supports baseline regression reporting (see BaselineComparison.h).
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include <nfx/core/Hashing.h>
+
+#include "BaselineComparison.h"
+#include "PerfCounters.h"
+
+namespace nfx::core::benchmark
+{
+	//=====================================================================
+	// Hashing throughput benchmark suite
+	//=====================================================================
+
+	/** @brief Largest swept input size. */
+	static constexpr size_t THROUGHPUT_MAX_BYTES{ 1 << 20 };
+
+	//=====================================================================
+	// Test data generation
+	//=====================================================================
+
+	/** @brief Random printable bytes, 64-byte aligned, with slack for the unaligned offsets. */
+	static const char* sweepBuffer()
+	{
+		static const std::vector<char> s_buffer = []() {
+			std::vector<char> buffer( THROUGHPUT_MAX_BYTES + 128 );
+			std::mt19937 gen( 42 );
+			std::uniform_int_distribution<int> dist( 32, 126 );
+			for ( auto& ch : buffer )
+			{
+				ch = static_cast<char>( dist( gen ) );
+			}
+			return buffer;
+		}();
+
+		// Round up to the next 64-byte boundary so offset 0 is cache-line aligned
+		const auto address = reinterpret_cast<uintptr_t>( s_buffer.data() );
+		return s_buffer.data() + ( ( 64 - ( address & 63 ) ) & 63 );
+	}
+
+	/** @brief Registers (bytes, offset) pairs: 1 B .. 1 MiB, aligned and misaligned by one byte. */
+	static void sweepArguments( ::benchmark::internal::Benchmark* benchmark )
+	{
+		benchmark->ArgNames( { "bytes", "offset" } );
+		for ( const int64_t offset : { 0, 1 } )
+		{
+			for ( int64_t bytes = 1; bytes <= static_cast<int64_t>( THROUGHPUT_MAX_BYTES ); bytes *= 2 )
+			{
+				benchmark->Args( { bytes, offset } );
+			}
+		}
+	}
+
+	//=====================================================================
+	// Throughput benchmarks
+	//=====================================================================
+
+	template <typename Hash>
+	static void runSweep( ::benchmark::State& state, Hash hash )
+	{
+		const std::string_view input{ sweepBuffer() + state.range( 1 ), static_cast<size_t>( state.range( 0 ) ) };
+
+		const PerfCounterScope perf{ state, input.size() };
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( input.data() );
+			auto result = hash( input );
+			::benchmark::DoNotOptimize( result );
+		}
+
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * input.size() ) );
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() ) );
+	}
+
+	static void BM_Throughput_HashStringView( ::benchmark::State& state )
+	{
+		runSweep( state, []( std::string_view key ) { return nfx::core::hashing::hashStringView( key ); } );
+	}
+
+	static void BM_Throughput_FNV1a( ::benchmark::State& state )
+	{
+		runSweep( state, []( std::string_view key ) {
+			uint32_t hash{ nfx::core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS };
+			for ( const char ch : key )
+			{
+				hash = nfx::core::hashing::fnv1a( hash, static_cast<uint8_t>( ch ) );
+			}
+			return hash;
+		} );
+	}
+
+	static void BM_Throughput_Larson( ::benchmark::State& state )
+	{
+		runSweep( state, []( std::string_view key ) {
+			uint32_t hash{ 0 };
+			for ( const char ch : key )
+			{
+				hash = nfx::core::hashing::Larson( hash, static_cast<uint8_t>( ch ) );
+			}
+			return hash;
+		} );
+	}
+
+	static void BM_Throughput_StdHash( ::benchmark::State& state )
+	{
+		runSweep( state, []( std::string_view key ) { return std::hash<std::string_view>{}( key ); } );
+	}
+} // namespace nfx::core::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+BENCHMARK( nfx::core::benchmark::BM_Throughput_HashStringView )
+	->Apply( nfx::core::benchmark::sweepArguments );
+BENCHMARK( nfx::core::benchmark::BM_Throughput_FNV1a )
+	->Apply( nfx::core::benchmark::sweepArguments );
+BENCHMARK( nfx::core::benchmark::BM_Throughput_Larson )
+	->Apply( nfx::core::benchmark::sweepArguments );
+BENCHMARK( nfx::core::benchmark::BM_Throughput_StdHash )
+	->Apply( nfx::core::benchmark::sweepArguments );
+
+int main( int argc, char** argv )
+{
+	return nfx::core::benchmark::runBenchmarksWithBaseline( argc, argv );
+}
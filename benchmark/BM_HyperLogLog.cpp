@@ -0,0 +1,196 @@
+/**
+ * @file BM_HyperLogLog.cpp
+ * @brief Benchmark HyperLogLog cardinality sketch operations
+ * @details Benchmarks for single and batch insertion throughput, register merge
+ *          throughput, estimation cost and estimate error versus exact counts
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <nfx/core/Hashing.h>
+#include <nfx/core/HyperLogLog.h>
+
+#include "PerfCounters.h"
+
+namespace nfx::core::benchmark
+{
+	//=====================================================================
+	// HyperLogLog benchmark suite
+	//=====================================================================
+
+	//=====================================================================
+	// Test data generation
+	//=====================================================================
+
+	static std::vector<uint64_t> generateHashes( uint64_t first, size_t count )
+	{
+		std::vector<uint64_t> hashes;
+		hashes.reserve( count );
+
+		for ( uint64_t i = first; i < first + count; ++i )
+		{
+			hashes.push_back( nfx::core::hashing::hashInteger( i ) );
+		}
+
+		return hashes;
+	}
+
+	static const auto testHashes = generateHashes( 0, 1 << 20 );
+
+	//=====================================================================
+	// Insertion benchmarks
+	//=====================================================================
+
+	static void BM_HyperLogLog_AddSingle( ::benchmark::State& state )
+	{
+		nfx::core::sketch::HyperLogLog<> hll;
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			for ( const uint64_t hash : testHashes )
+			{
+				hll.add( hash );
+			}
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * testHashes.size() ) );
+	}
+
+	static void BM_HyperLogLog_AddBatch( ::benchmark::State& state )
+	{
+		nfx::core::sketch::HyperLogLog<> hll;
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			hll.add( testHashes );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * testHashes.size() ) );
+	}
+
+	static void BM_HyperLogLog_AddSparse( ::benchmark::State& state )
+	{
+		// Small sets stay in the sparse representation
+		const auto hashes = generateHashes( 0, 2000 );
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			nfx::core::sketch::HyperLogLog<> hll;
+			hll.add( hashes );
+			::benchmark::DoNotOptimize( hll );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * hashes.size() ) );
+	}
+
+	//=====================================================================
+	// Merge benchmarks
+	//=====================================================================
+
+	template <uint8_t Precision>
+	static void BM_HyperLogLog_MergeDense( ::benchmark::State& state )
+	{
+		nfx::core::sketch::HyperLogLog<Precision> a;
+		nfx::core::sketch::HyperLogLog<Precision> b;
+		a.add( generateHashes( 0, 1 << 20 ) );
+		b.add( generateHashes( 1 << 19, 1 << 20 ) );
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			a.merge( b );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * nfx::core::sketch::HyperLogLog<Precision>::REGISTER_COUNT ) );
+	}
+
+	//=====================================================================
+	// Estimation benchmarks
+	//=====================================================================
+
+	static void BM_HyperLogLog_Estimate( ::benchmark::State& state )
+	{
+		nfx::core::sketch::HyperLogLog<> hll;
+		hll.add( testHashes );
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			double estimate = hll.estimate();
+			::benchmark::DoNotOptimize( estimate );
+		}
+	}
+
+	static void BM_HyperLogLog_EstimateError( ::benchmark::State& state )
+	{
+		// Reports the mean relative error over several disjoint key sets of the given cardinality
+		const auto cardinality = static_cast<size_t>( state.range( 0 ) );
+		constexpr int trials = 8;
+
+		double totalError = 0.0;
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			totalError = 0.0;
+			for ( int trial = 0; trial < trials; ++trial )
+			{
+				nfx::core::sketch::HyperLogLog<> hll;
+				hll.add( generateHashes( static_cast<uint64_t>( trial ) << 40, cardinality ) );
+				totalError += std::abs( hll.estimate() - static_cast<double>( cardinality ) ) / static_cast<double>( cardinality );
+			}
+		}
+
+		state.counters["relative_error"] = totalError / trials;
+	}
+} // namespace nfx::core::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// Insertion
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_HyperLogLog_AddSingle )
+	->Repetitions( 3 );
+BENCHMARK( nfx::core::benchmark::BM_HyperLogLog_AddBatch )
+	->Repetitions( 3 );
+BENCHMARK( nfx::core::benchmark::BM_HyperLogLog_AddSparse )
+	->Repetitions( 3 );
+
+//----------------------------------------------
+// Merge
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_HyperLogLog_MergeDense<12> )
+	->Repetitions( 3 );
+BENCHMARK( nfx::core::benchmark::BM_HyperLogLog_MergeDense<14> )
+	->Repetitions( 3 );
+BENCHMARK( nfx::core::benchmark::BM_HyperLogLog_MergeDense<18> )
+	->Repetitions( 3 );
+
+//----------------------------------------------
+// Estimation
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_HyperLogLog_Estimate )
+	->Repetitions( 3 );
+BENCHMARK( nfx::core::benchmark::BM_HyperLogLog_EstimateError )
+	->Arg( 100 )
+	->Arg( 10000 )
+	->Arg( 1000000 )
+	->Iterations( 1 )
+	->Unit( ::benchmark::kMillisecond );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,191 @@
+/**
+ * @file BM_KeyEquality.cpp
+ * @brief Benchmark short-key equality against memcmp and string_view comparison
+ * @details Compares equal 1-64 byte keys with memcmp, std::string_view::operator== and
+ *          bytesEqual(), once per fixed length and over a mix of lengths (as a hash table
+ *          sees them, where the branch predictor cannot learn one length). Also measures the
+ *          fused hash-then-bytes check on hash mismatches.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/core/Hashing.h>
+#include <nfx/core/KeyEquality.h>
+
+#include "PerfCounters.h"
+
+namespace nfx::core::benchmark
+{
+	//=====================================================================
+	// Key equality benchmark suite
+	//=====================================================================
+
+	/** @brief Key pairs per iteration. */
+	static constexpr size_t EQUALITY_PAIR_COUNT{ 1024 };
+
+	//=====================================================================
+	// Test data generation
+	//=====================================================================
+
+	/** @brief Equal key pairs in separate allocations; `length` 0 picks 1-64 bytes at random. */
+	struct KeyPairs
+	{
+		std::vector<std::string> left;
+		std::vector<std::string> right;
+		std::vector<uint32_t> leftHashes;
+		size_t bytes{ 0 };
+
+		explicit KeyPairs( size_t length )
+		{
+			std::mt19937 gen( 42 );
+			std::uniform_int_distribution<size_t> lengths( 1, 64 );
+			std::uniform_int_distribution<int> chars( 32, 126 );
+			for ( size_t i = 0; i < EQUALITY_PAIR_COUNT; ++i )
+			{
+				std::string key( length > 0 ? length : lengths( gen ), ' ' );
+				for ( auto& ch : key )
+				{
+					ch = static_cast<char>( chars( gen ) );
+				}
+				left.push_back( key );
+				right.push_back( key );
+				leftHashes.push_back( nfx::core::hashing::hashStringView( key ) );
+				bytes += key.size();
+			}
+		}
+	};
+
+	//=====================================================================
+	// Equality benchmarks
+	//=====================================================================
+
+	template <typename Equal>
+	static void runEquality( ::benchmark::State& state, Equal equal )
+	{
+		const KeyPairs pairs{ static_cast<size_t>( state.range( 0 ) ) };
+
+		const PerfCounterScope perf{ state, pairs.bytes };
+		for ( auto _ : state )
+		{
+			size_t matches{ 0 };
+			for ( size_t i = 0; i < EQUALITY_PAIR_COUNT; ++i )
+			{
+				matches += equal( std::string_view{ pairs.left[i] }, std::string_view{ pairs.right[i] } ) ? 1 : 0;
+			}
+			::benchmark::DoNotOptimize( matches );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * EQUALITY_PAIR_COUNT ) );
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * pairs.bytes ) );
+	}
+
+	static void BM_Equal_Memcmp( ::benchmark::State& state )
+	{
+		runEquality( state, []( std::string_view a, std::string_view b ) {
+			return a.size() == b.size() && std::memcmp( a.data(), b.data(), a.size() ) == 0;
+		} );
+	}
+
+	static void BM_Equal_StringView( ::benchmark::State& state )
+	{
+		runEquality( state, []( std::string_view a, std::string_view b ) { return a == b; } );
+	}
+
+	static void BM_Equal_KeysEqual( ::benchmark::State& state )
+	{
+		runEquality( state, []( std::string_view a, std::string_view b ) { return nfx::core::hashing::keysEqual( a, b ); } );
+	}
+
+	//=====================================================================
+	// Fused hash check
+	//=====================================================================
+
+	static void BM_Equal_HashMismatch_StringView( ::benchmark::State& state )
+	{
+		// Each probe meets the stored key of its neighbour: a slot of another key
+		const KeyPairs pairs{ static_cast<size_t>( state.range( 0 ) ) };
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			size_t matches{ 0 };
+			for ( size_t i = 0; i < EQUALITY_PAIR_COUNT; ++i )
+			{
+				matches += std::string_view{ pairs.left[i] } == std::string_view{ pairs.right[( i + 1 ) % EQUALITY_PAIR_COUNT] } ? 1 : 0;
+			}
+			::benchmark::DoNotOptimize( matches );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * EQUALITY_PAIR_COUNT ) );
+	}
+
+	static void BM_Equal_HashMismatch_HashedKeysEqual( ::benchmark::State& state )
+	{
+		const KeyPairs pairs{ static_cast<size_t>( state.range( 0 ) ) };
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			size_t matches{ 0 };
+			for ( size_t i = 0; i < EQUALITY_PAIR_COUNT; ++i )
+			{
+				const size_t j = ( i + 1 ) % EQUALITY_PAIR_COUNT;
+				matches += nfx::core::hashing::hashedKeysEqual( pairs.leftHashes[i], pairs.left[i], pairs.leftHashes[j], pairs.right[j] ) ? 1 : 0;
+			}
+			::benchmark::DoNotOptimize( matches );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * EQUALITY_PAIR_COUNT ) );
+	}
+
+	//=====================================================================
+	// Key lengths
+	//=====================================================================
+
+	/** @brief Fixed lengths around every path boundary, then 0 for the random 1-64 byte mix. */
+	static void keyLengths( ::benchmark::internal::Benchmark* benchmark )
+	{
+		benchmark->ArgName( "length" );
+		for ( const int64_t length : { 1, 3, 4, 7, 8, 12, 16, 17, 24, 32, 33, 48, 64, 0 } )
+		{
+			benchmark->Arg( length );
+		}
+	}
+} // namespace nfx::core::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// Equal keys by length (0 = mixed 1-64)
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_Equal_Memcmp )
+	->Apply( nfx::core::benchmark::keyLengths );
+BENCHMARK( nfx::core::benchmark::BM_Equal_StringView )
+	->Apply( nfx::core::benchmark::keyLengths );
+BENCHMARK( nfx::core::benchmark::BM_Equal_KeysEqual )
+	->Apply( nfx::core::benchmark::keyLengths );
+
+//----------------------------------------------
+// Hash mismatch: 16-byte and mixed lengths
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_Equal_HashMismatch_StringView )
+	->ArgName( "length" )
+	->Arg( 16 )
+	->Arg( 0 );
+BENCHMARK( nfx::core::benchmark::BM_Equal_HashMismatch_HashedKeysEqual )
+	->ArgName( "length" )
+	->Arg( 16 )
+	->Arg( 0 );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,237 @@
+/**
+ * @file BM_ObjectHashing.cpp
+ * @brief Benchmark hashing packed binary keys with hashObject() against field-by-field combine()
+ * @details Hashes batches of 4, 8, 12, 16 and 32 byte keys (ids, network tuples and
+ *          fixed-size records) four ways: hashObject(), hashBytes() over the object's
+ *          bytes, the per-byte hashStringView() loop behind a `reinterpret_cast`, and
+ *          hashInteger() on every field folded with combine(). Reports keys per second.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <nfx/core/Hashing.h>
+
+#include "PerfCounters.h"
+
+namespace nfx::core::benchmark
+{
+	//=====================================================================
+	// Object hashing benchmark suite
+	//=====================================================================
+
+	/** @brief Keys hashed per iteration. */
+	static constexpr size_t OBJECT_KEY_COUNT{ 4096 };
+
+	//----------------------------------------------
+	// Key types
+	//----------------------------------------------
+
+	/** @brief 4 bytes: a dense id. */
+	struct Key4
+	{
+		uint32_t id;
+	};
+
+	/** @brief 8 bytes: a (tenant, row) pair. */
+	struct Key8
+	{
+		uint32_t tenant;
+		uint32_t row;
+	};
+
+	/** @brief 12 bytes: an IPv4 flow tuple. */
+	struct Key12
+	{
+		uint32_t source;
+		uint32_t destination;
+		uint16_t sourcePort;
+		uint16_t destinationPort;
+	};
+
+	/** @brief 16 bytes: a 128-bit identifier. */
+	struct Key16
+	{
+		uint64_t high;
+		uint64_t low;
+	};
+
+	/** @brief 32 bytes: a versioned, sharded, timestamped record key. */
+	struct Key32
+	{
+		uint64_t high;
+		uint64_t low;
+		uint32_t version;
+		uint32_t shard;
+		uint64_t timestamp;
+	};
+
+	//=====================================================================
+	// Field-by-field baseline
+	//=====================================================================
+
+	/** @brief Hashes every field with hashInteger() and folds the results with combine(). */
+	static uint32_t combineFields( uint32_t hash )
+	{
+		return hash;
+	}
+
+	template <typename Field, typename... Fields>
+	static uint32_t combineFields( uint32_t hash, Field field, Fields... fields )
+	{
+		const uint32_t fieldHash = static_cast<uint32_t>( nfx::core::hashing::hashInteger( field ) );
+		return combineFields( nfx::core::hashing::combine( hash, fieldHash, nfx::core::hashing::constants::DEFAULT_FNV_PRIME ), fields... );
+	}
+
+	static uint32_t hashFields( const Key4& key )
+	{
+		return combineFields( nfx::core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, key.id );
+	}
+
+	static uint32_t hashFields( const Key8& key )
+	{
+		return combineFields( nfx::core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, key.tenant, key.row );
+	}
+
+	static uint32_t hashFields( const Key12& key )
+	{
+		return combineFields( nfx::core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, key.source, key.destination, key.sourcePort, key.destinationPort );
+	}
+
+	static uint32_t hashFields( const Key16& key )
+	{
+		return combineFields( nfx::core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, key.high, key.low );
+	}
+
+	static uint32_t hashFields( const Key32& key )
+	{
+		return combineFields( nfx::core::hashing::constants::DEFAULT_FNV_OFFSET_BASIS, key.high, key.low, key.version, key.shard, key.timestamp );
+	}
+
+	//=====================================================================
+	// Test data generation
+	//=====================================================================
+
+	/** @brief OBJECT_KEY_COUNT keys with random bytes. */
+	template <typename Key>
+	static const std::vector<Key>& objectKeys()
+	{
+		static const std::vector<Key> s_keys = []() {
+			std::vector<Key> keys( OBJECT_KEY_COUNT );
+			std::mt19937 gen( static_cast<uint32_t>( sizeof( Key ) ) );
+			for ( auto& key : keys )
+			{
+				for ( auto& byte : std::as_writable_bytes( std::span{ &key, 1 } ) )
+				{
+					byte = static_cast<std::byte>( gen() );
+				}
+			}
+			return keys;
+		}();
+
+		return s_keys;
+	}
+
+	//=====================================================================
+	// Benchmark runner
+	//=====================================================================
+
+	template <typename Key, typename Hash>
+	static void runObjectHash( ::benchmark::State& state, Hash hash )
+	{
+		const auto& keys = objectKeys<Key>();
+
+		const PerfCounterScope perf{ state, keys.size() * sizeof( Key ) };
+		for ( auto _ : state )
+		{
+			uint32_t total = 0;
+			for ( const auto& key : keys )
+			{
+				total += hash( key );
+			}
+			::benchmark::DoNotOptimize( total );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * keys.size() ) );
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * keys.size() * sizeof( Key ) ) );
+	}
+
+	//=====================================================================
+	// Object hashing benchmarks
+	//=====================================================================
+
+	template <typename Key>
+	static void BM_HashObject( ::benchmark::State& state )
+	{
+		runObjectHash<Key>( state, []( const Key& key ) { return nfx::core::hashing::hashObject( key ); } );
+	}
+
+	template <typename Key>
+	static void BM_HashBytes( ::benchmark::State& state )
+	{
+		runObjectHash<Key>( state, []( const Key& key ) { return nfx::core::hashing::hashBytes( std::as_bytes( std::span{ &key, 1 } ) ); } );
+	}
+
+	template <typename Key>
+	static void BM_HashStringView_Cast( ::benchmark::State& state )
+	{
+		// Baseline: reinterpret the key as a string_view and run the per-byte loop
+		runObjectHash<Key>( state, []( const Key& key ) {
+			return nfx::core::hashing::hashStringView( std::string_view{ reinterpret_cast<const char*>( &key ), sizeof( Key ) } );
+		} );
+	}
+
+	template <typename Key>
+	static void BM_CombineFields( ::benchmark::State& state )
+	{
+		// Baseline: hashInteger() per field, folded with combine()
+		runObjectHash<Key>( state, []( const Key& key ) { return hashFields( key ); } );
+	}
+} // namespace nfx::core::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// hashObject
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_HashObject<nfx::core::benchmark::Key4> );
+BENCHMARK( nfx::core::benchmark::BM_HashObject<nfx::core::benchmark::Key8> );
+BENCHMARK( nfx::core::benchmark::BM_HashObject<nfx::core::benchmark::Key12> );
+BENCHMARK( nfx::core::benchmark::BM_HashObject<nfx::core::benchmark::Key16> );
+BENCHMARK( nfx::core::benchmark::BM_HashObject<nfx::core::benchmark::Key32> );
+
+//----------------------------------------------
+// hashBytes
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_HashBytes<nfx::core::benchmark::Key4> );
+BENCHMARK( nfx::core::benchmark::BM_HashBytes<nfx::core::benchmark::Key8> );
+BENCHMARK( nfx::core::benchmark::BM_HashBytes<nfx::core::benchmark::Key12> );
+BENCHMARK( nfx::core::benchmark::BM_HashBytes<nfx::core::benchmark::Key16> );
+BENCHMARK( nfx::core::benchmark::BM_HashBytes<nfx::core::benchmark::Key32> );
+
+//----------------------------------------------
+// Baselines
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_HashStringView_Cast<nfx::core::benchmark::Key4> );
+BENCHMARK( nfx::core::benchmark::BM_HashStringView_Cast<nfx::core::benchmark::Key8> );
+BENCHMARK( nfx::core::benchmark::BM_HashStringView_Cast<nfx::core::benchmark::Key12> );
+BENCHMARK( nfx::core::benchmark::BM_HashStringView_Cast<nfx::core::benchmark::Key16> );
+BENCHMARK( nfx::core::benchmark::BM_HashStringView_Cast<nfx::core::benchmark::Key32> );
+
+BENCHMARK( nfx::core::benchmark::BM_CombineFields<nfx::core::benchmark::Key4> );
+BENCHMARK( nfx::core::benchmark::BM_CombineFields<nfx::core::benchmark::Key8> );
+BENCHMARK( nfx::core::benchmark::BM_CombineFields<nfx::core::benchmark::Key12> );
+BENCHMARK( nfx::core::benchmark::BM_CombineFields<nfx::core::benchmark::Key16> );
+BENCHMARK( nfx::core::benchmark::BM_CombineFields<nfx::core::benchmark::Key32> );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,361 @@
+/**
+ * @file BM_StringInterner.cpp
+ * @brief Benchmark string interning against std::unordered_set<std::string>
+ * @details Interns a telemetry-like stream that repeats a few thousand distinct strings:
+ *          hit throughput (single- and multi-threaded), first-sight insertion throughput
+ *          and bytes held per unique string, each against an `std::unordered_set<std::string>`
+ *          used as the string pool.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include <nfx/core/StringInterner.h>
+
+#include "PerfCounters.h"
+
+namespace nfx::core::benchmark
+{
+	//=====================================================================
+	// String interner benchmark suite
+	//=====================================================================
+
+	/** @brief Distinct strings in the working set. */
+	static constexpr size_t INTERNER_UNIQUE_COUNT{ 4096 };
+
+	/** @brief References per iteration, drawn from the distinct strings. */
+	static constexpr size_t INTERNER_STREAM_LENGTH{ 1 << 16 };
+
+	//=====================================================================
+	// Test data generation
+	//=====================================================================
+
+	/** @brief Metric and config key names, 20-50 bytes each. */
+	static const std::vector<std::string>& uniqueKeys()
+	{
+		static const std::vector<std::string> s_keys = []() {
+			static constexpr const char* services[]{ "gateway", "auth", "billing", "search", "ingest", "scheduler", "storage", "render" };
+			static constexpr const char* metrics[]{ "requests.total", "requests.failed", "latency.p50_us", "latency.p99_us", "queue.depth", "cpu.user_pct", "memory.rss_bytes", "connections.open" };
+
+			std::vector<std::string> keys;
+			keys.reserve( INTERNER_UNIQUE_COUNT );
+			for ( size_t i = 0; keys.size() < INTERNER_UNIQUE_COUNT; ++i )
+			{
+				keys.push_back( std::string{ "svc." } + services[i % 8] + ".host" + std::to_string( i / 64 ) + "." + metrics[( i / 8 ) % 8] );
+			}
+			return keys;
+		}();
+
+		return s_keys;
+	}
+
+	/** @brief Skewed stream of references (a few keys are hot, most are warm). */
+	static const std::vector<std::string>& keyStream()
+	{
+		static const std::vector<std::string> s_stream = []() {
+			const auto& keys = uniqueKeys();
+			std::mt19937 gen( 42 );
+			std::geometric_distribution<size_t> dist( 0.002 );
+
+			std::vector<std::string> stream;
+			stream.reserve( INTERNER_STREAM_LENGTH );
+			for ( size_t i = 0; i < INTERNER_STREAM_LENGTH; ++i )
+			{
+				stream.push_back( keys[dist( gen ) % keys.size()] );
+			}
+			return stream;
+		}();
+
+		return s_stream;
+	}
+
+	//=====================================================================
+	// Allocation accounting
+	//=====================================================================
+
+	/** @brief Bytes currently allocated through CountingAllocator. */
+	static size_t s_countedBytes{ 0 };
+
+	/** @brief std::allocator that tracks live bytes, for the node-based baseline. */
+	template <typename T>
+	struct CountingAllocator
+	{
+		using value_type = T;
+
+		CountingAllocator() noexcept = default;
+
+		template <typename U>
+		CountingAllocator( const CountingAllocator<U>& ) noexcept
+		{
+		}
+
+		T* allocate( size_t count )
+		{
+			s_countedBytes += count * sizeof( T );
+			return std::allocator<T>{}.allocate( count );
+		}
+
+		void deallocate( T* pointer, size_t count ) noexcept
+		{
+			s_countedBytes -= count * sizeof( T );
+			std::allocator<T>{}.deallocate( pointer, count );
+		}
+
+		template <typename U>
+		bool operator==( const CountingAllocator<U>& ) const noexcept
+		{
+			return true;
+		}
+	};
+
+	using CountedString = std::basic_string<char, std::char_traits<char>, CountingAllocator<char>>;
+
+	struct CountedStringHash
+	{
+		size_t operator()( const CountedString& text ) const noexcept
+		{
+			return std::hash<std::string_view>{}( std::string_view{ text.data(), text.size() } );
+		}
+	};
+
+	//=====================================================================
+	// Hit throughput benchmarks
+	//=====================================================================
+
+	static void BM_Intern_Hit( ::benchmark::State& state )
+	{
+		const auto& stream = keyStream();
+		nfx::core::strings::StringInterner interner;
+		for ( const auto& key : uniqueKeys() )
+		{
+			interner.intern( key );
+		}
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			for ( const auto& key : stream )
+			{
+				auto handle = interner.intern( key );
+				::benchmark::DoNotOptimize( handle );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * stream.size() ) );
+	}
+
+	static void BM_UnorderedSet_Hit( ::benchmark::State& state )
+	{
+		const auto& stream = keyStream();
+		std::unordered_set<std::string> pool;
+		for ( const auto& key : uniqueKeys() )
+		{
+			pool.insert( key );
+		}
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			for ( const auto& key : stream )
+			{
+				const std::string* pooled = &*pool.insert( key ).first;
+				::benchmark::DoNotOptimize( pooled );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * stream.size() ) );
+	}
+
+	//=====================================================================
+	// Multi-threaded hit throughput
+	//=====================================================================
+
+	static void BM_Intern_Hit_Threads( ::benchmark::State& state )
+	{
+		// One interner shared by all threads; hits never take the lock
+		static nfx::core::strings::StringInterner s_interner;
+		static std::once_flag s_filled;
+		std::call_once( s_filled, []() {
+			for ( const auto& key : uniqueKeys() )
+			{
+				s_interner.intern( key );
+			}
+		} );
+
+		const auto& stream = keyStream();
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			for ( const auto& key : stream )
+			{
+				auto handle = s_interner.intern( key );
+				::benchmark::DoNotOptimize( handle );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * stream.size() ) );
+	}
+
+	static void BM_UnorderedSet_Hit_Threads( ::benchmark::State& state )
+	{
+		// Baseline: the same pool behind a mutex, the usual way to share one
+		static std::unordered_set<std::string> s_pool{ uniqueKeys().begin(), uniqueKeys().end() };
+		static std::mutex s_mutex;
+
+		const auto& stream = keyStream();
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			for ( const auto& key : stream )
+			{
+				const std::lock_guard lock{ s_mutex };
+				const std::string* pooled = &*s_pool.insert( key ).first;
+				::benchmark::DoNotOptimize( pooled );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * stream.size() ) );
+	}
+
+	//=====================================================================
+	// First-sight insertion benchmarks
+	//=====================================================================
+
+	static void BM_Intern_Miss( ::benchmark::State& state )
+	{
+		const auto& keys = uniqueKeys();
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			nfx::core::strings::StringInterner interner;
+			for ( const auto& key : keys )
+			{
+				auto handle = interner.intern( key );
+				::benchmark::DoNotOptimize( handle );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * keys.size() ) );
+	}
+
+	static void BM_UnorderedSet_Miss( ::benchmark::State& state )
+	{
+		const auto& keys = uniqueKeys();
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			std::unordered_set<std::string> pool;
+			for ( const auto& key : keys )
+			{
+				const std::string* pooled = &*pool.insert( key ).first;
+				::benchmark::DoNotOptimize( pooled );
+			}
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * keys.size() ) );
+	}
+
+	//=====================================================================
+	// Memory per unique string
+	//=====================================================================
+
+	static void BM_Memory_Interner( ::benchmark::State& state )
+	{
+		// Arg: initial table capacity; a presized table keeps no replaced tables
+		const auto& keys = uniqueKeys();
+		const size_t capacity = static_cast<size_t>( state.range( 0 ) );
+		size_t bytes = 0;
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			nfx::core::strings::StringInterner interner{ capacity };
+			for ( const auto& key : keys )
+			{
+				interner.intern( key );
+			}
+			bytes = interner.memoryUsage();
+		}
+
+		state.counters["bytes_per_string"] = static_cast<double>( bytes ) / static_cast<double>( keys.size() );
+	}
+
+	static void BM_Memory_UnorderedSet( ::benchmark::State& state )
+	{
+		// Counts nodes, bucket array and out-of-line string bytes (malloc headers excluded)
+		const auto& keys = uniqueKeys();
+		size_t bytes = 0;
+
+		const PerfCounterScope perf{ state };
+		for ( auto _ : state )
+		{
+			const size_t before = s_countedBytes;
+			{
+				std::unordered_set<CountedString, CountedStringHash, std::equal_to<CountedString>, CountingAllocator<CountedString>> pool;
+				for ( const auto& key : keys )
+				{
+					pool.emplace( key.data(), key.size() );
+				}
+				bytes = s_countedBytes - before;
+			}
+		}
+
+		state.counters["bytes_per_string"] = static_cast<double>( bytes ) / static_cast<double>( keys.size() );
+	}
+
+	//=====================================================================
+	// Thread range
+	//=====================================================================
+
+	static void threadRange( ::benchmark::internal::Benchmark* benchmark )
+	{
+		const int maxThreads = static_cast<int>( std::max( 1u, std::thread::hardware_concurrency() ) );
+		benchmark->ThreadRange( 1, maxThreads )->UseRealTime();
+	}
+} // namespace nfx::core::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// Hit throughput
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_Intern_Hit );
+BENCHMARK( nfx::core::benchmark::BM_UnorderedSet_Hit );
+BENCHMARK( nfx::core::benchmark::BM_Intern_Hit_Threads )
+	->Apply( nfx::core::benchmark::threadRange );
+BENCHMARK( nfx::core::benchmark::BM_UnorderedSet_Hit_Threads )
+	->Apply( nfx::core::benchmark::threadRange );
+
+//----------------------------------------------
+// First-sight insertion
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_Intern_Miss );
+BENCHMARK( nfx::core::benchmark::BM_UnorderedSet_Miss );
+
+//----------------------------------------------
+// Memory per unique string
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_Memory_Interner )
+	->Arg( nfx::core::strings::constants::INTERNER_DEFAULT_CAPACITY )
+	->Arg( 2 * nfx::core::benchmark::INTERNER_UNIQUE_COUNT + 2 )
+	->Iterations( 1 );
+BENCHMARK( nfx::core::benchmark::BM_Memory_UnorderedSet )
+	->Iterations( 1 );
+
+BENCHMARK_MAIN();
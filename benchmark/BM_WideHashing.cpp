@@ -0,0 +1,289 @@
+/**
+ * @file BM_WideHashing.cpp
+ * @brief Benchmark hashing UTF-16 and UTF-32 keys against transcode-then-hash
+ * @details Hashes batches of UTF-16 and UTF-32 keys of 8 to 1024 code units, either pure
+ *          ASCII or mixed scripts, four ways: the raw-bytes overloads of hashStringView(),
+ *          the same bytes through the per-byte string_view loop, hashStringViewAsUtf8(),
+ *          and transcoding each key into a fresh UTF-8 std::string before hashing it.
+ *          Reports keys and code-unit bytes per second.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/core/Hashing.h>
+
+#include "PerfCounters.h"
+
+namespace nfx::core::benchmark
+{
+	//=====================================================================
+	// Wide string hashing benchmark suite
+	//=====================================================================
+
+	/** @brief Keys hashed per iteration. */
+	static constexpr size_t WIDE_KEY_COUNT{ 256 };
+
+	/** @brief Key content (benchmark argument). */
+	enum class Content : int64_t
+	{
+		Ascii = 0, ///< Identifiers and paths, every code unit below U+0080
+		Mixed	   ///< About one non-ASCII code point in four: Latin-1, CJK and emoji
+	};
+
+	//=====================================================================
+	// Test data generation
+	//=====================================================================
+
+	/** @brief WIDE_KEY_COUNT random keys of `length` code points. */
+	static std::vector<std::u32string> makeCodePoints( size_t length, Content content )
+	{
+		static constexpr char32_t nonAscii[]{ U'é', U'ü', U'ß', U'Ж', U'東', U'京', U'語', U'😀' };
+
+		std::mt19937 gen( static_cast<uint32_t>( length ) * 2 + static_cast<uint32_t>( content ) );
+		std::vector<std::u32string> keys( WIDE_KEY_COUNT );
+		for ( auto& key : keys )
+		{
+			key.resize( length );
+			for ( auto& cp : key )
+			{
+				const uint32_t r = gen();
+				cp = content == Content::Mixed && r % 4 == 0 ? nonAscii[( r >> 8 ) % 8] : U'a' + static_cast<char32_t>( ( r >> 8 ) % 26 );
+			}
+		}
+
+		return keys;
+	}
+
+	static std::u16string toUtf16( const std::u32string& text )
+	{
+		std::u16string out;
+		out.reserve( text.size() );
+		for ( const char32_t cp : text )
+		{
+			if ( cp >= 0x10000 )
+			{
+				out += static_cast<char16_t>( 0xD800 + ( ( cp - 0x10000 ) >> 10 ) );
+				out += static_cast<char16_t>( 0xDC00 + ( ( cp - 0x10000 ) & 0x3FF ) );
+			}
+			else
+			{
+				out += static_cast<char16_t>( cp );
+			}
+		}
+
+		return out;
+	}
+
+	//=====================================================================
+	// Transcoding baseline
+	//=====================================================================
+
+	static void appendUtf8( std::string& out, char32_t cp )
+	{
+		if ( cp < 0x80 )
+		{
+			out += static_cast<char>( cp );
+		}
+		else if ( cp < 0x800 )
+		{
+			out += static_cast<char>( 0xC0 | ( cp >> 6 ) );
+			out += static_cast<char>( 0x80 | ( cp & 0x3F ) );
+		}
+		else if ( cp < 0x10000 )
+		{
+			out += static_cast<char>( 0xE0 | ( cp >> 12 ) );
+			out += static_cast<char>( 0x80 | ( ( cp >> 6 ) & 0x3F ) );
+			out += static_cast<char>( 0x80 | ( cp & 0x3F ) );
+		}
+		else
+		{
+			out += static_cast<char>( 0xF0 | ( cp >> 18 ) );
+			out += static_cast<char>( 0x80 | ( ( cp >> 12 ) & 0x3F ) );
+			out += static_cast<char>( 0x80 | ( ( cp >> 6 ) & 0x3F ) );
+			out += static_cast<char>( 0x80 | ( cp & 0x3F ) );
+		}
+	}
+
+	/** @brief Transcodes into a new string, as a caller without the UTF-8 overloads would. */
+	static std::string transcode( std::u16string_view text )
+	{
+		std::string out;
+		out.reserve( text.size() * 3 );
+		for ( size_t i = 0; i < text.size(); ++i )
+		{
+			char32_t cp = text[i];
+			if ( cp >= 0xD800 && cp <= 0xDBFF && i + 1 < text.size() )
+			{
+				cp = 0x10000 + ( ( cp - 0xD800 ) << 10 ) + ( text[++i] - 0xDC00 );
+			}
+			appendUtf8( out, cp );
+		}
+
+		return out;
+	}
+
+	static std::string transcode( std::u32string_view text )
+	{
+		std::string out;
+		out.reserve( text.size() * 4 );
+		for ( const char32_t cp : text )
+		{
+			appendUtf8( out, cp );
+		}
+
+		return out;
+	}
+
+	//=====================================================================
+	// Benchmark runners
+	//=====================================================================
+
+	template <typename Key, typename Hash>
+	static void runWideHash( ::benchmark::State& state, const std::vector<Key>& keys, Hash hash )
+	{
+		size_t bytes = 0;
+		for ( const auto& key : keys )
+		{
+			bytes += key.size() * sizeof( typename Key::value_type );
+		}
+
+		const PerfCounterScope perf{ state, bytes };
+		for ( auto _ : state )
+		{
+			uint32_t total = 0;
+			for ( const auto& key : keys )
+			{
+				total += hash( key );
+			}
+			::benchmark::DoNotOptimize( total );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * keys.size() ) );
+		state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * bytes ) );
+	}
+
+	static std::vector<std::u16string> utf16Keys( const ::benchmark::State& state )
+	{
+		std::vector<std::u16string> keys;
+		for ( const auto& key : makeCodePoints( static_cast<size_t>( state.range( 0 ) ), static_cast<Content>( state.range( 1 ) ) ) )
+		{
+			keys.push_back( toUtf16( key ) );
+		}
+
+		return keys;
+	}
+
+	static std::vector<std::u32string> utf32Keys( const ::benchmark::State& state )
+	{
+		return makeCodePoints( static_cast<size_t>( state.range( 0 ) ), static_cast<Content>( state.range( 1 ) ) );
+	}
+
+	template <typename CharT>
+	static std::string_view bytesOf( std::basic_string_view<CharT> text )
+	{
+		return std::string_view{ reinterpret_cast<const char*>( text.data() ), text.size() * sizeof( CharT ) };
+	}
+
+	//=====================================================================
+	// UTF-16 benchmarks
+	//=====================================================================
+
+	static void BM_Utf16_RawBytes( ::benchmark::State& state )
+	{
+		runWideHash( state, utf16Keys( state ), []( std::u16string_view key ) { return nfx::core::hashing::hashStringView( key ); } );
+	}
+
+	static void BM_Utf16_RawBytes_ByteLoop( ::benchmark::State& state )
+	{
+		// Baseline: cast to bytes and hash through the per-byte loop
+		runWideHash( state, utf16Keys( state ), []( std::u16string_view key ) { return nfx::core::hashing::hashStringView( bytesOf( key ) ); } );
+	}
+
+	static void BM_Utf16_AsUtf8( ::benchmark::State& state )
+	{
+		runWideHash( state, utf16Keys( state ), []( std::u16string_view key ) { return nfx::core::hashing::hashStringViewAsUtf8( key ); } );
+	}
+
+	static void BM_Utf16_TranscodeThenHash( ::benchmark::State& state )
+	{
+		// Baseline: allocate the UTF-8 string, then hash it
+		runWideHash( state, utf16Keys( state ), []( std::u16string_view key ) { return nfx::core::hashing::hashStringView( transcode( key ) ); } );
+	}
+
+	//=====================================================================
+	// UTF-32 benchmarks
+	//=====================================================================
+
+	static void BM_Utf32_RawBytes( ::benchmark::State& state )
+	{
+		runWideHash( state, utf32Keys( state ), []( std::u32string_view key ) { return nfx::core::hashing::hashStringView( key ); } );
+	}
+
+	static void BM_Utf32_RawBytes_ByteLoop( ::benchmark::State& state )
+	{
+		runWideHash( state, utf32Keys( state ), []( std::u32string_view key ) { return nfx::core::hashing::hashStringView( bytesOf( key ) ); } );
+	}
+
+	static void BM_Utf32_AsUtf8( ::benchmark::State& state )
+	{
+		runWideHash( state, utf32Keys( state ), []( std::u32string_view key ) { return nfx::core::hashing::hashStringViewAsUtf8( key ); } );
+	}
+
+	static void BM_Utf32_TranscodeThenHash( ::benchmark::State& state )
+	{
+		runWideHash( state, utf32Keys( state ), []( std::u32string_view key ) { return nfx::core::hashing::hashStringView( transcode( key ) ); } );
+	}
+
+	//=====================================================================
+	// Arguments
+	//=====================================================================
+
+	/** @brief 8 .. 1024 code points, ASCII and mixed content. */
+	static void keyArguments( ::benchmark::internal::Benchmark* benchmark )
+	{
+		benchmark->ArgNames( { "length", "mixed" } );
+		for ( int64_t length = 8; length <= 1024; length *= 4 )
+		{
+			benchmark->Args( { length, static_cast<int64_t>( Content::Ascii ) } );
+			benchmark->Args( { length, static_cast<int64_t>( Content::Mixed ) } );
+		}
+	}
+} // namespace nfx::core::benchmark
+
+//=====================================================================
+// Benchmarks registration
+//=====================================================================
+
+//----------------------------------------------
+// UTF-16
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_Utf16_RawBytes )
+	->Apply( nfx::core::benchmark::keyArguments );
+BENCHMARK( nfx::core::benchmark::BM_Utf16_RawBytes_ByteLoop )
+	->Apply( nfx::core::benchmark::keyArguments );
+BENCHMARK( nfx::core::benchmark::BM_Utf16_AsUtf8 )
+	->Apply( nfx::core::benchmark::keyArguments );
+BENCHMARK( nfx::core::benchmark::BM_Utf16_TranscodeThenHash )
+	->Apply( nfx::core::benchmark::keyArguments );
+
+//----------------------------------------------
+// UTF-32
+//----------------------------------------------
+
+BENCHMARK( nfx::core::benchmark::BM_Utf32_RawBytes )
+	->Apply( nfx::core::benchmark::keyArguments );
+BENCHMARK( nfx::core::benchmark::BM_Utf32_RawBytes_ByteLoop )
+	->Apply( nfx::core::benchmark::keyArguments );
+BENCHMARK( nfx::core::benchmark::BM_Utf32_AsUtf8 )
+	->Apply( nfx::core::benchmark::keyArguments );
+BENCHMARK( nfx::core::benchmark::BM_Utf32_TranscodeThenHash )
+	->Apply( nfx::core::benchmark::keyArguments );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,270 @@
+/**
+ * @file BaselineComparison.h
+ * @brief Baseline regression reporting for nfx-core benchmarks
+ * @details Runs the registered benchmarks, then compares their CPU time with a stored
+ *          Google Benchmark JSON file (`--benchmark_out=<file> --benchmark_out_format=json`)
+ *          and flags every benchmark that got slower than a threshold.
+ *
+ *          Usage:
+ *          @code
+ *          BM_HashingThroughput --benchmark_out=baseline.json --benchmark_out_format=json
+ *          BM_HashingThroughput --nfx_baseline=baseline.json --nfx_regression_threshold=5
+ *          @endcode
+ *
+ *          Only per-repetition runs are compared: aggregates (`_mean`, `_median`, `_stddev`,
+ *          `_cv`) of `--benchmark_repetitions` are skipped, since their spread is noise.
+ *          The process exits with 1 when at least one benchmark regressed, so it can gate CI.
+ */
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nfx::core::benchmark
+{
+	//=====================================================================
+	// Baseline comparison
+	//=====================================================================
+
+	namespace detail
+	{
+		/** @brief Nanoseconds per unit of a Google Benchmark time unit name. */
+		inline double nanosecondsPerUnit( std::string_view unit ) noexcept
+		{
+			if ( unit == "us" )
+			{
+				return 1e3;
+			}
+			if ( unit == "ms" )
+			{
+				return 1e6;
+			}
+			if ( unit == "s" )
+			{
+				return 1e9;
+			}
+
+			return 1.0;
+		}
+
+		/** @brief Nanoseconds per unit of a Google Benchmark time unit. */
+		inline double nanosecondsPerUnit( ::benchmark::TimeUnit unit ) noexcept
+		{
+			switch ( unit )
+			{
+				case ::benchmark::kMicrosecond:
+					return 1e3;
+				case ::benchmark::kMillisecond:
+					return 1e6;
+				case ::benchmark::kSecond:
+					return 1e9;
+				default:
+					return 1.0;
+			}
+		}
+
+		/** @brief Keeps the fastest time seen for a name (repetitions are noisy upwards, not downwards). */
+		inline void recordFastest( std::map<std::string, double>& times, const std::string& name, double nanoseconds )
+		{
+			const auto it = times.find( name );
+			if ( it == times.end() || nanoseconds < it->second )
+			{
+				times[name] = nanoseconds;
+			}
+		}
+
+		/** @brief Reads the string value of `key` within [from, to). */
+		inline bool readJsonString( const std::string& json, std::string_view key, size_t from, size_t to, std::string& value )
+		{
+			const size_t keyPos = json.find( key, from );
+			if ( keyPos == std::string::npos || keyPos >= to )
+			{
+				return false;
+			}
+
+			const size_t open = json.find( '"', json.find( ':', keyPos + key.size() ) );
+			const size_t close = json.find( '"', open + 1 );
+			if ( open == std::string::npos || close == std::string::npos || close >= to )
+			{
+				return false;
+			}
+
+			value = json.substr( open + 1, close - open - 1 );
+			return true;
+		}
+
+		/** @brief Reads the numeric value of `key` within [from, to). */
+		inline bool readJsonNumber( const std::string& json, std::string_view key, size_t from, size_t to, double& value )
+		{
+			const size_t keyPos = json.find( key, from );
+			if ( keyPos == std::string::npos || keyPos >= to )
+			{
+				return false;
+			}
+
+			const char* start = json.c_str() + json.find( ':', keyPos + key.size() ) + 1;
+			char* end = nullptr;
+			value = std::strtod( start, &end );
+
+			return end != start;
+		}
+
+		/**
+		 * @brief Extracts name -> fastest CPU time (ns) from a Google Benchmark JSON file.
+		 * @details Benchmark entries are flat objects, so each one spans from its `"name"`
+		 *          key to the next; no general JSON parser is needed. Aggregate entries
+		 *          are skipped.
+		 */
+		inline bool loadBaseline( const std::string& path, std::map<std::string, double>& times )
+		{
+			std::ifstream file{ path };
+			if ( !file )
+			{
+				return false;
+			}
+			const std::string json{ std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{} };
+
+			constexpr std::string_view nameKey{ "\"name\"" };
+			size_t pos = json.find( "\"benchmarks\"" );
+			if ( pos == std::string::npos )
+			{
+				return false;
+			}
+
+			pos = json.find( nameKey, pos );
+			while ( pos != std::string::npos )
+			{
+				const size_t next = json.find( nameKey, pos + nameKey.size() );
+				const size_t end = next == std::string::npos ? json.size() : next;
+
+				std::string name;
+				std::string unit{ "ns" };
+				std::string runType;
+				double cpuTime = 0.0;
+				const bool aggregate = readJsonString( json, "\"run_type\"", pos, end, runType ) && runType == "aggregate";
+				if ( !aggregate && readJsonString( json, nameKey, pos, end, name ) && readJsonNumber( json, "\"cpu_time\"", pos, end, cpuTime ) )
+				{
+					readJsonString( json, "\"time_unit\"", pos, end, unit );
+					recordFastest( times, name, cpuTime * nanosecondsPerUnit( unit ) );
+				}
+
+				pos = next;
+			}
+
+			return !times.empty();
+		}
+
+		/** @brief Console reporter that also records the CPU time of every non-aggregate run. */
+		class RecordingReporter final : public ::benchmark::ConsoleReporter
+		{
+		public:
+			void ReportRuns( const std::vector<Run>& reports ) override
+			{
+				for ( const auto& run : reports )
+				{
+					if ( run.run_type != Run::RT_Aggregate && run.iterations > 0 )
+					{
+						recordFastest( m_times, run.benchmark_name(), run.GetAdjustedCPUTime() * nanosecondsPerUnit( run.time_unit ) );
+					}
+				}
+
+				ConsoleReporter::ReportRuns( reports );
+			}
+
+			const std::map<std::string, double>& times() const noexcept
+			{
+				return m_times;
+			}
+
+		private:
+			std::map<std::string, double> m_times;
+		};
+	} // namespace detail
+
+	/**
+	 * @brief Benchmark entry point with optional baseline regression reporting.
+	 * @param[in] argc Argument count
+	 * @param[in] argv Arguments; `--nfx_baseline=<json>` enables the comparison and
+	 *            `--nfx_regression_threshold=<percent>` sets the allowed slowdown (default 5)
+	 * @return 0 on success, 1 on unrecognized arguments, a missing baseline or any regression
+	 */
+	inline int runBenchmarksWithBaseline( int argc, char** argv )
+	{
+		std::string baselinePath;
+		double thresholdPercent = 5.0;
+
+		// Strip our flags before Google Benchmark validates the rest
+		std::vector<char*> args;
+		for ( int i = 0; i < argc; ++i )
+		{
+			const std::string_view arg{ argv[i] };
+			if ( arg.starts_with( "--nfx_baseline=" ) )
+			{
+				baselinePath = std::string{ arg.substr( 15 ) };
+			}
+			else if ( arg.starts_with( "--nfx_regression_threshold=" ) )
+			{
+				thresholdPercent = std::strtod( argv[i] + 27, nullptr );
+			}
+			else
+			{
+				args.push_back( argv[i] );
+			}
+		}
+
+		int count = static_cast<int>( args.size() );
+		::benchmark::Initialize( &count, args.data() );
+		if ( ::benchmark::ReportUnrecognizedArguments( count, args.data() ) )
+		{
+			return 1;
+		}
+
+		std::map<std::string, double> baseline;
+		if ( !baselinePath.empty() && !detail::loadBaseline( baselinePath, baseline ) )
+		{
+			std::fprintf( stderr, "Cannot read benchmark baseline '%s'\n", baselinePath.c_str() );
+			return 1;
+		}
+
+		detail::RecordingReporter reporter;
+		::benchmark::RunSpecifiedBenchmarks( &reporter );
+		::benchmark::Shutdown();
+
+		if ( baselinePath.empty() )
+		{
+			return 0;
+		}
+
+		size_t compared = 0;
+		size_t regressions = 0;
+		std::printf( "\nBaseline comparison against %s (threshold %.1f%%)\n", baselinePath.c_str(), thresholdPercent );
+		for ( const auto& [name, nanoseconds] : reporter.times() )
+		{
+			const auto it = baseline.find( name );
+			if ( it == baseline.end() || it->second <= 0.0 )
+			{
+				continue;
+			}
+
+			++compared;
+			const double change = ( nanoseconds / it->second - 1.0 ) * 100.0;
+			if ( change > thresholdPercent )
+			{
+				++regressions;
+				std::printf( "  REGRESSION %-60s %+7.1f%%  (%.3f ns -> %.3f ns)\n", name.c_str(), change, it->second, nanoseconds );
+			}
+		}
+		std::printf( "%zu benchmarks compared, %zu regressed\n", compared, regressions );
+
+		return regressions == 0 ? 0 : 1;
+	}
+} // namespace nfx::core::benchmark
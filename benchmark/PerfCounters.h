@@ -0,0 +1,316 @@
+/**
+ * @file PerfCounters.h
+ * @brief Hardware performance counter capture for nfx-core benchmarks
+ * @details Linux `perf_event_open` integration: cycles, instructions, branch misses and
+ *          L1D / LLC misses are counted around a benchmark's timed loop and published as
+ *          Google Benchmark user counters (per iteration, IPC and per byte).
+ *
+ *          Degrades gracefully: when perf events are unavailable (non-Linux, containers
+ *          without CAP_PERFMON, perf_event_paranoid > 2, hypervisors without a PMU) or
+ *          disabled with `NFX_BENCHMARK_PERF_COUNTERS=0`, no counters are added and the
+ *          benchmark runs unchanged. Individual events that cannot be opened are skipped.
+ *
+ *          Usage:
+ *          @code
+ *          static void BM_Something( ::benchmark::State& state )
+ *          {
+ *              const PerfCounterScope perf{ state, bytesPerIteration };
+ *              for ( auto _ : state ) { ... }
+ *          }
+ *          @endcode
+ */
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#if defined( __linux__ )
+#	include <linux/perf_event.h>
+#	include <sys/ioctl.h>
+#	include <sys/syscall.h>
+#	include <unistd.h>
+#endif
+
+namespace nfx::core::benchmark
+{
+	//=====================================================================
+	// Hardware performance counters
+	//=====================================================================
+
+	/** @brief Hardware events captured by PerfEventGroup. */
+	enum class PerfEvent : size_t
+	{
+		Cycles = 0,
+		Instructions,
+		BranchMisses,
+		L1DMisses,
+		LLCMisses,
+		Count
+	};
+
+	/**
+	 * @brief One perf event group per thread, opened once and reused across benchmark runs.
+	 * @details The first event that opens becomes the group leader, so all events are
+	 *          scheduled together and their ratios (IPC, misses per byte) are consistent.
+	 *          Values are scaled by time_enabled / time_running when the kernel multiplexes.
+	 */
+	class PerfEventGroup final
+	{
+	public:
+		static constexpr size_t EVENT_COUNT{ static_cast<size_t>( PerfEvent::Count ) };
+
+		using Values = std::array<double, EVENT_COUNT>;
+
+		//----------------------------------------------
+		// Access
+		//----------------------------------------------
+
+		/**
+		 * @brief Gets the calling thread's event group, opening it on first use.
+		 * @return The thread's event group (check available())
+		 */
+		static PerfEventGroup& forThisThread()
+		{
+			thread_local PerfEventGroup s_group;
+			return s_group;
+		}
+
+		/**
+		 * @brief Checks whether at least one event could be opened.
+		 * @return true if counting works on this system
+		 */
+		bool available() const noexcept
+		{
+			return m_leader >= 0;
+		}
+
+		/**
+		 * @brief Checks whether a specific event is being counted.
+		 * @param[in] event Event to query
+		 * @return true if the event was opened
+		 */
+		bool has( PerfEvent event ) const noexcept
+		{
+			return m_slot[static_cast<size_t>( event )] >= 0;
+		}
+
+		//----------------------------------------------
+		// Counting
+		//----------------------------------------------
+
+		/** @brief Resets and enables all events. */
+		void start() noexcept
+		{
+#if defined( __linux__ )
+			if ( available() )
+			{
+				::ioctl( m_leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP );
+				::ioctl( m_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP );
+			}
+#endif
+		}
+
+		/**
+		 * @brief Disables all events and reads their values.
+		 * @param[out] values Per-event counts (0 for events that are not open)
+		 * @return true if the values were read
+		 */
+		bool stop( Values& values ) noexcept
+		{
+			values.fill( 0.0 );
+#if defined( __linux__ )
+			if ( !available() )
+			{
+				return false;
+			}
+			::ioctl( m_leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP );
+
+			// PERF_FORMAT_GROUP layout: nr, time_enabled, time_running, value[nr]
+			std::array<uint64_t, 3 + EVENT_COUNT> buffer{};
+			const ssize_t bytes = ::read( m_leader, buffer.data(), sizeof( buffer ) );
+			if ( bytes < static_cast<ssize_t>( 3 * sizeof( uint64_t ) ) )
+			{
+				return false;
+			}
+
+			const uint64_t enabled = buffer[1];
+			const uint64_t running = buffer[2];
+			const double scale = running > 0 && running < enabled ? static_cast<double>( enabled ) / static_cast<double>( running ) : 1.0;
+			for ( size_t e = 0; e < EVENT_COUNT; ++e )
+			{
+				if ( m_slot[e] >= 0 && static_cast<uint64_t>( m_slot[e] ) < buffer[0] )
+				{
+					values[e] = static_cast<double>( buffer[3 + static_cast<size_t>( m_slot[e] )] ) * scale;
+				}
+			}
+
+			return true;
+#else
+			return false;
+#endif
+		}
+
+		PerfEventGroup( const PerfEventGroup& ) = delete;
+		PerfEventGroup& operator=( const PerfEventGroup& ) = delete;
+
+		~PerfEventGroup()
+		{
+#if defined( __linux__ )
+			for ( const int fd : m_fds )
+			{
+				if ( fd >= 0 )
+				{
+					::close( fd );
+				}
+			}
+#endif
+		}
+
+	private:
+		PerfEventGroup()
+		{
+			m_fds.fill( -1 );
+			m_slot.fill( -1 );
+
+			const char* setting = std::getenv( "NFX_BENCHMARK_PERF_COUNTERS" );
+			if ( setting != nullptr && std::strcmp( setting, "0" ) == 0 )
+			{
+				return;
+			}
+
+#if defined( __linux__ )
+			constexpr uint64_t l1dReadMiss = PERF_COUNT_HW_CACHE_L1D | ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) | ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 );
+
+			open( PerfEvent::Cycles, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES );
+			open( PerfEvent::Instructions, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS );
+			open( PerfEvent::BranchMisses, PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES );
+			open( PerfEvent::L1DMisses, PERF_TYPE_HW_CACHE, l1dReadMiss );
+			open( PerfEvent::LLCMisses, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES );
+
+			if ( !available() )
+			{
+				static bool s_warned = false;
+				if ( !s_warned )
+				{
+					s_warned = true;
+					std::fprintf( stderr, "nfx-core: hardware performance counters unavailable (perf_event_open failed); reporting time only\n" );
+				}
+			}
+#endif
+		}
+
+#if defined( __linux__ )
+		void open( PerfEvent event, uint32_t type, uint64_t config ) noexcept
+		{
+			perf_event_attr attr{};
+			attr.size = sizeof( attr );
+			attr.type = type;
+			attr.config = config;
+			attr.disabled = m_leader < 0 ? 1 : 0; // Members follow the leader's enable state
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+			attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+			const int fd = static_cast<int>( ::syscall( SYS_perf_event_open, &attr, 0, -1, m_leader, 0 ) );
+			if ( fd < 0 )
+			{
+				return;
+			}
+
+			m_fds[static_cast<size_t>( event )] = fd;
+			m_slot[static_cast<size_t>( event )] = m_members++;
+			if ( m_leader < 0 )
+			{
+				m_leader = fd;
+			}
+		}
+#endif
+
+		std::array<int, EVENT_COUNT> m_fds;	 ///< Event file descriptors (-1 if not open)
+		std::array<int, EVENT_COUNT> m_slot; ///< Position of each event in the group read (-1 if not open)
+		int m_leader{ -1 };					 ///< Group leader descriptor
+		int m_members{ 0 };					 ///< Number of open events
+	};
+
+	/**
+	 * @brief Counts hardware events from construction to destruction and publishes them.
+	 * @details Construct immediately before the `for ( auto _ : state )` loop. On destruction
+	 *          the following user counters are added (only for events that could be opened):
+	 *          - `cycles`, `instructions`, `branch_misses`, `L1D_misses`, `LLC_misses` per iteration
+	 *          - `IPC` (instructions per cycle)
+	 *          - `cycles_per_byte`, `instructions_per_byte`, `branch_misses_per_byte`, `L1D_misses_per_byte`,
+	 *            `LLC_misses_per_byte` when `bytesPerIteration` is non-zero
+	 *
+	 *          Counters are averaged over threads, so multi-threaded runs report per-thread values.
+	 */
+	class PerfCounterScope final
+	{
+	public:
+		/**
+		 * @brief Starts counting for the calling thread.
+		 * @param[in] state Benchmark state the counters are published to
+		 * @param[in] bytesPerIteration Input bytes processed per iteration (0 to skip per-byte counters)
+		 */
+		explicit PerfCounterScope( ::benchmark::State& state, size_t bytesPerIteration = 0 )
+			: m_state{ state },
+			  m_group{ PerfEventGroup::forThisThread() },
+			  m_bytesPerIteration{ bytesPerIteration }
+		{
+			m_group.start();
+		}
+
+		~PerfCounterScope()
+		{
+			PerfEventGroup::Values values;
+			if ( !m_group.stop( values ) || m_state.iterations() == 0 )
+			{
+				return;
+			}
+
+			const double iterations = static_cast<double>( m_state.iterations() );
+			const double bytes = iterations * static_cast<double>( m_bytesPerIteration );
+
+			publish( PerfEvent::Cycles, "cycles", values, iterations, bytes );
+			publish( PerfEvent::Instructions, "instructions", values, iterations, bytes );
+			publish( PerfEvent::BranchMisses, "branch_misses", values, iterations, bytes );
+			publish( PerfEvent::L1DMisses, "L1D_misses", values, iterations, bytes );
+			publish( PerfEvent::LLCMisses, "LLC_misses", values, iterations, bytes );
+
+			const double cycles = values[static_cast<size_t>( PerfEvent::Cycles )];
+			if ( m_group.has( PerfEvent::Cycles ) && m_group.has( PerfEvent::Instructions ) && cycles > 0.0 )
+			{
+				m_state.counters["IPC"] = ::benchmark::Counter( values[static_cast<size_t>( PerfEvent::Instructions )] / cycles, ::benchmark::Counter::kAvgThreads );
+			}
+		}
+
+		PerfCounterScope( const PerfCounterScope& ) = delete;
+		PerfCounterScope& operator=( const PerfCounterScope& ) = delete;
+
+	private:
+		void publish( PerfEvent event, const std::string& name, const PerfEventGroup::Values& values, double iterations, double bytes )
+		{
+			if ( !m_group.has( event ) )
+			{
+				return;
+			}
+
+			const double total = values[static_cast<size_t>( event )];
+			m_state.counters[name] = ::benchmark::Counter( total / iterations, ::benchmark::Counter::kAvgThreads );
+			if ( bytes > 0.0 )
+			{
+				m_state.counters[name + "_per_byte"] = ::benchmark::Counter( total / bytes, ::benchmark::Counter::kAvgThreads );
+			}
+		}
+
+		::benchmark::State& m_state;
+		PerfEventGroup& m_group;
+		size_t m_bytesPerIteration;
+	};
+} // namespace nfx::core::benchmark
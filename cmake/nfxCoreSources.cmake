@@ -9,11 +9,35 @@
 set(PUBLIC_HEADERS)
 
 list(APPEND PUBLIC_HEADERS
+	${NFX_CORE_INCLUDE_DIR}/nfx/core/Arena.h
+	${NFX_CORE_INCLUDE_DIR}/nfx/core/BatchLookup.h
+	${NFX_CORE_INCLUDE_DIR}/nfx/core/Checksum.h
+	${NFX_CORE_INCLUDE_DIR}/nfx/core/ConsistentHashing.h
+	${NFX_CORE_INCLUDE_DIR}/nfx/core/CountMinSketch.h
 	${NFX_CORE_INCLUDE_DIR}/nfx/core/CPU.h
+	${NFX_CORE_INCLUDE_DIR}/nfx/core/CycleTimer.h
+	${NFX_CORE_INCLUDE_DIR}/nfx/core/Dispatch.h
+	${NFX_CORE_INCLUDE_DIR}/nfx/core/HashedString.h
 	${NFX_CORE_INCLUDE_DIR}/nfx/core/Hashing.h
+	${NFX_CORE_INCLUDE_DIR}/nfx/core/HyperLogLog.h
+	${NFX_CORE_INCLUDE_DIR}/nfx/core/InterleavedLookup.h
+	${NFX_CORE_INCLUDE_DIR}/nfx/core/KeyEquality.h
+	${NFX_CORE_INCLUDE_DIR}/nfx/core/StringInterner.h
 
+	${NFX_CORE_INCLUDE_DIR}/nfx/detail/core/Arena.inl
+	${NFX_CORE_INCLUDE_DIR}/nfx/detail/core/BatchLookup.inl
+	${NFX_CORE_INCLUDE_DIR}/nfx/detail/core/Checksum.inl
+	${NFX_CORE_INCLUDE_DIR}/nfx/detail/core/ConsistentHashing.inl
+	${NFX_CORE_INCLUDE_DIR}/nfx/detail/core/CountMinSketch.inl
 	${NFX_CORE_INCLUDE_DIR}/nfx/detail/core/CPU.inl
+	${NFX_CORE_INCLUDE_DIR}/nfx/detail/core/CycleTimer.inl
+	${NFX_CORE_INCLUDE_DIR}/nfx/detail/core/Dispatch.inl
+	${NFX_CORE_INCLUDE_DIR}/nfx/detail/core/HashedString.inl
 	${NFX_CORE_INCLUDE_DIR}/nfx/detail/core/Hashing.inl
+	${NFX_CORE_INCLUDE_DIR}/nfx/detail/core/HyperLogLog.inl
+	${NFX_CORE_INCLUDE_DIR}/nfx/detail/core/InterleavedLookup.inl
+	${NFX_CORE_INCLUDE_DIR}/nfx/detail/core/KeyEquality.inl
+	${NFX_CORE_INCLUDE_DIR}/nfx/detail/core/StringInterner.inl
 )
 
 #----------------------------------------------
@@ -0,0 +1,261 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Arena.h
+ * @brief Huge-page and NUMA-aware bump allocator
+ * @details Maps large chunks of anonymous memory backed by transparent or explicit 2 MiB
+ *          pages, optionally bound to one NUMA node, hands them out by pointer bump and
+ *          releases them all at once
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <optional>
+#include <vector>
+
+namespace nfx::core::memory
+{
+	namespace constants
+	{
+		//=====================================================================
+		// Arena constants
+		//=====================================================================
+
+		/** @brief Base page size assumed for touching and rounding. */
+		inline constexpr size_t SMALL_PAGE_SIZE{ 4096 };
+
+		/** @brief x86-64 huge page size (PMD mapping). */
+		inline constexpr size_t HUGE_PAGE_SIZE{ 2 * 1024 * 1024 };
+
+		/** @brief Bytes mapped per arena chunk unless the options say otherwise. */
+		inline constexpr size_t ARENA_DEFAULT_CHUNK_SIZE{ 8 * HUGE_PAGE_SIZE };
+	} // namespace constants
+
+	//=====================================================================
+	// Arena options
+	//=====================================================================
+
+	/** @brief Page backing requested for arena chunks. */
+	enum class PageSize : uint8_t
+	{
+		Small = 0,		 ///< 4 KiB pages; transparent huge pages are disabled for the chunk
+		TransparentHuge, ///< 2 MiB-aligned chunk advised with MADV_HUGEPAGE; the kernel backs it with huge pages when it can
+		ExplicitHuge	 ///< MAP_HUGETLB pages from the reserved pool (vm.nr_hugepages); falls back to TransparentHuge
+	};
+
+	/** @brief Arena configuration. */
+	struct ArenaOptions
+	{
+		PageSize pages{ PageSize::TransparentHuge };				///< Requested page backing
+		std::optional<uint32_t> numaNode{};							///< Node to place chunks on (nullopt: default policy)
+		size_t chunkSize{ constants::ARENA_DEFAULT_CHUNK_SIZE };	///< Bytes mapped per chunk (rounded up to the page size)
+		bool prefault{ false };										///< Touch every page when a chunk is mapped
+	};
+
+	//=====================================================================
+	// Arena class
+	//=====================================================================
+
+	/**
+	 * @brief Bump allocator over huge-page, node-bound chunks
+	 * @details Memory for large hash tables and sketches: one TLB entry covers 2 MiB instead
+	 *          of 4 KiB, and every page sits on the node of the threads that probe it.
+	 *
+	 *          **Chunks:** Memory is mapped in chunks of ArenaOptions::chunkSize. Requests
+	 *          that do not fit the current chunk start a new one; requests larger than a
+	 *          quarter of a chunk get a chunk of their own, so big tables never waste the
+	 *          tail of a shared chunk. Chunks are never moved or resized.
+	 *
+	 *          **Huge pages:** Transparent huge page chunks are 2 MiB aligned so every 2 MiB
+	 *          of them can be mapped by one PMD entry. Explicit huge pages need a reserved
+	 *          pool; when it is empty the chunk falls back to transparent huge pages.
+	 *          hugePageBytes() reports what was obtained.
+	 *
+	 *          **NUMA:** With ArenaOptions::numaNode set, chunks are bound to that node with
+	 *          `mbind( MPOL_BIND )`. Where mbind is unavailable, the arena pins the calling
+	 *          thread to the node, touches every page (first-touch placement) and restores
+	 *          the thread's affinity.
+	 *
+	 *          **Release:** Individual allocations are never freed; release() unmaps every
+	 *          chunk at once, as does the destructor.
+	 *
+	 *          **Thread safety:** Not synchronized. Use one arena per thread, or build a
+	 *          structure in one arena and share it read-only.
+	 */
+	class Arena final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Creates an empty arena; no memory is mapped until the first allocation.
+		 * @param[in] options Page backing, NUMA node and chunk size
+		 */
+		inline explicit Arena( const ArenaOptions& options = {} ) noexcept;
+
+		/** @brief Unmaps every chunk. */
+		inline ~Arena();
+
+		Arena( const Arena& ) = delete;
+		Arena& operator=( const Arena& ) = delete;
+
+		/** @brief Takes over another arena's chunks; the source is left empty. */
+		inline Arena( Arena&& other ) noexcept;
+
+		/** @brief Releases this arena's chunks and takes over another's. */
+		inline Arena& operator=( Arena&& other ) noexcept;
+
+		//----------------------------------------------
+		// Allocation
+		//----------------------------------------------
+
+		/**
+		 * @brief Allocates uninitialized bytes.
+		 * @param[in] bytes Bytes to allocate
+		 * @param[in] alignment Power-of-2 alignment (at most constants::HUGE_PAGE_SIZE)
+		 * @return Pointer to the bytes, or nullptr if a chunk could not be mapped
+		 * @details Memory of a freshly mapped chunk is zero-filled.
+		 */
+		[[nodiscard]] inline void* allocate( size_t bytes, size_t alignment = alignof( std::max_align_t ) );
+
+		/**
+		 * @brief Allocates uninitialized storage for an array.
+		 * @tparam T Element type
+		 * @param[in] count Number of elements
+		 * @return Pointer to the storage, or nullptr on failure
+		 */
+		template <typename T>
+		[[nodiscard]] inline T* allocate( size_t count );
+
+		/** @brief Unmaps every chunk; all pointers handed out become invalid. */
+		inline void release() noexcept;
+
+		//----------------------------------------------
+		// Statistics
+		//----------------------------------------------
+
+		/** @brief Gets the options the arena was created with. */
+		[[nodiscard]] inline const ArenaOptions& options() const noexcept;
+
+		/** @brief Gets the bytes handed out (including alignment padding). */
+		[[nodiscard]] inline size_t bytesAllocated() const noexcept;
+
+		/** @brief Gets the bytes mapped across all chunks. */
+		[[nodiscard]] inline size_t bytesMapped() const noexcept;
+
+		/**
+		 * @brief Gets the bytes mapped with huge pages.
+		 * @details Explicit huge page chunks and transparent huge page chunks the kernel was
+		 *          advised to back with huge pages; transparent backing can still be partial
+		 *          under memory fragmentation.
+		 */
+		[[nodiscard]] inline size_t hugePageBytes() const noexcept;
+
+		/** @brief Gets the number of mapped chunks. */
+		[[nodiscard]] inline size_t chunkCount() const noexcept;
+
+		/** @brief Checks whether every chunk was placed on ArenaOptions::numaNode (false if none was set). */
+		[[nodiscard]] inline bool numaBound() const noexcept;
+
+	private:
+		/** @brief One mapped region. */
+		struct Chunk
+		{
+			void* base;		///< Mapping start
+			size_t size;	///< Mapped bytes
+			PageSize pages; ///< Backing actually obtained
+		};
+
+		[[nodiscard]] inline bool mapChunk( size_t minimumBytes );
+
+		ArenaOptions m_options;
+		std::vector<Chunk> m_chunks;
+		std::byte* m_cursor{ nullptr }; ///< Next free byte of the current chunk
+		std::byte* m_end{ nullptr };	///< End of the current chunk
+		size_t m_allocated{ 0 };
+		size_t m_mapped{ 0 };
+		size_t m_hugePageBytes{ 0 };
+		bool m_numaBound{ true };
+	};
+
+	//=====================================================================
+	// ArenaAllocator class
+	//=====================================================================
+
+	/**
+	 * @brief Standard allocator drawing from an Arena
+	 * @tparam T Element type
+	 * @details Lets `std::vector` and the nfx sketches (e.g. `CountMinSketch<4,
+	 *          ArenaAllocator<uint32_t>>`) place their storage in huge-page, node-bound
+	 *          memory. deallocate() does nothing; memory returns when the arena is released,
+	 *          so the arena must outlive every container using it. Prefer sizing containers
+	 *          once, since regrowth leaves the old buffer in the arena.
+	 */
+	template <typename T>
+	class ArenaAllocator
+	{
+	public:
+		using value_type = T;
+
+		/**
+		 * @brief Creates an allocator for an arena.
+		 * @param[in] arena Arena providing the memory
+		 */
+		inline ArenaAllocator( Arena& arena ) noexcept;
+
+		/** @brief Rebinds an allocator of another element type to the same arena. */
+		template <typename U>
+		inline ArenaAllocator( const ArenaAllocator<U>& other ) noexcept;
+
+		/**
+		 * @brief Allocates storage for `count` elements.
+		 * @throws std::bad_alloc if the arena cannot map a chunk (the standard allocator contract)
+		 */
+		[[nodiscard]] inline T* allocate( size_t count );
+
+		/** @brief Does nothing; the arena releases memory in bulk. */
+		inline void deallocate( T* pointer, size_t count ) noexcept;
+
+		/** @brief Gets the arena. */
+		[[nodiscard]] inline Arena& arena() const noexcept;
+
+		/** @brief Compares allocators by arena. */
+		template <typename U>
+		friend bool operator==( const ArenaAllocator& lhs, const ArenaAllocator<U>& rhs ) noexcept
+		{
+			return &lhs.arena() == &rhs.arena();
+		}
+
+	private:
+		Arena* m_arena;
+	};
+} // namespace nfx::core::memory
+
+#include "nfx/detail/core/Arena.inl"
@@ -0,0 +1,103 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BatchLookup.h
+ * @brief Batched hash-then-prefetch table lookups
+ * @details Splits a group of hash-table lookups into a hashing / slot stage, a prefetch
+ *          stage and a compare stage, so the bucket cache misses of the whole group are
+ *          in flight together instead of being paid one dependent miss at a time
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace nfx::core::hashing
+{
+	namespace constants
+	{
+		//=====================================================================
+		// Batch lookup constants
+		//=====================================================================
+
+		/**
+		 * @brief Keys hashed and prefetched together by lookupBatch().
+		 * @details Matches the 16 outstanding L1D misses (fill buffers) of recent Intel
+		 *          and AMD cores; smaller groups leave memory-level parallelism unused.
+		 */
+		inline constexpr size_t LOOKUP_BATCH_SIZE{ 16 };
+	} // namespace constants
+
+	//=====================================================================
+	// Batched lookup
+	//=====================================================================
+
+	/**
+	 * @brief Default key hash for lookupBatch().
+	 * @details `hashInteger` (truncated to 32 bits) for integral keys, the cached hash of
+	 *          pre-hashed keys (HashedStringView, HashedString), `hashStringView` for everything
+	 *          else convertible to `std::string_view`.
+	 */
+	struct LookupHash
+	{
+		/**
+		 * @brief Hashes a key.
+		 * @param[in] key Integral or string-like key
+		 * @return 32-bit hash suitable for seedMix()
+		 */
+		template <typename Key>
+		[[nodiscard]] inline uint32_t operator()( const Key& key ) const noexcept;
+	};
+
+	/**
+	 * @brief Looks up a batch of keys in a power-of-two hash table with software prefetching.
+	 * @tparam BatchSize Keys processed per group (constants::LOOKUP_BATCH_SIZE by default)
+	 * @param[in] keys Keys to look up
+	 * @param[out] results One result per key; only the first min( keys, results ) keys are processed
+	 * @param[in] seed Table seed passed to seedMix()
+	 * @param[in] tableSize Number of slots; must be a power of 2
+	 * @param[in] bucketAt Bucket accessor, `const void* ( uint32_t slot )`: address of the
+	 *            slot's bucket (the line that is prefetched)
+	 * @param[in] resolve Compare stage, `Result ( const Key& key, uint32_t slot )`: probes
+	 *            from `slot` and returns the lookup result
+	 * @param[in] hash Key hash, `uint32_t ( const Key& )` (LookupHash by default)
+	 * @details For each group, every key is hashed and mapped with
+	 *          `seedMix( seed, hash( key ), tableSize )`, every bucket is prefetched, and only
+	 *          then is `resolve` called for the group. On tables larger than the last-level
+	 *          cache this overlaps up to BatchSize memory latencies; on cache-resident tables
+	 *          it costs about the same as a plain loop. Keys left over after the last full
+	 *          group are resolved one at a time.
+	 *
+	 *          Only the first cache line of each bucket is prefetched; tables whose probe
+	 *          sequence spans several lines still take the later misses in `resolve`.
+	 */
+	template <size_t BatchSize = constants::LOOKUP_BATCH_SIZE, typename Key, typename Result, typename BucketAt, typename Resolve, typename Hash = LookupHash>
+	inline void lookupBatch( std::span<const Key> keys, std::span<Result> results, uint32_t seed, size_t tableSize,
+		BucketAt&& bucketAt, Resolve&& resolve, Hash&& hash = {} );
+} // namespace nfx::core::hashing
+
+#include "nfx/detail/core/BatchLookup.inl"
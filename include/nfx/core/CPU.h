@@ -31,8 +31,69 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
 namespace nfx::core::cpu
 {
+	namespace constants
+	{
+		//=====================================================================
+		// CPU constants
+		//=====================================================================
+
+		/** @brief Cache line size assumed when the hierarchy cannot be detected. */
+		inline constexpr size_t DEFAULT_CACHE_LINE_SIZE{ 64 };
+	} // namespace constants
+
+	//=====================================================================
+	// CPU feature snapshot
+	//=====================================================================
+
+	/**
+	 * @brief Instruction set extensions usable by this process.
+	 * @details Filled once by a single CPUID sweep. Extensions that need extended register
+	 *          state (AVX, AVX2, FMA, AVX-512) are only reported when the OS saves that state,
+	 *          as indicated by OSXSAVE and the XCR0 register (XGETBV):
+	 *          - AVX, AVX2, FMA: XMM and YMM state (XCR0 bits 1-2)
+	 *          - AVX-512: additionally opmask and ZMM state (XCR0 bits 5-7)
+	 *          All fields are `false` on non-x86 targets.
+	 */
+	struct CpuFeatures
+	{
+		bool sse42{ false };	///< SSE4.2 (CRC32, string compare) - leaf 1, ECX bit 20
+		bool popcnt{ false };	///< POPCNT - leaf 1, ECX bit 23
+		bool pclmul{ false };	///< PCLMULQDQ carry-less multiply - leaf 1, ECX bit 1
+		bool aes{ false };		///< AES-NI - leaf 1, ECX bit 25
+		bool avx{ false };		///< AVX - leaf 1, ECX bit 28, YMM state enabled
+		bool avx2{ false };		///< AVX2 - leaf 7, EBX bit 5, YMM state enabled
+		bool bmi1{ false };		///< BMI1 - leaf 7, EBX bit 3
+		bool bmi2{ false };		///< BMI2 (PDEP, PEXT, MULX) - leaf 7, EBX bit 8
+		bool fma{ false };		///< FMA3 - leaf 1, ECX bit 12, YMM state enabled
+		bool avx512f{ false };	///< AVX-512 Foundation - leaf 7, EBX bit 16, ZMM state enabled
+		bool avx512dq{ false }; ///< AVX-512 DQ - leaf 7, EBX bit 17
+		bool avx512cd{ false }; ///< AVX-512 CD - leaf 7, EBX bit 28
+		bool avx512bw{ false }; ///< AVX-512 BW - leaf 7, EBX bit 30
+		bool avx512vl{ false }; ///< AVX-512 VL - leaf 7, EBX bit 31
+		bool sha{ false };		///< SHA extensions - leaf 7, EBX bit 29
+	};
+
+	/**
+	 * @brief Gets the process-wide CPU feature snapshot.
+	 * @details The snapshot lives in `constinit` storage and is filled during static
+	 *          initialization, so after startup every call is a single load of a ready
+	 *          flag followed by plain field loads - no thread-safe-static guard and no CPUID.
+	 *          Calls made before that (from other static initializers) detect on demand.
+	 *          hasSSE42Support(), hasAVXSupport() and hasAVX2Support() skip the ready flag and
+	 *          read the fields directly; see their notes.
+	 * @return Reference to the detected features, valid for the lifetime of the process
+	 */
+	[[nodiscard]] inline const CpuFeatures& features() noexcept;
+
 	//=====================================================================
 	// CPU feature detection
 	//=====================================================================
@@ -44,11 +105,14 @@ namespace nfx::core::cpu
 	/**
 	 * @brief Gets the cached SSE4.2 support status.
 	 * @details Checks CPU capabilities for SSE4.2 CRC32 instructions, which provide
-	 *          3-5x faster hashing compared to software fallback. Result is cached
-	 *          via static initialization for zero runtime overhead.
+	 *          3-5x faster hashing compared to software fallback. A plain load from the
+	 *          features() snapshot, with no ready-flag check.
 	 * @return `true` if SSE4.2 is supported, `false` otherwise.
 	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 	 * @note Requires CPUID leaf 1, ECX bit 20
+	 * @note Valid from static initialization on: the snapshot is filled before any dynamic
+	 *       initializer that follows the `#include` of this header. Static initializers in
+	 *       translation units that do not include it should call features() instead.
 	 */
 	[[nodiscard]] inline bool hasSSE42Support() noexcept;
 
@@ -63,10 +127,13 @@ namespace nfx::core::cpu
 	 *          - 256-bit floating-point operations (vs 128-bit SSE)
 	 *          - Vectorized mathematical computations
 	 *          - SIMD-accelerated floating-point algorithms
-	 *          Result is cached via static initialization for zero runtime overhead.
-	 * @return `true` if AVX is supported, `false` otherwise.
+	 *          A plain load from the features() snapshot, with no ready-flag check.
+	 * @return `true` if AVX is supported and enabled by the OS, `false` otherwise.
 	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
-	 * @note Requires CPUID leaf 1, ECX bit 28
+	 * @note Requires CPUID leaf 1, ECX bit 28, OSXSAVE and XCR0 YMM state
+	 * @note Valid from static initialization on: the snapshot is filled before any dynamic
+	 *       initializer that follows the `#include` of this header. Static initializers in
+	 *       translation units that do not include it should call features() instead.
 	 */
 	[[nodiscard]] inline bool hasAVXSupport() noexcept;
 
@@ -82,12 +149,318 @@ namespace nfx::core::cpu
 	 *          - Vectorized string processing and comparison
 	 *          - Parallel hash computation for multiple keys
 	 *          - SIMD-accelerated mathematical operations
-	 *          Result is cached via static initialization for zero runtime overhead.
-	 * @return `true` if AVX2 is supported, `false` otherwise.
+	 *          A plain load from the features() snapshot, with no ready-flag check.
+	 * @return `true` if AVX2 is supported and enabled by the OS, `false` otherwise.
 	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
-	 * @note Requires CPUID leaf 7, subfunction 0, EBX bit 5
+	 * @note Requires CPUID leaf 7, subfunction 0, EBX bit 5, OSXSAVE and XCR0 YMM state
+	 * @note Valid from static initialization on: the snapshot is filled before any dynamic
+	 *       initializer that follows the `#include` of this header. Static initializers in
+	 *       translation units that do not include it should call features() instead.
 	 */
 	[[nodiscard]] inline bool hasAVX2Support() noexcept;
+
+	//=====================================================================
+	// Cache hierarchy
+	//=====================================================================
+
+	/** @brief Kind of data a cache holds. */
+	enum class CacheType : uint8_t
+	{
+		Data = 1,
+		Instruction = 2,
+		Unified = 3
+	};
+
+	/** @brief Geometry of one cache in the hierarchy, as seen from the detecting CPU. */
+	struct CacheInfo
+	{
+		uint8_t level{ 0 };				   ///< Cache level (1 = L1)
+		CacheType type{ CacheType::Data }; ///< Data, instruction or unified
+		uint32_t size{ 0 };				   ///< Total size in bytes
+		uint32_t associativity{ 0 };	   ///< Ways (0 = fully associative)
+		uint32_t lineSize{ 0 };			   ///< Line size in bytes
+		uint32_t sharedBy{ 0 };			   ///< Logical CPUs sharing this cache (CPUID: addressable upper bound; 0 = unknown)
+	};
+
+	/**
+	 * @brief Cache hierarchy of the host.
+	 * @details Detected from CPUID leaf 4 (Intel) or 0x8000001D (AMD), falling back to
+	 *          `/sys/devices/system/cpu/cpu0/cache` on Linux when CPUID reports nothing
+	 *          (non-x86 targets, hypervisors that mask the leaves). Empty when neither works.
+	 */
+	struct CacheTopology
+	{
+		/** @brief Maximum number of caches recorded. */
+		static constexpr size_t MAX_CACHES{ 8 };
+
+		std::array<CacheInfo, MAX_CACHES> caches{}; ///< Caches ordered by level
+		size_t count{ 0 };							///< Number of valid entries in caches
+
+		/**
+		 * @brief Gets all detected caches.
+		 * @return View of the valid entries, ordered by level
+		 */
+		[[nodiscard]] inline std::span<const CacheInfo> all() const noexcept;
+
+		/**
+		 * @brief Gets the data (or unified) cache at a level.
+		 * @param[in] level Cache level (1, 2, 3, ...)
+		 * @return Pointer to the cache, or nullptr if there is none at that level
+		 */
+		[[nodiscard]] inline const CacheInfo* dataCache( uint8_t level ) const noexcept;
+
+		/**
+		 * @brief Gets the size of the data (or unified) cache at a level.
+		 * @param[in] level Cache level (1, 2, 3, ...)
+		 * @return Size in bytes, or 0 if there is no such cache
+		 */
+		[[nodiscard]] inline size_t dataCacheSize( uint8_t level ) const noexcept;
+
+		/**
+		 * @brief Gets the L1 data cache line size.
+		 * @return Line size in bytes, or constants::DEFAULT_CACHE_LINE_SIZE if unknown
+		 */
+		[[nodiscard]] inline size_t lineSize() const noexcept;
+	};
+
+	/**
+	 * @brief Gets the process-wide cache hierarchy.
+	 * @details Detected on first call and stored like features(); later calls are plain loads.
+	 *          Use it to size blocks, partitions and table groups for the host, e.g. a
+	 *          working set of `dataCacheSize( 2 ) / 2` per thread.
+	 * @return Reference to the detected hierarchy, valid for the lifetime of the process
+	 */
+	[[nodiscard]] inline const CacheTopology& cacheTopology() noexcept;
+
+	//=====================================================================
+	// Processor topology
+	//=====================================================================
+
+	/** @brief Core class on hybrid processors (CPUID leaf 0x1A). */
+	enum class CoreType : uint8_t
+	{
+		Unknown = 0,
+		Performance, ///< P-core ("Core" type 0x40), or any core of a non-hybrid processor
+		Efficiency	 ///< E-core ("Atom" type 0x20)
+	};
+
+	/** @brief Placement of one logical CPU. */
+	struct LogicalCpu
+	{
+		uint32_t id{ 0 };					 ///< OS logical CPU number (affinity index)
+		uint32_t package{ 0 };				 ///< Physical package (socket)
+		uint32_t core{ 0 };					 ///< Physical core, unique across packages
+		uint32_t node{ 0 };					 ///< NUMA node
+		uint32_t smtIndex{ 0 };				 ///< Position among the core's SMT siblings (0 = first)
+		CoreType type{ CoreType::Unknown }; ///< Core class
+	};
+
+	/**
+	 * @brief Packages, cores, SMT siblings, core classes and NUMA nodes of the host.
+	 * @details On Linux, read from `/sys/devices/system/cpu` and `/sys/devices/system/node`;
+	 *          core classes come from CPUID leaf 0x1A on each CPU of a hybrid processor.
+	 *          Elsewhere every hardware thread is reported as its own core on package 0, node 0.
+	 */
+	struct CpuTopology
+	{
+		std::vector<LogicalCpu> cpus; ///< Online logical CPUs, ordered by id
+		uint32_t packages{ 0 };		  ///< Number of packages
+		uint32_t physicalCores{ 0 };  ///< Number of physical cores
+		uint32_t numaNodes{ 0 };	  ///< Number of NUMA nodes
+		bool hybrid{ false };		  ///< true if the processor mixes P-cores and E-cores
+
+		/**
+		 * @brief Gets the logical CPUs of one core class.
+		 * @param[in] type Core class to select
+		 * @return OS CPU numbers, ordered by id
+		 */
+		[[nodiscard]] inline std::vector<uint32_t> cpusOfType( CoreType type ) const;
+
+		/**
+		 * @brief Gets the logical CPUs of one NUMA node.
+		 * @param[in] node NUMA node to select
+		 * @return OS CPU numbers, ordered by id
+		 */
+		[[nodiscard]] inline std::vector<uint32_t> cpusOnNode( uint32_t node ) const;
+
+		/**
+		 * @brief Gets one logical CPU per physical core (the first SMT sibling).
+		 * @details Use it to spread compute-bound workers without sharing a core.
+		 * @return OS CPU numbers, ordered by id
+		 */
+		[[nodiscard]] inline std::vector<uint32_t> primaryThreads() const;
+	};
+
+	/**
+	 * @brief Gets the process-wide processor topology.
+	 * @details Detected on first call and stored like cacheTopology(). Detection parses
+	 *          sysfs into std::vector storage and may throw std::bad_alloc; a failed
+	 *          detection publishes nothing and the next call retries.
+	 *
+	 *          On hybrid processors only (CPUID leaf 7, EDX bit 15), the first call pins the
+	 *          calling thread to each CPU in turn to read its core class from CPUID 0x1A,
+	 *          then restores the thread's original affinity. Call it once at startup, before
+	 *          pinning worker threads, to keep that migration off latency-sensitive threads.
+	 * @return Reference to the detected topology, valid for the lifetime of the process
+	 */
+	[[nodiscard]] inline const CpuTopology& topology();
+
+	//=====================================================================
+	// Thread affinity
+	//=====================================================================
+
+	/**
+	 * @brief Pins the calling thread to a set of logical CPUs.
+	 * @param[in] cpus OS CPU numbers the thread may run on
+	 * @return true on success; false if the set is empty, not permitted or on non-Linux targets
+	 */
+	inline bool pinCurrentThread( std::span<const uint32_t> cpus ) noexcept;
+
+	/**
+	 * @brief Pins the calling thread to one logical CPU.
+	 * @param[in] cpu OS CPU number
+	 * @return true on success
+	 */
+	inline bool pinCurrentThread( uint32_t cpu ) noexcept;
+
+	/**
+	 * @brief Pins the calling thread to every CPU of a core class (e.g. P-cores only).
+	 * @param[in] type Core class
+	 * @return true on success; false if no CPU has that class
+	 * @note Reads topology(), which may throw std::bad_alloc on first use
+	 */
+	inline bool pinCurrentThreadToCoreType( CoreType type );
+
+	/**
+	 * @brief Pins the calling thread to every CPU of a NUMA node.
+	 * @details Combined with first-touch allocation this keeps a worker's data node-local.
+	 * @param[in] node NUMA node
+	 * @return true on success; false if the node has no CPUs
+	 * @note Reads topology(), which may throw std::bad_alloc on first use
+	 */
+	inline bool pinCurrentThreadToNode( uint32_t node );
+
+	//=====================================================================
+	// Processor identification
+	//=====================================================================
+
+	/** @brief CPU vendor (CPUID leaf 0 signature). */
+	enum class Vendor : uint8_t
+	{
+		Unknown = 0,
+		Intel, ///< "GenuineIntel"
+		AMD,   ///< "AuthenticAMD"
+		Hygon  ///< "HygonGenuine" (Zen-derived)
+	};
+
+	/** @brief Core microarchitecture, decoded from vendor, family and model. */
+	enum class Microarchitecture : uint8_t
+	{
+		Unknown = 0,
+
+		// Intel big cores
+		Nehalem,
+		Westmere,
+		SandyBridge,
+		IvyBridge,
+		Haswell,
+		Broadwell,
+		Skylake,		///< Skylake client and its refreshes (Kaby, Coffee, Comet Lake)
+		SkylakeServer,	///< Skylake-SP / -X (AVX-512 frequency licenses)
+		CascadeLake,	///< Skylake-SP stepping 5-7
+		CooperLake,		///< Skylake-SP stepping 10-11
+		IceLakeClient,
+		IceLakeServer,
+		TigerLake,
+		RocketLake,
+		AlderLake,		///< Hybrid (Golden Cove + Gracemont)
+		RaptorLake,		///< Hybrid (Raptor Cove + Gracemont)
+		MeteorLake,		///< Hybrid (Redwood Cove + Crestmont)
+		SapphireRapids,
+		EmeraldRapids,
+		GraniteRapids,
+
+		// Intel Atom cores
+		Goldmont,
+		GoldmontPlus,
+		Tremont,
+		Gracemont,
+		SierraForest,
+
+		// AMD cores
+		Zen,
+		ZenPlus,
+		Zen2,
+		Zen3,
+		Zen4,
+		Zen5
+	};
+
+	/** @brief Identity of the processor. */
+	struct CpuIdentity
+	{
+		Vendor vendor{ Vendor::Unknown };								   ///< Vendor
+		uint32_t family{ 0 };											   ///< Display family (base + extended)
+		uint32_t model{ 0 };											   ///< Display model (extended << 4 | base)
+		uint32_t stepping{ 0 };											   ///< Stepping
+		Microarchitecture microarchitecture{ Microarchitecture::Unknown }; ///< Decoded microarchitecture
+		char brand[49]{};												   ///< Brand string (CPUID 0x80000002-4)
+	};
+
+	/**
+	 * @brief Gets the process-wide processor identity.
+	 * @details Decoded once on first call and stored like features().
+	 * @return Reference to the identity, valid for the lifetime of the process
+	 */
+	[[nodiscard]] inline const CpuIdentity& identity() noexcept;
+
+	/**
+	 * @brief Maps vendor, display family, model and stepping to a microarchitecture.
+	 * @param[in] vendor CPU vendor
+	 * @param[in] family Display family
+	 * @param[in] model Display model
+	 * @param[in] stepping Stepping (separates Skylake-SP, Cascade Lake and Cooper Lake)
+	 * @return Microarchitecture, or Microarchitecture::Unknown for unlisted parts
+	 */
+	[[nodiscard]] inline constexpr Microarchitecture decodeMicroarchitecture( Vendor vendor, uint32_t family, uint32_t model, uint32_t stepping ) noexcept;
+
+	/**
+	 * @brief Gets the name of a microarchitecture.
+	 * @param[in] microarchitecture Microarchitecture
+	 * @return Name such as "Zen3", or "Unknown"
+	 */
+	[[nodiscard]] inline constexpr std::string_view microarchitectureName( Microarchitecture microarchitecture ) noexcept;
+
+	//=====================================================================
+	// Tuning parameters
+	//=====================================================================
+
+	/**
+	 * @brief Performance characteristics that ISA flags alone do not tell.
+	 * @details Consulted by dispatchers (see dispatchFeatures()) and bulk kernels to pick
+	 *          the fastest implementation rather than merely a supported one.
+	 */
+	struct TuningParameters
+	{
+		bool fastPdepPext{ true }; ///< PDEP / PEXT execute in hardware (microcoded on Zen, Zen+ and Zen 2)
+		bool preferAvx512{ true }; ///< 512-bit code does not cost a frequency license (false on Skylake-SP family)
+		uint8_t crc32Streams{ 3 }; ///< Independent CRC32 streams needed to hide latency (latency / throughput: 3 / 1 on Intel cores, Atom cores and Zen 3+; 3 / 3 on Zen through Zen 2)
+	};
+
+	/**
+	 * @brief Gets the tuning parameters for a microarchitecture.
+	 * @param[in] microarchitecture Microarchitecture
+	 * @return Table entry; defaults for Microarchitecture::Unknown
+	 */
+	[[nodiscard]] inline constexpr TuningParameters tuningFor( Microarchitecture microarchitecture ) noexcept;
+
+	/**
+	 * @brief Gets the tuning parameters of the host.
+	 * @details tuningFor( identity().microarchitecture ), with AVX-512 preference cleared
+	 *          when AVX-512 is unavailable and PDEP / PEXT marked slow without BMI2.
+	 * @return Reference to the host parameters, valid for the lifetime of the process
+	 */
+	[[nodiscard]] inline const TuningParameters& tuning() noexcept;
 } // namespace nfx::core::cpu
 
 #include "nfx/detail/core/CPU.inl"
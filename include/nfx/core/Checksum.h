@@ -0,0 +1,154 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Checksum.h
+ * @brief Standard CRC32-C (Castagnoli) checksums
+ * @details iSCSI / ext4 / SCTP compatible CRC32-C with the standard initial value and
+ *          final XOR, computed by hardware CRC32 instructions over interleaved streams
+ *          where available, with a slicing-by-8 software fallback. Includes incremental
+ *          extension, combination of independently computed CRCs and in-place
+ *          store / verify helpers for blocks carrying a trailing CRC.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace nfx::core::checksum
+{
+	namespace constants
+	{
+		//=====================================================================
+		// CRC32-C constants
+		//=====================================================================
+
+		/** @brief Castagnoli polynomial 0x1EDC6F41, bit-reflected. */
+		inline constexpr uint32_t CRC32C_POLYNOMIAL{ 0x82F63B78 };
+
+		/** @brief Register value before the first byte. */
+		inline constexpr uint32_t CRC32C_INITIAL{ 0xFFFFFFFF };
+
+		/** @brief Value XORed into the register after the last byte. */
+		inline constexpr uint32_t CRC32C_FINAL_XOR{ 0xFFFFFFFF };
+
+		/** @brief CRC32-C of any data followed by its own CRC stored little-endian. */
+		inline constexpr uint32_t CRC32C_RESIDUE{ 0x48674BC7 };
+
+		/** @brief Bytes of a stored CRC. */
+		inline constexpr size_t CRC32C_SIZE{ 4 };
+
+		/** @brief Bytes each stream covers per round of the interleaved hardware kernel. */
+		inline constexpr size_t CRC32C_STREAM_BLOCK{ 256 };
+	} // namespace constants
+
+	//=====================================================================
+	// CRC32-C
+	//=====================================================================
+
+	/**
+	 * @brief Computes the CRC32-C of a buffer.
+	 * @param[in] data Bytes to checksum
+	 * @return Standard CRC32-C (e.g. 0xE3069283 for "123456789")
+	 * @details Uses the best kernel for the host, selected once through a cpu::Dispatcher:
+	 *          SSE4.2 `crc32` over cpu::tuning().crc32Streams interleaved streams for long
+	 *          buffers (one stream for short ones), else slicing-by-8 tables. Every kernel
+	 *          produces identical results.
+	 *
+	 *          Unlike hashing::hashStringView(), which uses the same polynomial with the FNV
+	 *          offset basis as seed and no final XOR, this is the checksum defined by RFC 3720
+	 *          and used by iSCSI, SCTP, ext4 and Btrfs.
+	 */
+	[[nodiscard]] inline uint32_t crc32c( std::span<const std::byte> data ) noexcept;
+
+	/**
+	 * @brief Computes the CRC32-C of a string's bytes.
+	 * @param[in] data Bytes to checksum
+	 * @return Standard CRC32-C
+	 */
+	[[nodiscard]] inline uint32_t crc32c( std::string_view data ) noexcept;
+
+	/**
+	 * @brief Continues a CRC32-C over more data.
+	 * @param[in] crc CRC32-C of the preceding data (0 for none)
+	 * @param[in] data Bytes that follow
+	 * @return CRC32-C of the preceding data followed by `data`
+	 * @details `crc32cExtend( crc32c( a ), b ) == crc32c( a + b )`, so a stream can be
+	 *          checksummed in pieces.
+	 */
+	[[nodiscard]] inline uint32_t crc32cExtend( uint32_t crc, std::span<const std::byte> data ) noexcept;
+
+	/**
+	 * @brief Combines the CRC32-Cs of two adjacent pieces.
+	 * @param[in] crcA CRC32-C of the first piece
+	 * @param[in] crcB CRC32-C of the second piece
+	 * @param[in] lengthB Bytes in the second piece
+	 * @return CRC32-C of both pieces concatenated, without reading either
+	 * @details Lets pieces be checksummed on different threads. Costs O(log lengthB).
+	 */
+	[[nodiscard]] inline uint32_t crc32cCombine( uint32_t crcA, uint32_t crcB, size_t lengthB ) noexcept;
+
+	//=====================================================================
+	// Blocks with a trailing CRC
+	//=====================================================================
+
+	/**
+	 * @brief Stores the CRC32-C of a block's payload in its last 4 bytes.
+	 * @param[in,out] block Payload followed by 4 bytes that receive the CRC (little-endian)
+	 * @return The stored CRC; 0 and nothing written if the block is shorter than 4 bytes
+	 */
+	inline uint32_t storeCrc32c( std::span<std::byte> block ) noexcept;
+
+	/**
+	 * @brief Verifies a block written by storeCrc32c().
+	 * @param[in] block Payload followed by its CRC32-C (little-endian)
+	 * @return true if the stored CRC matches the payload
+	 * @details One pass over the whole block: a payload followed by its own CRC always
+	 *          checksums to constants::CRC32C_RESIDUE, so nothing is split or copied.
+	 */
+	[[nodiscard]] inline bool verifyCrc32c( std::span<const std::byte> block ) noexcept;
+
+	/**
+	 * @brief Verifies data against a separately stored CRC32-C.
+	 * @param[in] data Bytes to check
+	 * @param[in] expected CRC32-C recorded for them
+	 * @return true if they match
+	 */
+	[[nodiscard]] inline bool verifyCrc32c( std::span<const std::byte> data, uint32_t expected ) noexcept;
+
+	//=====================================================================
+	// Introspection
+	//=====================================================================
+
+	/**
+	 * @brief Gets the name of the kernel crc32c() uses on this host.
+	 * @return "sse42" or "software"
+	 */
+	[[nodiscard]] inline std::string_view crc32cImplementation() noexcept;
+} // namespace nfx::core::checksum
+
+#include "nfx/detail/core/Checksum.inl"
@@ -0,0 +1,134 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ConsistentHashing.h
+ * @brief Consistent hashing for shard routing
+ * @details Jump consistent hash and weighted rendezvous (highest random weight) hashing
+ *          built on the nfx hash primitives, with batch routing for many keys at once
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace nfx::core::hashing
+{
+	namespace constants
+	{
+		//=====================================================================
+		// Consistent hashing constants
+		//=====================================================================
+
+		/** @brief 64-bit LCG multiplier used by jump consistent hash. */
+		inline constexpr uint64_t DEFAULT_JUMP_HASH_LCG{ 2862933555777941757ULL }; // Lamping & Veach (2014)
+	} // namespace constants
+
+	//=====================================================================
+	// Consistent hashing
+	//=====================================================================
+
+	//----------------------------------------------
+	// Jump consistent hash
+	//----------------------------------------------
+
+	/**
+	 * @brief Maps a key hash to one of `buckets` shards with jump consistent hash.
+	 * @param[in] hash 64-bit hash of the key (e.g. `hashInteger` or `hashStringView` output)
+	 * @param[in] buckets Number of shards; must be greater than 0
+	 * @return Shard index in [0, buckets), or 0 when `buckets` is 0
+	 * @details Growing from n to n + 1 shards moves only ~1/(n + 1) of the keys, all of them
+	 *          to the new shard. Shards can only be added or removed at the end of the range;
+	 *          use rendezvousHash() when arbitrary nodes can leave.
+	 *
+	 *          **Performance:** O(ln n) iterations of a multiply and a floating-point divide,
+	 *          no memory lookups and no state.
+	 * @see https://arxiv.org/abs/1406.2294
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline constexpr uint32_t jumpConsistentHash( uint64_t hash, uint32_t buckets ) noexcept;
+
+	/**
+	 * @brief Routes a batch of key hashes with jump consistent hash.
+	 * @param[in] hashes 64-bit hashes of the keys
+	 * @param[in] buckets Number of shards; must be greater than 0
+	 * @param[out] shards Receives one shard index per hash; must be at least as large as `hashes`
+	 */
+	inline void jumpConsistentHash( std::span<const uint64_t> hashes, uint32_t buckets, std::span<uint32_t> shards ) noexcept;
+
+	//----------------------------------------------
+	// Rendezvous (highest random weight) hashing
+	//----------------------------------------------
+
+	/**
+	 * @brief Rendezvous hashing node description.
+	 * @details `id` is a stable 64-bit identifier of the node (for example the
+	 *          `hashStringView` of its address); it must not change when other nodes
+	 *          join or leave. `weight` is the node's relative capacity.
+	 */
+	struct RendezvousNode
+	{
+		uint64_t id;		///< Stable node identifier hash
+		double weight{ 1.0 }; ///< Relative capacity (must be > 0)
+	};
+
+	/**
+	 * @brief Selects the node for a key with weighted rendezvous hashing.
+	 * @param[in] hash 64-bit hash of the key
+	 * @param[in] nodes Candidate nodes
+	 * @return Index of the selected node in `nodes`, or `nodes.size()` if `nodes` is empty
+	 * @details Each (key, node) pair is scored by `combine(hash, node.id)` mapped to a
+	 *          uniform u in (0, 1), then weighted as `-weight / ln(u)` (logarithmic method).
+	 *          The highest score wins, so a node receives a share of keys proportional to
+	 *          its weight, and removing a node only moves the keys it owned.
+	 *
+	 *          **Performance:** O(n) per key; intended for tens to hundreds of nodes.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline size_t rendezvousHash( uint64_t hash, std::span<const RendezvousNode> nodes ) noexcept;
+
+	/**
+	 * @brief Selects the node for a key with unweighted rendezvous hashing.
+	 * @param[in] hash 64-bit hash of the key
+	 * @param[in] nodeIds Stable node identifier hashes
+	 * @return Index of the selected node, or `nodeIds.size()` if `nodeIds` is empty
+	 * @details Equal-weight fast path: picks the node maximizing `combine(hash, id)`
+	 *          without any floating-point work.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline constexpr size_t rendezvousHash( uint64_t hash, std::span<const uint64_t> nodeIds ) noexcept;
+
+	/**
+	 * @brief Routes a batch of key hashes with weighted rendezvous hashing.
+	 * @param[in] hashes 64-bit hashes of the keys
+	 * @param[in] nodes Candidate nodes
+	 * @param[out] selected Receives one node index per hash; must be at least as large as `hashes`
+	 * @details Node weights are converted once per batch rather than once per key.
+	 */
+	inline void rendezvousHash( std::span<const uint64_t> hashes, std::span<const RendezvousNode> nodes, std::span<size_t> selected ) noexcept;
+} // namespace nfx::core::hashing
+
+#include "nfx/detail/core/ConsistentHashing.inl"
@@ -0,0 +1,338 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file CountMinSketch.h
+ * @brief Count-Min frequency sketch and space-saving top-k tracker
+ * @details Conservative-update Count-Min sketch whose row indices are derived from a
+ *          single hash by double hashing, paired with a bounded space-saving summary
+ *          for heavy-hitter (hot key) detection
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace nfx::core::sketch
+{
+	namespace constants
+	{
+		//=====================================================================
+		// Count-Min constants
+		//=====================================================================
+
+		/** @brief Default number of Count-Min rows (failure probability ~e^-4). */
+		inline constexpr size_t CMS_DEFAULT_DEPTH{ 4 };
+
+		/** @brief Keys hashed and prefetched together by the Count-Min batch update. */
+		inline constexpr size_t CMS_BATCH_SIZE{ 8 };
+
+		/** @brief Largest Count-Min row width (2^32 counters on 64-bit targets). */
+		inline constexpr size_t CMS_MAX_WIDTH{ size_t{ 1 } << ( std::numeric_limits<size_t>::digits / 2 ) };
+	} // namespace constants
+
+	//=====================================================================
+	// CountMinSketch class
+	//=====================================================================
+
+	/**
+	 * @brief Conservative-update Count-Min sketch
+	 * @tparam Depth Number of rows d (independent counters consulted per key)
+	 * @tparam Allocator Allocator of the counter array, e.g. memory::ArenaAllocator<uint32_t>
+	 *         to place wide sketches on huge pages of one NUMA node
+	 *
+	 * @details Estimates per-key frequencies in a fixed `Depth x width` array of 32-bit
+	 *          counters. Estimates never undercount; with width w the overcount is at most
+	 *          e/w of the total stream weight with probability 1 - e^-d.
+	 *
+	 *          **Indexing:** A key is identified by one hash (`hashInteger`, `hashStringView`
+	 *          or `combine` output). It is finalized with the 64-bit `hashInteger` mixer and
+	 *          split into h1/h2; row i uses `(h1 + i * h2) & (width - 1)` (Kirsch-Mitzenmacher
+	 *          double hashing), so no additional hash functions are evaluated per row.
+	 *
+	 *          **Conservative update:** Only the counters equal to the current minimum are
+	 *          raised, which sharply reduces overestimation on skewed (Zipfian) streams.
+	 *
+	 *          **Thread safety:** Not synchronized. Keep one sketch per thread and combine
+	 *          them with merge(); the merged sketch still never undercounts.
+	 */
+	template <size_t Depth = constants::CMS_DEFAULT_DEPTH, typename Allocator = std::allocator<uint32_t>>
+	class CountMinSketch final
+	{
+		static_assert( Depth >= 1 && Depth <= 16, "Count-Min depth must be in [1, 16]" );
+
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Creates a sketch with the given number of counters per row.
+		 * @param[in] width Counters per row; rounded up to the next power of 2 and clamped
+		 *                  to [16, constants::CMS_MAX_WIDTH]
+		 * @param[in] allocator Allocator of the counter array
+		 */
+		inline explicit CountMinSketch( size_t width, const Allocator& allocator = Allocator{} );
+
+		/**
+		 * @brief Creates a sketch sized for an additive error bound.
+		 * @param[in] epsilon Relative overcount bound (fraction of total stream weight);
+		 *                    must be positive and finite
+		 * @param[in] allocator Allocator of the counter array
+		 * @return Sketch whose width is at least e / epsilon, capped at constants::CMS_MAX_WIDTH
+		 * @throws std::invalid_argument if @p epsilon is not positive or not finite
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static inline CountMinSketch fromErrorRate( double epsilon, const Allocator& allocator = Allocator{} );
+
+		//----------------------------------------------
+		// Updates
+		//----------------------------------------------
+
+		/**
+		 * @brief Adds occurrences of a key using conservative update.
+		 * @param[in] hash Hash of the key
+		 * @param[in] count Occurrences to add
+		 * @return The key's estimated frequency after the update
+		 */
+		inline uint32_t add( uint64_t hash, uint32_t count = 1 ) noexcept;
+
+		/**
+		 * @brief Adds one occurrence of each key in a batch.
+		 * @param[in] hashes Hashes of the keys
+		 * @details Row indices for groups of constants::CMS_BATCH_SIZE keys are computed
+		 *          and prefetched before any counter is touched, so the cache misses of
+		 *          one group overlap instead of being paid one key at a time.
+		 */
+		inline void add( std::span<const uint64_t> hashes ) noexcept;
+
+		//----------------------------------------------
+		// Queries
+		//----------------------------------------------
+
+		/**
+		 * @brief Estimates the frequency of a key.
+		 * @param[in] hash Hash of the key
+		 * @return Estimated frequency (never less than the true frequency)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline uint32_t estimate( uint64_t hash ) const noexcept;
+
+		/**
+		 * @brief Gets the total weight added to the sketch.
+		 * @return Sum of all counts added (including merged sketches)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline uint64_t totalCount() const noexcept;
+
+		/**
+		 * @brief Gets the number of counters per row.
+		 * @return Row width (power of 2)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline size_t width() const noexcept;
+
+		/**
+		 * @brief Gets the number of rows.
+		 * @return Depth template parameter
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static constexpr size_t depth() noexcept { return Depth; }
+
+		//----------------------------------------------
+		// Merging and reset
+		//----------------------------------------------
+
+		/**
+		 * @brief Adds another sketch's counters into this one.
+		 * @param[in] other Sketch with the same width, typically built by another thread
+		 * @return `true` on success, `false` if the widths differ (nothing is merged)
+		 * @details Counters are summed with saturation. Summing conservative-update
+		 *          sketches keeps the no-undercount guarantee.
+		 */
+		inline bool merge( const CountMinSketch& other ) noexcept;
+
+		/** @brief Resets all counters to zero. */
+		inline void clear() noexcept;
+
+	private:
+		//----------------------------------------------
+		// Private implementation
+		//----------------------------------------------
+
+		[[nodiscard]] inline std::array<size_t, Depth> indices( uint64_t hash ) const noexcept;
+
+		inline uint32_t update( const std::array<size_t, Depth>& slots, uint32_t count ) noexcept;
+
+		size_t m_width;
+		size_t m_mask;
+		uint64_t m_total{ 0 };
+		std::vector<uint32_t, Allocator> m_counters;
+	};
+
+	//=====================================================================
+	// TopK class
+	//=====================================================================
+
+	/**
+	 * @brief Bounded space-saving heavy-hitter tracker
+	 * @tparam Key Key type stored for reporting
+	 * @tparam Hash Hash functor for the internal key index
+	 *
+	 * @details Tracks at most `capacity` keys in a binary min-heap ordered by count.
+	 *          Any key whose true frequency exceeds total / capacity is guaranteed to be
+	 *          tracked. Each entry carries an error bound: the count it inherited from
+	 *          the entry it evicted.
+	 *
+	 *          **Standalone:** add() implements the classic space-saving algorithm.
+	 *
+	 *          **Paired with CountMinSketch:** offer() takes the sketch's estimate for a key,
+	 *          so counts come from the sketch and the tracker only decides membership.
+	 */
+	template <typename Key, typename Hash = std::hash<Key>>
+	class TopK final
+	{
+	public:
+		//----------------------------------------------
+		// Public types
+		//----------------------------------------------
+
+		/** @brief Tracked key with its estimated count and overestimation bound. */
+		struct Entry
+		{
+			Key key;		///< Tracked key
+			uint64_t count; ///< Estimated frequency (upper bound)
+			uint64_t error; ///< Maximum overestimation included in count
+		};
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Creates a tracker for up to `capacity` keys.
+		 * @param[in] capacity Maximum number of tracked keys (minimum 1)
+		 */
+		inline explicit TopK( size_t capacity );
+
+		//----------------------------------------------
+		// Updates
+		//----------------------------------------------
+
+		/**
+		 * @brief Counts occurrences of a key (space-saving update).
+		 * @param[in] key Key observed
+		 * @param[in] count Occurrences to add
+		 */
+		inline void add( const Key& key, uint64_t count = 1 );
+
+		/**
+		 * @brief Offers a key with an externally estimated frequency.
+		 * @param[in] key Key observed
+		 * @param[in] estimate Current frequency estimate, e.g. from CountMinSketch::add()
+		 * @details Tracked keys take the larger of their count and the estimate; untracked
+		 *          keys replace the minimum entry only when their estimate exceeds it.
+		 */
+		inline void offer( const Key& key, uint64_t estimate );
+
+		/**
+		 * @brief Merges another tracker (e.g. from another thread) into this one.
+		 * @param[in] other Tracker to merge
+		 * @details Counts of keys tracked by both are summed. A key tracked by only one
+		 *          side gains the other side's minimum count (when that side is full) as
+		 *          both count and error. The largest `capacity` entries are kept.
+		 */
+		inline void merge( const TopK& other );
+
+		/** @brief Removes all tracked keys. */
+		inline void clear() noexcept;
+
+		//----------------------------------------------
+		// Queries
+		//----------------------------------------------
+
+		/**
+		 * @brief Gets the tracked keys ordered by descending count.
+		 * @return Tracked entries, heaviest first
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::vector<Entry> entries() const;
+
+		/**
+		 * @brief Checks whether a key is currently tracked.
+		 * @param[in] key Key to look up
+		 * @return `true` if tracked
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool contains( const Key& key ) const;
+
+		/**
+		 * @brief Gets the smallest tracked count (0 while not full).
+		 * @return Admission threshold for new keys
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline uint64_t minCount() const noexcept;
+
+		/**
+		 * @brief Gets the number of tracked keys.
+		 * @return Tracked key count
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline size_t size() const noexcept;
+
+		/**
+		 * @brief Gets the maximum number of tracked keys.
+		 * @return Capacity
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline size_t capacity() const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Private implementation
+		//----------------------------------------------
+
+		inline void siftUp( size_t pos );
+
+		inline void siftDown( size_t pos );
+
+		inline void swapEntries( size_t a, size_t b );
+
+		inline void replaceMin( const Key& key, uint64_t count, uint64_t error );
+
+		size_t m_capacity;
+		std::vector<Entry> m_heap;
+		std::unordered_map<Key, size_t, Hash> m_index;
+	};
+} // namespace nfx::core::sketch
+
+#include "nfx/detail/core/CountMinSketch.inl"
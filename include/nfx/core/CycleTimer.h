@@ -0,0 +1,153 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/**
+ * @file CycleTimer.h
+ * @brief Low-overhead cycle-counter timing for hot-path instrumentation
+ * @details Reads the time-stamp counter (RDTSC / RDTSCP on x86, CNTVCT_EL0 on AArch64)
+ *          with selectable ordering, calibrates its frequency once and converts cycles
+ *          to nanoseconds. Falls back to `std::chrono::steady_clock` elsewhere.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "nfx/core/CPU.h"
+
+namespace nfx::core::cpu
+{
+	//=====================================================================
+	// Counter reads
+	//=====================================================================
+
+	/**
+	 * @brief Ordering of a counter read relative to surrounding instructions.
+	 * @details Out-of-order execution lets a plain RDTSC run before earlier instructions
+	 *          finish or after later ones start. Bracket a measured region with
+	 *          `Begin` ... `End` for stable short measurements; use `Relaxed` for coarse
+	 *          timestamps where a few cycles of skew do not matter.
+	 */
+	enum class TscRead : uint8_t
+	{
+		Relaxed,   ///< RDTSC alone (cheapest)
+		Begin,	   ///< LFENCE; RDTSC - earlier instructions complete before the read
+		End,	   ///< RDTSCP; LFENCE - earlier instructions complete, later ones wait (needs RDTSCP)
+		Serialized ///< CPUID; RDTSC - full serialization; expensive, causes a VM exit under hypervisors
+	};
+
+	/**
+	 * @brief Reads the cycle counter.
+	 * @tparam Mode Ordering of the read
+	 * @return Counter value in ticks of tscInfo().frequencyHz
+	 * @note On non-x86 / non-AArch64 targets returns steady_clock nanoseconds
+	 */
+	template <TscRead Mode = TscRead::Relaxed>
+	[[nodiscard]] inline uint64_t readCycles() noexcept;
+
+	//=====================================================================
+	// Counter properties
+	//=====================================================================
+
+	/** @brief Properties and calibrated frequency of the cycle counter. */
+	struct TscInfo
+	{
+		bool invariant{ false };			///< Constant rate across P-/C-states (CPUID 0x80000007 EDX bit 8)
+		bool rdtscp{ false };				///< RDTSCP available (CPUID 0x80000001 EDX bit 27), required by TscRead::End
+		bool hypervisor{ false };			///< Running under a hypervisor (CPUID 1 ECX bit 31)
+		char hypervisorVendor[13]{};		///< Hypervisor signature (CPUID 0x40000000), e.g. "KVMKVMKVM"
+		bool frequencyFromCpuid{ false };	///< Frequency read from CPUID 0x15 rather than measured
+		double frequencyHz{ 0.0 };			///< Counter ticks per second
+		double nanosecondsPerCycle{ 0.0 };	///< 1e9 / frequencyHz
+
+		/**
+		 * @brief Checks whether cycle deltas can be trusted as wall time.
+		 * @details False without an invariant counter; under a hypervisor the counter may
+		 *          also be emulated or jump on migration, so treat it as advisory there.
+		 * @return true if the counter is invariant
+		 */
+		[[nodiscard]] inline bool reliable() const noexcept;
+	};
+
+	/**
+	 * @brief Gets the cycle counter properties, calibrating on first call.
+	 * @details The frequency comes from CPUID leaf 0x15 when it reports the crystal clock,
+	 *          from CNTFRQ_EL0 on AArch64, and otherwise from a ~20 ms measurement against
+	 *          steady_clock. Call it once during startup to keep calibration out of measured
+	 *          regions; later calls are plain loads.
+	 * @return Reference to the calibrated properties, valid for the lifetime of the process
+	 */
+	[[nodiscard]] inline const TscInfo& tscInfo() noexcept;
+
+	/**
+	 * @brief Converts a cycle count to nanoseconds.
+	 * @param[in] cycles Difference of two readCycles() values
+	 * @return Elapsed nanoseconds
+	 */
+	[[nodiscard]] inline double cyclesToNanoseconds( uint64_t cycles ) noexcept;
+
+	//=====================================================================
+	// CycleTimer class
+	//=====================================================================
+
+	/**
+	 * @brief Stopwatch over the cycle counter.
+	 * @details Starts with a `Begin` read and stops with an `End` read (or `Begin` when
+	 *          RDTSCP is unavailable), so the measured region cannot leak out of the bracket.
+	 *
+	 *          @code
+	 *          cpu::CycleTimer timer;
+	 *          lookup( key );
+	 *          double ns = timer.elapsedNanoseconds();
+	 *          @endcode
+	 */
+	class CycleTimer final
+	{
+	public:
+		/** @brief Starts timing. */
+		inline CycleTimer() noexcept;
+
+		/** @brief Restarts timing. */
+		inline void restart() noexcept;
+
+		/**
+		 * @brief Gets the cycles since construction or restart().
+		 * @return Elapsed counter ticks
+		 */
+		[[nodiscard]] inline uint64_t elapsedCycles() const noexcept;
+
+		/**
+		 * @brief Gets the nanoseconds since construction or restart().
+		 * @return Elapsed nanoseconds
+		 */
+		[[nodiscard]] inline double elapsedNanoseconds() const noexcept;
+
+	private:
+		bool m_rdtscp;	  ///< End reads may use RDTSCP
+		uint64_t m_start; ///< Counter value at start
+	};
+} // namespace nfx::core::cpu
+
+#include "nfx/detail/core/CycleTimer.inl"
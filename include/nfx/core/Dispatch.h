@@ -0,0 +1,466 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/**
+ * @file Dispatch.h
+ * @brief Runtime function multiversioning for SIMD kernels
+ * @details Dispatcher template that selects the best implementation of a kernel for the
+ *          host CPU once, caches the chosen function pointer, and lets tests and
+ *          benchmarks force lower tiers through an API mask or an environment variable
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "nfx/core/CPU.h"
+
+//=====================================================================
+// Target attribute
+//=====================================================================
+
+/**
+ * @brief Compiles one function for an instruction set beyond the build's baseline.
+ * @details Lets all variants of a kernel live in one translation unit without global
+ *          `-m` flags, e.g. `NFX_CORE_TARGET( "avx2" ) uint32_t sumAvx2( ... )`. Only call
+ *          such a function after checking the feature, typically through a Dispatcher.
+ *          Expands to nothing on MSVC, which accepts intrinsics without target flags.
+ */
+#if defined( __GNUC__ ) || defined( __clang__ )
+#	define NFX_CORE_TARGET( isa ) __attribute__( ( target( isa ) ) )
+#else
+#	define NFX_CORE_TARGET( isa )
+#endif
+
+//=====================================================================
+// Build configuration
+//=====================================================================
+
+/*
+ * NFX_CORE_BUILD_<FEATURE> is the Feature bit when the including translation unit is
+ * compiled with that extension enabled (-m flags, /arch), 0 otherwise. MSVC only defines
+ * __AVX__ / __AVX2__ / __AVX512*__, which imply the older extensions.
+ */
+#if defined( __SSE4_2__ ) || defined( __AVX__ )
+#	define NFX_CORE_BUILD_SSE42 ( 1u << 0 )
+#else
+#	define NFX_CORE_BUILD_SSE42 0u
+#endif
+#if defined( __POPCNT__ ) || defined( __AVX__ )
+#	define NFX_CORE_BUILD_POPCNT ( 1u << 1 )
+#else
+#	define NFX_CORE_BUILD_POPCNT 0u
+#endif
+#if defined( __PCLMUL__ )
+#	define NFX_CORE_BUILD_PCLMUL ( 1u << 2 )
+#else
+#	define NFX_CORE_BUILD_PCLMUL 0u
+#endif
+#if defined( __AES__ )
+#	define NFX_CORE_BUILD_AES ( 1u << 3 )
+#else
+#	define NFX_CORE_BUILD_AES 0u
+#endif
+#if defined( __AVX__ )
+#	define NFX_CORE_BUILD_AVX ( 1u << 4 )
+#else
+#	define NFX_CORE_BUILD_AVX 0u
+#endif
+#if defined( __AVX2__ )
+#	define NFX_CORE_BUILD_AVX2 ( 1u << 5 )
+#else
+#	define NFX_CORE_BUILD_AVX2 0u
+#endif
+#if defined( __BMI__ ) || ( defined( _MSC_VER ) && defined( __AVX2__ ) )
+#	define NFX_CORE_BUILD_BMI1 ( 1u << 6 )
+#else
+#	define NFX_CORE_BUILD_BMI1 0u
+#endif
+#if defined( __BMI2__ ) || ( defined( _MSC_VER ) && defined( __AVX2__ ) )
+#	define NFX_CORE_BUILD_BMI2 ( 1u << 7 )
+#else
+#	define NFX_CORE_BUILD_BMI2 0u
+#endif
+#if defined( __FMA__ ) || ( defined( _MSC_VER ) && defined( __AVX2__ ) )
+#	define NFX_CORE_BUILD_FMA ( 1u << 8 )
+#else
+#	define NFX_CORE_BUILD_FMA 0u
+#endif
+#if defined( __AVX512F__ )
+#	define NFX_CORE_BUILD_AVX512F ( 1u << 9 )
+#else
+#	define NFX_CORE_BUILD_AVX512F 0u
+#endif
+#if defined( __AVX512DQ__ )
+#	define NFX_CORE_BUILD_AVX512DQ ( 1u << 10 )
+#else
+#	define NFX_CORE_BUILD_AVX512DQ 0u
+#endif
+#if defined( __AVX512CD__ )
+#	define NFX_CORE_BUILD_AVX512CD ( 1u << 11 )
+#else
+#	define NFX_CORE_BUILD_AVX512CD 0u
+#endif
+#if defined( __AVX512BW__ )
+#	define NFX_CORE_BUILD_AVX512BW ( 1u << 12 )
+#else
+#	define NFX_CORE_BUILD_AVX512BW 0u
+#endif
+#if defined( __AVX512VL__ )
+#	define NFX_CORE_BUILD_AVX512VL ( 1u << 13 )
+#else
+#	define NFX_CORE_BUILD_AVX512VL 0u
+#endif
+#if defined( __SHA__ )
+#	define NFX_CORE_BUILD_SHA ( 1u << 14 )
+#else
+#	define NFX_CORE_BUILD_SHA 0u
+#endif
+
+/**
+ * @brief Features the including translation unit was compiled for, as a cpu::Feature.
+ * @details A macro rather than a function so it reflects the flags of the translation unit
+ *          that expands it; header-only kernels such as `hashing::crc32()` pick their
+ *          implementation from these same flags.
+ */
+#define NFX_CORE_COMPILED_FEATURES                                                                \
+	static_cast<::nfx::core::cpu::Feature>( NFX_CORE_BUILD_SSE42 | NFX_CORE_BUILD_POPCNT |        \
+											NFX_CORE_BUILD_PCLMUL | NFX_CORE_BUILD_AES |          \
+											NFX_CORE_BUILD_AVX | NFX_CORE_BUILD_AVX2 |            \
+											NFX_CORE_BUILD_BMI1 | NFX_CORE_BUILD_BMI2 |           \
+											NFX_CORE_BUILD_FMA | NFX_CORE_BUILD_AVX512F |         \
+											NFX_CORE_BUILD_AVX512DQ | NFX_CORE_BUILD_AVX512CD |   \
+											NFX_CORE_BUILD_AVX512BW | NFX_CORE_BUILD_AVX512VL |   \
+											NFX_CORE_BUILD_SHA )
+
+/**
+ * @brief Prints a warning to stderr if this translation unit misses host features.
+ * @details Call once at startup from the translation unit whose flags matter, typically
+ *          the one that calls the hashing functions.
+ * @return true if a warning was printed
+ */
+#define NFX_CORE_WARN_MISSED_FEATURES() ::nfx::core::cpu::warnMissedFeatures( NFX_CORE_COMPILED_FEATURES, stderr )
+
+namespace nfx::core::cpu
+{
+	namespace constants
+	{
+		//=====================================================================
+		// Dispatch constants
+		//=====================================================================
+
+		/**
+		 * @brief Environment variable listing features dispatchers must not use.
+		 * @details Comma-separated feature names (see featureName()), or `all` to force
+		 *          the baseline kernels, e.g. `NFX_CORE_DISABLE_FEATURES=avx2,avx512f`.
+		 */
+		inline constexpr const char* DISPATCH_DISABLE_ENV{ "NFX_CORE_DISABLE_FEATURES" };
+	} // namespace constants
+
+	//=====================================================================
+	// Feature sets
+	//=====================================================================
+
+	/**
+	 * @brief Instruction set extensions as combinable flags (mirrors CpuFeatures).
+	 * @details The `Fast*` flags are not instruction sets: they are set from tuning() when an
+	 *          extension is not only supported but also fast on the host, so a candidate can
+	 *          require e.g. `Feature::BMI2 | Feature::FastPdepPext` to skip microcoded PDEP.
+	 */
+	enum class Feature : uint32_t
+	{
+		None = 0,
+		SSE42 = 1u << 0,
+		POPCNT = 1u << 1,
+		PCLMUL = 1u << 2,
+		AES = 1u << 3,
+		AVX = 1u << 4,
+		AVX2 = 1u << 5,
+		BMI1 = 1u << 6,
+		BMI2 = 1u << 7,
+		FMA = 1u << 8,
+		AVX512F = 1u << 9,
+		AVX512DQ = 1u << 10,
+		AVX512CD = 1u << 11,
+		AVX512BW = 1u << 12,
+		AVX512VL = 1u << 13,
+		SHA = 1u << 14,
+		FastPdepPext = 1u << 15, ///< TuningParameters::fastPdepPext
+		FastAvx512 = 1u << 16,	 ///< TuningParameters::preferAvx512
+		All = ( 1u << 17 ) - 1
+	};
+
+	[[nodiscard]] inline constexpr Feature operator|( Feature lhs, Feature rhs ) noexcept;
+	[[nodiscard]] inline constexpr Feature operator&( Feature lhs, Feature rhs ) noexcept;
+	[[nodiscard]] inline constexpr Feature operator~( Feature features ) noexcept;
+
+	/**
+	 * @brief Checks whether a feature set contains every required feature.
+	 * @param[in] available Features that may be used
+	 * @param[in] required Features a kernel needs
+	 * @return true if all of `required` is in `available`
+	 */
+	[[nodiscard]] inline constexpr bool hasAll( Feature available, Feature required ) noexcept;
+
+	/**
+	 * @brief Converts a feature snapshot to a flag set.
+	 * @param[in] features Snapshot, typically features()
+	 * @return Flags of the supported features
+	 */
+	[[nodiscard]] inline constexpr Feature toFeatureSet( const CpuFeatures& features ) noexcept;
+
+	/**
+	 * @brief Converts tuning parameters to the `Fast*` flags.
+	 * @param[in] parameters Tuning, typically tuning()
+	 * @return Flags of the fast paths
+	 */
+	[[nodiscard]] inline constexpr Feature toFeatureSet( const TuningParameters& parameters ) noexcept;
+
+	/**
+	 * @brief Gets the lowercase name of a single feature flag.
+	 * @param[in] feature One flag
+	 * @return Name such as "avx2", or an empty view for combined or unknown flags
+	 */
+	[[nodiscard]] inline constexpr std::string_view featureName( Feature feature ) noexcept;
+
+	/**
+	 * @brief Parses a comma-separated feature list such as "avx2,avx512f".
+	 * @param[in] list Feature names; `all` selects every feature; unknown names are ignored
+	 * @return The named features
+	 */
+	[[nodiscard]] inline Feature parseFeatureList( std::string_view list ) noexcept;
+
+	/**
+	 * @brief Formats a feature set as a comma-separated list.
+	 * @param[in] features Feature flags
+	 * @return Names such as "sse42, avx2", or "none"
+	 */
+	[[nodiscard]] inline std::string describeFeatures( Feature features );
+
+	//=====================================================================
+	// Build configuration report
+	//=====================================================================
+
+	/** @brief Compile-time ISA features compared with the host. */
+	struct BuildReport
+	{
+		Feature compiled{ Feature::None };	  ///< Features the translation unit was compiled for
+		Feature detected{ Feature::None };	  ///< Features the host supports (toFeatureSet( features() ))
+		Feature missed{ Feature::None };	  ///< Supported by the host, not used by the build
+		Feature unsupported{ Feature::None }; ///< Used by the build, not supported by the host (will fault)
+
+		/**
+		 * @brief Checks whether the build matches the host.
+		 * @return true if nothing is missed or unsupported
+		 */
+		[[nodiscard]] inline constexpr bool matchesHost() const noexcept;
+	};
+
+	/**
+	 * @brief Compares compiled features with the host.
+	 * @param[in] compiled Compiled features; pass NFX_CORE_COMPILED_FEATURES
+	 * @return Report of missed and unsupported features
+	 */
+	[[nodiscard]] inline BuildReport buildReport( Feature compiled ) noexcept;
+
+	/**
+	 * @brief Writes a warning if the build misses host features or uses unsupported ones.
+	 * @param[in] compiled Compiled features; pass NFX_CORE_COMPILED_FEATURES
+	 * @param[in] stream Destination, e.g. stderr
+	 * @return true if a warning was written
+	 */
+	inline bool warnMissedFeatures( Feature compiled, std::FILE* stream );
+
+	//=====================================================================
+	// Dispatch mask
+	//=====================================================================
+
+	/**
+	 * @brief Restricts the features dispatchers may select from.
+	 * @details Applies to dispatchers resolved afterwards; call Dispatcher::reset() on
+	 *          dispatchers that already resolved. Pass Feature::All to lift the restriction.
+	 * @param[in] allowed Features dispatchers may use (intersected with the detected ones)
+	 */
+	inline void setDispatchMask( Feature allowed ) noexcept;
+
+	/**
+	 * @brief Gets the API restriction set by setDispatchMask().
+	 * @return Allowed features (Feature::All by default)
+	 */
+	[[nodiscard]] inline Feature dispatchMask() noexcept;
+
+	/**
+	 * @brief Gets the features dispatchers resolve against.
+	 * @details Detected features plus the tuning() `Fast*` flags, minus
+	 *          constants::DISPATCH_DISABLE_ENV, intersected with dispatchMask(). Dependent
+	 *          features are dropped with their base: without AVX there is no AVX2 or FMA,
+	 *          without AVX2 no AVX-512, without AVX-512F no subset or FastAvx512, and
+	 *          without BMI2 no FastPdepPext.
+	 * @return Usable features
+	 */
+	[[nodiscard]] inline Feature dispatchFeatures() noexcept;
+
+	//=====================================================================
+	// Dispatcher
+	//=====================================================================
+
+	/** @brief One implementation of a kernel and the features it needs. */
+	template <typename Signature>
+	struct DispatchCandidate;
+
+	template <typename R, typename... Args>
+	struct DispatchCandidate<R( Args... )>
+	{
+		const char* name;			 ///< Reported by Dispatcher::selectedName()
+		Feature required;			 ///< Features the implementation executes
+		R ( *function )( Args... ); ///< Implementation
+	};
+
+	template <typename Signature, size_t N>
+	class Dispatcher;
+
+	/**
+	 * @brief Selects and caches the best implementation of a kernel.
+	 * @tparam R Return type
+	 * @tparam Args Argument types
+	 * @tparam N Number of candidates
+	 *
+	 * @details Candidates are listed best first; the first one whose required features are
+	 *          all in dispatchFeatures() wins. The last candidate must require
+	 *          Feature::None and is used when nothing else qualifies; a `constinit` dispatcher
+	 *          without one does not compile, and any other aborts on construction.
+	 *
+	 *          Resolution happens on the first call (or explicitly through resolve(), e.g. from
+	 *          a static initializer, like an ifunc resolver). Afterwards each call is a relaxed
+	 *          load of the cached pointer and an indirect call - no feature checks. Dispatchers
+	 *          are constant-initialized, so they can be declared `inline constinit`:
+	 *
+	 *          @code
+	 *          inline constinit auto s_sum = cpu::makeDispatcher<uint64_t( std::span<const uint8_t> )>(
+	 *              cpu::DispatchCandidate<uint64_t( std::span<const uint8_t> )>{ "avx2", cpu::Feature::AVX2, &sumAvx2 },
+	 *              cpu::DispatchCandidate<uint64_t( std::span<const uint8_t> )>{ "scalar", cpu::Feature::None, &sumScalar } );
+	 *
+	 *          uint64_t total = s_sum( bytes );
+	 *          @endcode
+	 *
+	 *          **Thread safety:** concurrent first calls may resolve more than once; they all
+	 *          store the same pointer.
+	 */
+	template <typename R, typename... Args, size_t N>
+	class Dispatcher<R( Args... ), N> final
+	{
+		static_assert( N > 0, "Dispatcher needs at least one candidate" );
+
+	public:
+		using Function = R ( * )( Args... );
+		using Candidate = DispatchCandidate<R( Args... )>;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Creates an unresolved dispatcher.
+		 * @param[in] candidates Implementations, best first; the last must require Feature::None
+		 */
+		constexpr explicit Dispatcher( const std::array<Candidate, N>& candidates ) noexcept;
+
+		Dispatcher( const Dispatcher& ) = delete;
+		Dispatcher& operator=( const Dispatcher& ) = delete;
+
+		//----------------------------------------------
+		// Invocation
+		//----------------------------------------------
+
+		/**
+		 * @brief Calls the selected implementation, resolving it on first use.
+		 * @param[in] args Kernel arguments
+		 * @return The kernel's result
+		 */
+		inline R operator()( Args... args ) const;
+
+		//----------------------------------------------
+		// Resolution
+		//----------------------------------------------
+
+		/**
+		 * @brief Selects against dispatchFeatures() and caches the result.
+		 * @return The selected implementation
+		 */
+		inline Function resolve() const noexcept;
+
+		/**
+		 * @brief Selects against an explicit feature set and caches the result.
+		 * @details Used by tests and benchmarks to pin every tier in turn, e.g.
+		 *          `resolve( dispatchFeatures() & ~Feature::AVX2 )`.
+		 * @param[in] available Features the selection may use
+		 * @return The selected implementation
+		 */
+		inline Function resolve( Feature available ) const noexcept;
+
+		/** @brief Forgets the selection; the next call resolves again. */
+		inline void reset() noexcept;
+
+		//----------------------------------------------
+		// Introspection
+		//----------------------------------------------
+
+		/**
+		 * @brief Gets the name of the selected implementation, resolving if needed.
+		 * @return Candidate name
+		 */
+		[[nodiscard]] inline std::string_view selectedName() const noexcept;
+
+		/**
+		 * @brief Gets all candidates, best first.
+		 * @return View of the candidate list
+		 */
+		[[nodiscard]] inline std::span<const Candidate> candidates() const noexcept;
+
+	private:
+		std::array<Candidate, N> m_candidates;
+		mutable std::atomic<Function> m_function{ nullptr };
+		mutable std::atomic<size_t> m_selected{ N };
+	};
+
+	/**
+	 * @brief Builds a dispatcher from candidates listed best first.
+	 * @tparam Signature Kernel function type, e.g. `uint32_t( std::string_view )`
+	 * @param[in] candidates Implementations
+	 * @return Unresolved dispatcher
+	 */
+	template <typename Signature, typename... Candidates>
+	[[nodiscard]] inline constexpr Dispatcher<Signature, sizeof...( Candidates )> makeDispatcher( const Candidates&... candidates ) noexcept;
+} // namespace nfx::core::cpu
+
+#include "nfx/detail/core/Dispatch.inl"
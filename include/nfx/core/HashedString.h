@@ -0,0 +1,293 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file HashedString.h
+ * @brief Strings carrying their precomputed hashStringView() hash
+ * @details HashedStringView (non-owning) and HashedString (owning) hash their bytes once
+ *          and hand the cached hash to every later layer: hashStringView(), seedMix(),
+ *          lookupBatch() and standard unordered containers
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "nfx/core/Hashing.h"
+
+namespace nfx::core::hashing
+{
+	//=====================================================================
+	// HashedStringView class
+	//=====================================================================
+
+	/**
+	 * @brief Non-owning string reference with its hashStringView() hash
+	 *
+	 * @details The hash is computed once, eagerly at construction or lazily on the first
+	 *          hash() call (deferred()), and reused by every consumer that accepts the type.
+	 *          Equality compares the cached hashes (and lengths) before any byte, via
+	 *          hashedKeysEqual().
+	 *
+	 *          A deferred view caches the hash in a mutable member: do not share one deferred
+	 *          instance across threads before its hash is computed.
+	 */
+	class HashedStringView final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Creates an empty view with the hash of the empty string. */
+		inline HashedStringView() noexcept;
+
+		/**
+		 * @brief Hashes a string eagerly.
+		 * @param[in] text Referenced bytes; must outlive the view
+		 */
+		inline HashedStringView( std::string_view text ) noexcept;
+
+		/** @brief Hashes a C string eagerly. */
+		inline HashedStringView( const char* text ) noexcept;
+
+		/** @brief Hashes a std::string eagerly. */
+		inline HashedStringView( const std::string& text ) noexcept;
+
+		/**
+		 * @brief Wraps bytes whose hashStringView() hash is already known.
+		 * @param[in] text Referenced bytes
+		 * @param[in] hash hashStringView( text ), e.g. stored next to the key
+		 */
+		inline constexpr HashedStringView( std::string_view text, uint32_t hash ) noexcept;
+
+		/**
+		 * @brief Wraps bytes and defers hashing to the first hash() call.
+		 * @param[in] text Referenced bytes
+		 * @return View without a computed hash
+		 */
+		[[nodiscard]] static inline constexpr HashedStringView deferred( std::string_view text ) noexcept;
+
+		//----------------------------------------------
+		// Accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Gets the cached hash, computing it first for a deferred view.
+		 * @return hashStringView( view() )
+		 */
+		[[nodiscard]] inline uint32_t hash() const noexcept;
+
+		/**
+		 * @brief Checks whether the hash has been computed.
+		 * @return false only for a deferred view before its first hash() call
+		 */
+		[[nodiscard]] inline constexpr bool hasHash() const noexcept;
+
+		/** @brief Gets the referenced bytes. */
+		[[nodiscard]] inline constexpr std::string_view view() const noexcept;
+
+		/** @brief Gets the number of referenced bytes. */
+		[[nodiscard]] inline constexpr size_t size() const noexcept;
+
+		/** @brief Checks whether the view is empty. */
+		[[nodiscard]] inline constexpr bool empty() const noexcept;
+
+		/** @brief Converts to the referenced bytes (the hash is dropped). */
+		inline constexpr operator std::string_view() const noexcept;
+
+		//----------------------------------------------
+		// Comparison
+		//----------------------------------------------
+
+		/** @brief Compares hashes and lengths, then bytes. */
+		friend inline bool operator==( const HashedStringView& lhs, const HashedStringView& rhs ) noexcept;
+
+	private:
+		inline constexpr HashedStringView( std::string_view text, uint32_t hash, bool hashed ) noexcept;
+
+		std::string_view m_text;  ///< Referenced bytes
+		mutable uint32_t m_hash;  ///< hashStringView( m_text ) once m_hashed is set
+		mutable bool m_hashed;	  ///< Whether m_hash is valid
+	};
+
+	//=====================================================================
+	// HashedString class
+	//=====================================================================
+
+	/**
+	 * @brief Owning string with its hashStringView() hash
+	 * @details Hashes eagerly at construction; the hash is kept in sync because the
+	 *          string is immutable. Converts to a HashedStringView without rehashing.
+	 */
+	class HashedString final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Creates an empty string. */
+		inline HashedString();
+
+		/** @brief Copies and hashes a string. */
+		inline explicit HashedString( std::string text );
+
+		/** @brief Copies and hashes a string view. */
+		inline explicit HashedString( std::string_view text );
+
+		/** @brief Copies and hashes a C string. */
+		inline explicit HashedString( const char* text );
+
+		/** @brief Copies the bytes of a view and reuses its hash. */
+		inline explicit HashedString( const HashedStringView& text );
+
+		//----------------------------------------------
+		// Accessors
+		//----------------------------------------------
+
+		/** @brief Gets the cached hash. */
+		[[nodiscard]] inline uint32_t hash() const noexcept;
+
+		/** @brief Gets the owned bytes. */
+		[[nodiscard]] inline const std::string& str() const noexcept;
+
+		/** @brief Gets the owned bytes as a view. */
+		[[nodiscard]] inline std::string_view view() const noexcept;
+
+		/** @brief Gets the number of bytes. */
+		[[nodiscard]] inline size_t size() const noexcept;
+
+		/** @brief Checks whether the string is empty. */
+		[[nodiscard]] inline bool empty() const noexcept;
+
+		/** @brief Views the string with its hash (no rehash). */
+		inline operator HashedStringView() const noexcept;
+
+		//----------------------------------------------
+		// Comparison
+		//----------------------------------------------
+
+		/** @brief Compares hashes and lengths, then bytes. */
+		friend inline bool operator==( const HashedString& lhs, const HashedString& rhs ) noexcept;
+
+		/** @brief Compares hashes and lengths, then bytes. */
+		friend inline bool operator==( const HashedString& lhs, const HashedStringView& rhs ) noexcept;
+
+	private:
+		std::string m_text; ///< Owned bytes
+		uint32_t m_hash;	///< hashStringView( m_text )
+	};
+
+	//=====================================================================
+	// Comparison with plain strings
+	//=====================================================================
+
+	/**
+	 * @brief Plain string types (std::string_view, std::string, C strings) compared without hashing.
+	 * @details Excludes the pre-hashed types, which compare their cached hashes first.
+	 */
+	template <typename Text>
+	concept PlainText = std::is_convertible_v<const Text&, std::string_view> &&
+						!std::is_same_v<Text, HashedStringView> && !std::is_same_v<Text, HashedString>;
+
+	/**
+	 * @brief Compares lengths, then bytes, with a plain string; the plain string is not hashed.
+	 * @details Selected by `std::equal_to<>` when a container keyed by HashedString is probed
+	 *          with a std::string_view through HashedStringHash: the probe is hashed once by the
+	 *          hash functor, not once per bucket comparison.
+	 */
+	template <PlainText Text>
+	[[nodiscard]] inline bool operator==( const HashedStringView& lhs, const Text& rhs ) noexcept;
+
+	/** @copydoc operator==( const HashedStringView&, const Text& ) */
+	template <PlainText Text>
+	[[nodiscard]] inline bool operator==( const HashedString& lhs, const Text& rhs ) noexcept;
+
+	//=====================================================================
+	// Hashing without rehashing
+	//=====================================================================
+
+	/**
+	 * @brief Returns the cached hash of a pre-hashed string.
+	 * @param[in] key Pre-hashed string
+	 * @return key.hash(), equal to hashStringView( key.view() )
+	 * @details Preferred over the hashStringView( std::string_view ) template by overload
+	 *          resolution. Passing an explicit InitialHash selects the template and rehashes.
+	 */
+	[[nodiscard]] inline uint32_t hashStringView( const HashedStringView& key ) noexcept;
+
+	/** @copydoc hashStringView( const HashedStringView& ) */
+	[[nodiscard]] inline uint32_t hashStringView( const HashedString& key ) noexcept;
+
+	/**
+	 * @brief Computes a table index from a pre-hashed string.
+	 * @param[in] seed Seed value associated with the table
+	 * @param[in] key Pre-hashed string
+	 * @param[in] size Table size; must be a power of 2
+	 * @return seedMix( seed, key.hash(), size )
+	 */
+	template <uint64_t MixConstant = constants::DEFAULT_HASH_MIX_64>
+	[[nodiscard]] inline uint32_t seedMix( uint32_t seed, const HashedStringView& key, size_t size ) noexcept;
+
+	/**
+	 * @brief Transparent hash functor for unordered containers of HashedString.
+	 * @details Pre-hashed arguments return their cached hash; plain strings are hashed with
+	 *          hashStringView(), so both kinds find the same entries. Use with
+	 *          `std::equal_to<>` for heterogeneous lookup.
+	 */
+	struct HashedStringHash
+	{
+		using is_transparent = void;
+
+		[[nodiscard]] inline size_t operator()( const HashedString& key ) const noexcept;
+		[[nodiscard]] inline size_t operator()( const HashedStringView& key ) const noexcept;
+		[[nodiscard]] inline size_t operator()( std::string_view key ) const noexcept;
+	};
+} // namespace nfx::core::hashing
+
+//=====================================================================
+// Standard library integration
+//=====================================================================
+
+/** @brief std::hash returning the cached hash. */
+template <>
+struct std::hash<nfx::core::hashing::HashedStringView>
+{
+	[[nodiscard]] inline size_t operator()( const nfx::core::hashing::HashedStringView& key ) const noexcept;
+};
+
+/** @brief std::hash returning the cached hash. */
+template <>
+struct std::hash<nfx::core::hashing::HashedString>
+{
+	[[nodiscard]] inline size_t operator()( const nfx::core::hashing::HashedString& key ) const noexcept;
+};
+
+#include "nfx/detail/core/HashedString.inl"
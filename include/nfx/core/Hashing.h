@@ -31,8 +31,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <span>
 #include <string_view>
+#include <type_traits>
 
 namespace nfx::core::hashing
 {
@@ -132,11 +135,123 @@ namespace nfx::core::hashing
 	 * @param[in] hash The 32-bit hash value of the key.
 	 * @param[in] size The total size (capacity) of the dictionary's main table. Must be a power of 2.
 	 * @return The final table index for the key (as size_t).
+	 * @see seedMixRange() and seedMix( uint32_t, uint32_t, const FastMod& ) for other table sizes
 	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 	 */
 	template <uint64_t MixConstant = constants::DEFAULT_HASH_MIX_64>
 	[[nodiscard]] inline constexpr uint32_t seedMix( uint32_t seed, uint32_t hash, size_t size ) noexcept;
 
+	/**
+	 * @brief Computes the final table index using 64-bit seed mixing.
+	 * @param[in] seed The 64-bit seed value associated with the hash bucket.
+	 * @param[in] hash The 64-bit hash value of the key.
+	 * @param[in] size The total size (capacity) of the table. Must be a power of 2; may exceed 2^32.
+	 * @return The final table index for the key, in [0, size).
+	 * @details 64-bit counterpart of seedMix() for tables beyond 2^32 slots. The full
+	 *          xorshift64* step runs on 64-bit state, and the index is taken from the
+	 *          top log2(size) bits of the product, which are the best mixed bits of a
+	 *          multiplicative hash, instead of masking the low bits.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	template <uint64_t MixConstant = constants::DEFAULT_HASH_MIX_64>
+	[[nodiscard]] inline constexpr size_t seedMix64( uint64_t seed, uint64_t hash, size_t size ) noexcept;
+
+	//----------------------------------------------
+	// Range reduction
+	//----------------------------------------------
+
+	/**
+	 * @brief Maps a 32-bit hash to [0, n) with Lemire's multiply-high reduction.
+	 * @param[in] hash The 32-bit hash value.
+	 * @param[in] n Range size; any value (0 yields 0).
+	 * @return `(hash * n) >> 32`, an index in [0, n).
+	 * @details Replaces `hash % n` with one multiplication. The result is not the exact
+	 *          remainder but is equally uniform when the hash's high bits are well mixed.
+	 * @see https://lemire.me/blog/2016/06/27/a-fast-alternative-to-the-modulo-reduction/
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline constexpr uint32_t fastRange32( uint32_t hash, uint32_t n ) noexcept;
+
+	/**
+	 * @brief Maps a 64-bit hash to [0, n) with Lemire's multiply-high reduction.
+	 * @param[in] hash The 64-bit hash value.
+	 * @param[in] n Range size; any value (0 yields 0).
+	 * @return High 64 bits of the 128-bit product `hash * n`, an index in [0, n).
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	[[nodiscard]] inline constexpr uint64_t fastRange64( uint64_t hash, uint64_t n ) noexcept;
+
+	/**
+	 * @brief Precomputed exact modulo by a runtime 32-bit divisor.
+	 * @details Lemire, Kaser & Kurz "Faster remainder by direct computation": the divisor's
+	 *          64-bit reciprocal is computed once, after which every `value % divisor` costs
+	 *          two multiplications instead of a hardware divide. Results are identical to `%`
+	 *          for all 32-bit values, so tables sized to a prime keep their exact probing.
+	 * @see https://arxiv.org/abs/1902.01961
+	 */
+	class FastMod final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Precomputes the reciprocal of a divisor.
+		 * @param[in] divisor Divisor; must be greater than 0 (0 makes mod() always return 0)
+		 */
+		inline constexpr explicit FastMod( uint32_t divisor ) noexcept;
+
+		//----------------------------------------------
+		// Operations
+		//----------------------------------------------
+
+		/**
+		 * @brief Computes `value % divisor()` without a divide instruction.
+		 * @param[in] value Dividend
+		 * @return Exact remainder
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr uint32_t mod( uint32_t value ) const noexcept;
+
+		/**
+		 * @brief Gets the divisor.
+		 * @return The divisor passed at construction
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr uint32_t divisor() const noexcept;
+
+	private:
+		uint64_t m_reciprocal; ///< ceil(2^64 / divisor)
+		uint32_t m_divisor;	   ///< Divisor
+	};
+
+	/**
+	 * @brief Computes a table index in [0, size) for any table size using multiply-high reduction.
+	 * @param[in] seed The seed value associated with the hash bucket.
+	 * @param[in] hash The 32-bit hash value of the key.
+	 * @param[in] size The total size (capacity) of the table. Any value; need not be a power of 2.
+	 * @return The final table index for the key.
+	 * @details Same seed mixing as seedMix(), but the 64-bit multiplicative hash is reduced
+	 *          with fastRange64() instead of a power-of-2 mask, so tables can grow by any factor.
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	template <uint64_t MixConstant = constants::DEFAULT_HASH_MIX_64>
+	[[nodiscard]] inline constexpr uint32_t seedMixRange( uint32_t seed, uint32_t hash, size_t size ) noexcept;
+
+	/**
+	 * @brief Computes a table index as an exact modulo of a precomputed table size.
+	 * @param[in] seed The seed value associated with the hash bucket.
+	 * @param[in] hash The 32-bit hash value of the key.
+	 * @param[in] size Precomputed table size (e.g. a prime capacity).
+	 * @return The final table index for the key, in [0, size.divisor()).
+	 * @details Same seed mixing as seedMix(); the high 32 bits of the multiplicative hash
+	 *          are reduced with FastMod::mod().
+	 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+	 */
+	template <uint64_t MixConstant = constants::DEFAULT_HASH_MIX_64>
+	[[nodiscard]] inline constexpr uint32_t seedMix( uint32_t seed, uint32_t hash, const FastMod& size ) noexcept;
+
 	//----------------------------------------------
 	// Hash combination
 	//----------------------------------------------
@@ -212,6 +327,121 @@ namespace nfx::core::hashing
 	template <uint32_t InitialHash = constants::DEFAULT_FNV_OFFSET_BASIS>
 	[[nodiscard]] inline uint32_t hashStringView( std::string_view key ) noexcept;
 
+	//----------------------------
+	// Wide string hashing
+	//----------------------------
+
+	/**
+	 * @brief Hashes the raw bytes of a UTF-16 string view
+	 * @tparam InitialHash Initial seed value for the hash calculation (default: 0x811C9DC5)
+	 * @param key UTF-16 string view to hash
+	 * @return The same value as hashStringView() over the view's bytes in memory
+	 *
+	 * @details Equal to `hashStringView<InitialHash>( std::string_view{ reinterpret_cast<const char*>( key.data() ),
+	 *          key.size() * sizeof( char16_t ) } )`, without the per-byte loop: with SSE4.2 on x86-64
+	 *          the code units are consumed 8 bytes per CRC32-C instruction (then 4 and 2 for the tail).
+	 *          Code units are not validated. The value depends on the platform's byte order.
+	 */
+	template <uint32_t InitialHash = constants::DEFAULT_FNV_OFFSET_BASIS>
+	[[nodiscard]] inline uint32_t hashStringView( std::u16string_view key ) noexcept;
+
+	/**
+	 * @brief Hashes the raw bytes of a UTF-32 string view
+	 * @tparam InitialHash Initial seed value for the hash calculation (default: 0x811C9DC5)
+	 * @param key UTF-32 string view to hash
+	 * @return The same value as hashStringView() over the view's bytes in memory
+	 * @see hashStringView( std::u16string_view )
+	 */
+	template <uint32_t InitialHash = constants::DEFAULT_FNV_OFFSET_BASIS>
+	[[nodiscard]] inline uint32_t hashStringView( std::u32string_view key ) noexcept;
+
+	/**
+	 * @brief Hashes the raw bytes of a wide string view
+	 * @tparam InitialHash Initial seed value for the hash calculation (default: 0x811C9DC5)
+	 * @param key Wide string view to hash
+	 * @return The same value as hashStringView() over the view's bytes in memory
+	 * @note `wchar_t` is 2 bytes on Windows and 4 bytes elsewhere, so raw-bytes hashes of
+	 *       wide strings differ between those platforms; use hashStringViewAsUtf8() for
+	 *       hashes that must agree across platforms and encodings.
+	 * @see hashStringView( std::u16string_view )
+	 */
+	template <uint32_t InitialHash = constants::DEFAULT_FNV_OFFSET_BASIS>
+	[[nodiscard]] inline uint32_t hashStringView( std::wstring_view key ) noexcept;
+
+	/**
+	 * @brief Hashes a UTF-16 string view as if it had been transcoded to UTF-8
+	 * @tparam InitialHash Initial seed value for the hash calculation (default: 0x811C9DC5)
+	 * @param key UTF-16 string view to hash
+	 * @return The same value as hashStringView() over the UTF-8 encoding of `key`
+	 *
+	 * @details Lets a table keyed by UTF-8 strings be probed with UTF-16 keys (and vice versa)
+	 *          without transcoding into a temporary string. Each code point's UTF-8 bytes are
+	 *          fed to CRC32-C as one 1-4 byte step; runs of 8 ASCII code units are packed into
+	 *          a single 8-byte step when SSE4.2 is available on x86-64.
+	 *
+	 *          Unpaired surrogates hash as U+FFFD (EF BF BD), the replacement a lenient
+	 *          transcoder substitutes for them.
+	 */
+	template <uint32_t InitialHash = constants::DEFAULT_FNV_OFFSET_BASIS>
+	[[nodiscard]] inline uint32_t hashStringViewAsUtf8( std::u16string_view key ) noexcept;
+
+	/**
+	 * @brief Hashes a UTF-32 string view as if it had been transcoded to UTF-8
+	 * @tparam InitialHash Initial seed value for the hash calculation (default: 0x811C9DC5)
+	 * @param key UTF-32 string view to hash
+	 * @return The same value as hashStringView() over the UTF-8 encoding of `key`
+	 * @details Surrogate code points and values above U+10FFFF hash as U+FFFD.
+	 * @see hashStringViewAsUtf8( std::u16string_view )
+	 */
+	template <uint32_t InitialHash = constants::DEFAULT_FNV_OFFSET_BASIS>
+	[[nodiscard]] inline uint32_t hashStringViewAsUtf8( std::u32string_view key ) noexcept;
+
+	/**
+	 * @brief Hashes a wide string view as if it had been transcoded to UTF-8
+	 * @tparam InitialHash Initial seed value for the hash calculation (default: 0x811C9DC5)
+	 * @param key Wide string view to hash, UTF-16 where `wchar_t` is 2 bytes and UTF-32 otherwise
+	 * @return The same value as hashStringView() over the UTF-8 encoding of `key`
+	 * @see hashStringViewAsUtf8( std::u16string_view )
+	 */
+	template <uint32_t InitialHash = constants::DEFAULT_FNV_OFFSET_BASIS>
+	[[nodiscard]] inline uint32_t hashStringViewAsUtf8( std::wstring_view key ) noexcept;
+
+	//----------------------------
+	// Binary key hashing
+	//----------------------------
+
+	/**
+	 * @brief Hashes a span of raw bytes using CRC32-C
+	 * @tparam InitialHash Initial seed value for the hash calculation (default: 0x811C9DC5)
+	 * @param bytes Bytes to hash, e.g. `std::as_bytes( std::span{ records } )`
+	 * @return The same value as hashStringView() over the same bytes
+	 * @details Binary keys no longer need a `reinterpret_cast` to `std::string_view`. With SSE4.2
+	 *          on x86-64 the bytes are consumed 8 per CRC32-C instruction (then 4, 2 and 1 for the
+	 *          tail) instead of one at a time.
+	 */
+	template <uint32_t InitialHash = constants::DEFAULT_FNV_OFFSET_BASIS>
+	[[nodiscard]] inline uint32_t hashBytes( std::span<const std::byte> bytes ) noexcept;
+
+	/**
+	 * @brief Hashes the object representation of a trivially copyable value using CRC32-C
+	 * @tparam InitialHash Initial seed value for the hash calculation (default: 0x811C9DC5)
+	 * @tparam T Type whose equal values always have identical bytes
+	 *           (`std::has_unique_object_representations_v<T>`): integers, enums, pointers and
+	 *           arrays or structs of them without padding
+	 * @param value Value to hash
+	 * @return The same value as hashBytes() over the object's `sizeof( T )` bytes
+	 *
+	 * @details Types with padding bytes or floating-point members (where `+0.0 == -0.0` but the
+	 *          bytes differ) are rejected at compile time, since equal values could hash differently.
+	 *          Add explicit padding members to hash such structs. The sizes common for packed keys
+	 *          (4, 8, 12, 16 and 32 bytes) compile to straight-line 8- and 4-byte CRC32-C steps
+	 *          when SSE4.2 is available on x86-64; other sizes use the hashBytes() loop.
+	 *          The value depends on the platform's byte order.
+	 */
+	template <uint32_t InitialHash = constants::DEFAULT_FNV_OFFSET_BASIS, typename T>
+		requires std::has_unique_object_representations_v<T>
+	[[nodiscard]] inline uint32_t hashObject( const T& value ) noexcept;
+
 	//----------------------------
 	// Integer hashing
 	//----------------------------
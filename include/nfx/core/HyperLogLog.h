@@ -0,0 +1,233 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file HyperLogLog.h
+ * @brief Mergeable HyperLogLog cardinality sketch
+ * @details HLL++ style distinct-count estimator with a sparse representation for small
+ *          cardinalities, a dense byte-per-register representation for large ones,
+ *          SIMD register merging and a compact serialized form
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace nfx::core::sketch
+{
+	namespace constants
+	{
+		//=====================================================================
+		// HyperLogLog constants
+		//=====================================================================
+
+		/** @brief Default HyperLogLog precision (2^14 registers, ~0.81% standard error). */
+		inline constexpr uint8_t HLL_DEFAULT_PRECISION{ 14 };
+
+		/** @brief Smallest supported HyperLogLog precision. */
+		inline constexpr uint8_t HLL_MIN_PRECISION{ 4 };
+
+		/** @brief Largest supported HyperLogLog precision. */
+		inline constexpr uint8_t HLL_MAX_PRECISION{ 18 };
+
+		/** @brief Index precision used by the sparse representation (HLL++ p'). */
+		inline constexpr uint8_t HLL_SPARSE_PRECISION{ 25 };
+
+		/** @brief Version byte written at the start of the serialized form. */
+		inline constexpr uint8_t HLL_SERIALIZATION_VERSION{ 1 };
+	} // namespace constants
+
+	//=====================================================================
+	// HyperLogLog class
+	//=====================================================================
+
+	/**
+	 * @brief Mergeable HyperLogLog++ cardinality sketch
+	 * @tparam Precision Number of index bits p; the dense sketch holds 2^p registers
+	 *
+	 * @details Estimates the number of distinct 64-bit hashes added to it.
+	 *
+	 *          **Representations:**
+	 *          - **Sparse**: sorted list of (25-bit index, rank) pairs; used while the
+	 *            list is smaller than the dense register array. Estimated with linear
+	 *            counting at 2^25 buckets, which is nearly exact for small sets.
+	 *          - **Dense**: one byte per register, merged with SSE2/AVX2 unsigned byte
+	 *            max and estimated with Ertl's improved raw estimator (no bias tables).
+	 *
+	 *          **Hash input:** Every added value is passed through the 64-bit
+	 *          `hashInteger` finalizer, so 32-bit hashes such as `hashStringView` results
+	 *          still spread across all register indices. Distinct 32-bit hashes collide
+	 *          beyond a few hundred million keys; prefer 64-bit hashes for such sets.
+	 *
+	 *          **Thread safety:** A sketch is not synchronized. Use one sketch per thread
+	 *          or shard and combine them with merge(). Const member functions never modify
+	 *          the sketch, so concurrent const access is safe.
+	 */
+	template <uint8_t Precision = constants::HLL_DEFAULT_PRECISION>
+	class HyperLogLog final
+	{
+		static_assert( Precision >= constants::HLL_MIN_PRECISION && Precision <= constants::HLL_MAX_PRECISION,
+			"HyperLogLog precision must be in [4, 18]" );
+
+	public:
+		//----------------------------------------------
+		// Public constants
+		//----------------------------------------------
+
+		/** @brief Number of dense registers (2^Precision). */
+		static constexpr size_t REGISTER_COUNT{ size_t{ 1 } << Precision };
+
+		/** @brief Largest rank a dense register can hold (64 - p + 1). */
+		static constexpr uint8_t MAX_RANK{ static_cast<uint8_t>( 64 - Precision + 1 ) };
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Creates an empty sketch in sparse representation. */
+		HyperLogLog() = default;
+
+		//----------------------------------------------
+		// Insertion
+		//----------------------------------------------
+
+		/**
+		 * @brief Adds one hashed element to the sketch.
+		 * @param[in] hash Hash of the element (64-bit preferred, 32-bit accepted)
+		 */
+		inline void add( uint64_t hash );
+
+		/**
+		 * @brief Adds a batch of hashed elements to the sketch.
+		 * @param[in] hashes Hashes of the elements
+		 * @details Sparse sketches sort and merge the whole batch at once; dense sketches
+		 *          update registers in an unrolled loop without per-element branching on
+		 *          the representation.
+		 */
+		inline void add( std::span<const uint64_t> hashes );
+
+		//----------------------------------------------
+		// Merging
+		//----------------------------------------------
+
+		/**
+		 * @brief Merges another sketch into this one (set union).
+		 * @param[in] other Sketch to merge, typically built by another thread or shard
+		 * @details Dense/dense merges are a register-wise unsigned byte max using AVX2
+		 *          (32 registers per instruction) or SSE2 (16 registers) when enabled at
+		 *          compile time, with a scalar fallback.
+		 */
+		inline void merge( const HyperLogLog& other );
+
+		//----------------------------------------------
+		// Estimation
+		//----------------------------------------------
+
+		/**
+		 * @brief Estimates the number of distinct elements added.
+		 * @return Cardinality estimate
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline double estimate() const;
+
+		//----------------------------------------------
+		// State
+		//----------------------------------------------
+
+		/**
+		 * @brief Checks whether the sketch is still in sparse representation.
+		 * @return `true` if sparse, `false` if dense
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool isSparse() const noexcept;
+
+		/**
+		 * @brief Checks whether nothing has been added to the sketch.
+		 * @return `true` if the sketch is empty
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool isEmpty() const noexcept;
+
+		/** @brief Resets the sketch to an empty sparse sketch. */
+		inline void clear() noexcept;
+
+		//----------------------------------------------
+		// Serialization
+		//----------------------------------------------
+
+		/**
+		 * @brief Serializes the sketch into a compact byte representation.
+		 * @return Serialized bytes
+		 * @details Layout: version byte, precision byte, representation byte, then either
+		 *          a varint entry count followed by varint-encoded deltas of the sorted sparse
+		 *          entries, or the dense registers packed at 6 bits each (3 bytes per 4 registers).
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::vector<std::byte> serialize() const;
+
+		/**
+		 * @brief Reconstructs a sketch from its serialized form.
+		 * @param[in] bytes Bytes previously produced by serialize()
+		 * @return The sketch, or `std::nullopt` if the bytes are malformed or were produced
+		 *         with a different precision
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static inline std::optional<HyperLogLog> deserialize( std::span<const std::byte> bytes );
+
+	private:
+		//----------------------------------------------
+		// Private implementation
+		//----------------------------------------------
+
+		static constexpr uint8_t SPARSE_SHIFT{ constants::HLL_SPARSE_PRECISION - Precision };
+		static constexpr size_t SPARSE_LIMIT{ REGISTER_COUNT / sizeof( uint32_t ) };
+		static constexpr size_t SPARSE_BUFFER_LIMIT{ REGISTER_COUNT / 16 < 16 ? 16 : REGISTER_COUNT / 16 };
+
+		[[nodiscard]] static inline uint32_t encodeSparse( uint64_t hash ) noexcept;
+
+		inline void addDense( uint64_t hash ) noexcept;
+
+		inline void flushSparse();
+
+		[[nodiscard]] inline const std::vector<uint32_t>& sortedSparseEntries( std::vector<uint32_t>& scratch ) const;
+
+		inline void convertToDense();
+
+		inline void foldSparseIntoRegisters( const std::vector<uint32_t>& entries ) noexcept;
+
+		inline void mergeSparseEntries( const std::vector<uint32_t>& entries );
+
+		[[nodiscard]] static inline std::vector<uint32_t> mergeSorted( const std::vector<uint32_t>& lhs, const std::vector<uint32_t>& rhs );
+
+		std::vector<uint32_t> m_sparse;
+		std::vector<uint32_t> m_sparseBuffer;
+		std::vector<uint8_t> m_registers;
+	};
+} // namespace nfx::core::sketch
+
+#include "nfx/detail/core/HyperLogLog.inl"
@@ -0,0 +1,185 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file InterleavedLookup.h
+ * @brief Coroutine-interleaved table lookups
+ * @details Lookups written as ordinary scalar code that `co_await` the bucket they are
+ *          about to read; a round-robin scheduler keeps several of them in flight, so the
+ *          prefetch of one overlaps the compares of the others
+ */
+
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace nfx::core::hashing
+{
+	namespace constants
+	{
+		//=====================================================================
+		// Interleaved lookup constants
+		//=====================================================================
+
+		/**
+		 * @brief Lookups kept in flight by interleaveLookups() by default.
+		 * @details Same depth as constants::LOOKUP_BATCH_SIZE; narrower widths do not cover
+		 *          the switch overhead on out-of-cache tables.
+		 */
+		inline constexpr size_t INTERLEAVE_WIDTH{ 16 };
+
+		/** @brief Upper bound on the interleaving width (scheduler slots are on the stack). */
+		inline constexpr size_t MAX_INTERLEAVE_WIDTH{ 64 };
+	} // namespace constants
+
+	//=====================================================================
+	// LookupTask class
+	//=====================================================================
+
+	/**
+	 * @brief Coroutine type of one interleaved lookup
+	 * @tparam Result Lookup result (default-constructible, returned with `co_return`)
+	 *
+	 * @details Starts eagerly: calling the coroutine runs it up to its first
+	 *          `co_await prefetchAndSuspend( address )`, so hashing, slot computation and the
+	 *          prefetch happen at creation. The scheduler resumes it on its next turn, by
+	 *          which time the line is (hopefully) cached.
+	 *
+	 *          Frames are recycled through a per-thread free list instead of the global heap,
+	 *          since an allocation per lookup would cost more than the miss it hides.
+	 *          Exceptions escaping the coroutine terminate the program.
+	 */
+	template <typename Result>
+	class LookupTask final
+	{
+	public:
+		/** @brief Coroutine promise: stores the result and recycles the frame. */
+		struct promise_type
+		{
+			Result value{}; ///< Value passed to `co_return`
+
+			inline LookupTask get_return_object() noexcept;
+			inline std::suspend_never initial_suspend() const noexcept;
+			inline std::suspend_always final_suspend() const noexcept;
+			inline void return_value( Result result ) noexcept;
+			inline void unhandled_exception() const noexcept;
+
+			static inline void* operator new( size_t size );
+			static inline void operator delete( void* frame, size_t size ) noexcept;
+		};
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Creates an empty task (no coroutine). */
+		LookupTask() noexcept = default;
+
+		inline LookupTask( LookupTask&& other ) noexcept;
+		inline LookupTask& operator=( LookupTask&& other ) noexcept;
+
+		LookupTask( const LookupTask& ) = delete;
+		LookupTask& operator=( const LookupTask& ) = delete;
+
+		/** @brief Destroys the coroutine frame, finished or not. */
+		inline ~LookupTask();
+
+		//----------------------------------------------
+		// Scheduling
+		//----------------------------------------------
+
+		/**
+		 * @brief Checks whether the lookup has returned.
+		 * @return true if the coroutine reached `co_return` (or the task is empty)
+		 */
+		[[nodiscard]] inline bool done() const noexcept;
+
+		/** @brief Runs the lookup up to its next suspension point. */
+		inline void resume() const;
+
+		/**
+		 * @brief Gets the returned value.
+		 * @return The `co_return` value; only meaningful once done()
+		 */
+		[[nodiscard]] inline Result& result() noexcept;
+
+	private:
+		inline explicit LookupTask( std::coroutine_handle<promise_type> handle ) noexcept;
+
+		std::coroutine_handle<promise_type> m_handle{}; ///< Owned coroutine (null when empty)
+	};
+
+	//=====================================================================
+	// Interleaved lookup
+	//=====================================================================
+
+	/** @brief Awaitable that prefetches a cache line and yields to the scheduler. */
+	struct PrefetchAwaiter
+	{
+		const void* address; ///< Line to prefetch before suspending
+
+		[[nodiscard]] inline constexpr bool await_ready() const noexcept;
+		inline void await_suspend( std::coroutine_handle<> ) const noexcept;
+		inline constexpr void await_resume() const noexcept;
+	};
+
+	/**
+	 * @brief Prefetches `address` and suspends the current lookup.
+	 * @param[in] address Bucket the lookup is about to read
+	 * @return Awaitable; use as `co_await prefetchAndSuspend( &table[slot] )`
+	 */
+	[[nodiscard]] inline constexpr PrefetchAwaiter prefetchAndSuspend( const void* address ) noexcept;
+
+	/**
+	 * @brief Runs one lookup coroutine per key, keeping `width` of them in flight.
+	 * @param[in] keys Keys to look up
+	 * @param[out] results One result per key; only the first min( keys, results ) keys are processed
+	 * @param[in] lookup Coroutine factory, `LookupTask<Result> ( const Key& key )`; it must
+	 *            outlive the call (lambda captures are read from the factory object)
+	 * @param[in] width Lookups in flight, clamped to [1, constants::MAX_INTERLEAVE_WIDTH]
+	 * @details Round-robin over `width` slots: each turn resumes one lookup; when a lookup
+	 *          finishes its result is stored and the next key starts in that slot (running
+	 *          straight to its own prefetch). A typical lookup:
+	 *          @code
+	 *          auto find = [&]( std::string_view key ) -> LookupTask<const Entry*> {
+	 *              uint32_t slot = seedMix( seed, hashStringView( key ), table.size() );
+	 *              co_await prefetchAndSuspend( &table[slot] );
+	 *              for ( ; table[slot].used; slot = ( slot + 1 ) & mask )
+	 *                  if ( table[slot].key == key ) co_return &table[slot];
+	 *              co_return nullptr;
+	 *          };
+	 *          interleaveLookups( std::span<const std::string_view>{ keys }, std::span{ found }, find );
+	 *          @endcode
+	 *          Unlike lookupBatch(), the lookup body stays a scalar function and may suspend
+	 *          any number of times (e.g. once per cache line of a long probe sequence).
+	 */
+	template <typename Key, typename Result, typename Lookup>
+	inline void interleaveLookups( std::span<const Key> keys, std::span<Result> results, Lookup&& lookup,
+		size_t width = constants::INTERLEAVE_WIDTH );
+} // namespace nfx::core::hashing
+
+#include "nfx/detail/core/InterleavedLookup.inl"
@@ -0,0 +1,100 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file KeyEquality.h
+ * @brief Short-key equality for post-hash comparison
+ * @details Length-specialized byte comparison with overlapping and masked SSE2/AVX2 loads,
+ *          and a fused cached-hash-then-bytes check for hash-table probes
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace nfx::core::hashing
+{
+	namespace constants
+	{
+		//=====================================================================
+		// Key equality constants
+		//=====================================================================
+
+		/** @brief Longest key compared inline; longer keys go to memcmp. */
+		inline constexpr size_t KEY_EQUAL_INLINE_MAX{ 64 };
+
+		/** @brief Smallest page size on supported targets; bounds the masked over-read. */
+		inline constexpr size_t KEY_EQUAL_PAGE_SIZE{ 4096 };
+	} // namespace constants
+
+	//=====================================================================
+	// Key equality
+	//=====================================================================
+
+	/**
+	 * @brief Compares two byte ranges of the same length.
+	 * @param[in] a First range
+	 * @param[in] b Second range
+	 * @param[in] length Bytes to compare
+	 * @return true if the ranges are equal
+	 * @details Replaces a memcmp call for the short keys typical of hash tables:
+	 *          - **0-16 bytes:** one masked 16-byte SSE2 compare when neither load can cross
+	 *            into the next page, otherwise two overlapping 8/4-byte loads or three
+	 *            single bytes
+	 *          - **17-32 bytes:** two overlapping 16-byte loads
+	 *          - **33-64 bytes:** two overlapping 32-byte AVX2 loads (four 16-byte SSE2 loads
+	 *            without -mavx2)
+	 *          - **Longer:** memcmp
+	 *
+	 *          Vector widths are chosen at compile time like hashStringView(); without SSE2
+	 *          the scalar paths handle up to 16 bytes and memcmp the rest.
+	 */
+	[[nodiscard]] inline bool bytesEqual( const void* a, const void* b, size_t length ) noexcept;
+
+	/**
+	 * @brief Compares two keys.
+	 * @param[in] a First key
+	 * @param[in] b Second key
+	 * @return true if lengths and bytes are equal
+	 * @see bytesEqual()
+	 */
+	[[nodiscard]] inline bool keysEqual( std::string_view a, std::string_view b ) noexcept;
+
+	/**
+	 * @brief Compares a cached hash and length first, then the bytes.
+	 * @param[in] storedHash Hash cached with the stored key
+	 * @param[in] storedKey Stored key
+	 * @param[in] hash Hash of the probe key (e.g. hashStringView( key ))
+	 * @param[in] key Probe key
+	 * @return true if the keys are equal
+	 * @details Hash and length are checked with a single branch, so most mismatching
+	 *          slots are rejected without touching the key bytes (which usually live in
+	 *          another cache line than the slot).
+	 */
+	[[nodiscard]] inline bool hashedKeysEqual( uint32_t storedHash, std::string_view storedKey, uint32_t hash, std::string_view key ) noexcept;
+} // namespace nfx::core::hashing
+
+#include "nfx/detail/core/KeyEquality.inl"
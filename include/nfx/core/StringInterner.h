@@ -0,0 +1,254 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file StringInterner.h
+ * @brief Thread-safe string interning pool
+ * @details Deduplicates strings by hashStringView() into contiguous arena storage and hands
+ *          out stable handles that compare by pointer; lookups of already interned strings
+ *          take no lock
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "nfx/core/HashedString.h"
+
+namespace nfx::core::strings
+{
+	namespace constants
+	{
+		//=====================================================================
+		// String interner constants
+		//=====================================================================
+
+		/** @brief Slots in a new interner's lookup table (grows at 50% load). */
+		inline constexpr size_t INTERNER_DEFAULT_CAPACITY{ 1024 };
+
+		/** @brief Bytes per arena block holding interned text. */
+		inline constexpr size_t INTERNER_BLOCK_SIZE{ 64 * 1024 };
+
+		/** @brief Minimum arena bytes per string: the 16-byte masked compare of bytesEqual() stays inside them. */
+		inline constexpr size_t INTERNER_MIN_TEXT_BYTES{ 16 };
+
+		/** @brief Entries in the first entry segment; each further segment doubles. */
+		inline constexpr size_t INTERNER_FIRST_SEGMENT{ 256 };
+
+		/** @brief Entry segments; caps the interner at 256 * (2^24 - 1) strings. */
+		inline constexpr size_t INTERNER_SEGMENT_COUNT{ 24 };
+	} // namespace constants
+
+	namespace detail
+	{
+		/** @brief Interned string record; never moves once created. */
+		struct InternEntry
+		{
+			std::string_view text; ///< Arena bytes (NUL-terminated)
+			uint32_t hash;		   ///< hashStringView( text )
+			uint32_t id;		   ///< Dense insertion index
+		};
+	} // namespace detail
+
+	//=====================================================================
+	// InternedString class
+	//=====================================================================
+
+	/**
+	 * @brief Handle to an interned string
+	 * @details Trivially copyable pointer-sized handle. Two handles from the same interner
+	 *          are equal exactly when their strings are equal, so comparison is one pointer
+	 *          compare. Valid for the lifetime of the interner.
+	 */
+	class InternedString final
+	{
+	public:
+		/** @brief Creates a null handle (not equal to any interned string). */
+		InternedString() noexcept = default;
+
+		/** @brief Gets the interned bytes (NUL-terminated). */
+		[[nodiscard]] inline std::string_view view() const noexcept;
+
+		/** @brief Gets the interned bytes as a C string. */
+		[[nodiscard]] inline const char* c_str() const noexcept;
+
+		/** @brief Gets hashStringView( view() ), stored at interning time. */
+		[[nodiscard]] inline uint32_t hash() const noexcept;
+
+		/** @brief Gets the dense id (0, 1, 2, ... in interning order); see StringInterner::at(). */
+		[[nodiscard]] inline uint32_t id() const noexcept;
+
+		/** @brief Gets the number of bytes. */
+		[[nodiscard]] inline size_t size() const noexcept;
+
+		/** @brief Checks whether the handle refers to a string. */
+		[[nodiscard]] inline explicit operator bool() const noexcept;
+
+		/** @brief Views the string with its hash (no rehash). */
+		inline operator hashing::HashedStringView() const noexcept;
+
+		/** @brief Compares handles by identity. */
+		[[nodiscard]] friend inline bool operator==( InternedString lhs, InternedString rhs ) noexcept
+		{
+			return lhs.m_entry == rhs.m_entry;
+		}
+
+	private:
+		friend class StringInterner;
+
+		inline explicit InternedString( const detail::InternEntry* entry ) noexcept;
+
+		const detail::InternEntry* m_entry{ nullptr }; ///< Interned record (null for a null handle)
+	};
+
+	//=====================================================================
+	// StringInterner class
+	//=====================================================================
+
+	/**
+	 * @brief Thread-safe, append-only string interning pool
+	 *
+	 * @details **Storage:** Bytes are copied once into 64 KiB arena blocks, at least 16 bytes
+	 *          per string (longer strings get a block of their own), and records into segments
+	 *          that double in size, so neither moves: handles and views stay valid until the
+	 *          interner is destroyed. Strings are never removed.
+	 *
+	 *          **Lookup:** An open-addressing table of atomic record pointers indexed with
+	 *          `seedMix( hashStringView( text ) )`. Probes compare the stored hash before any
+	 *          byte. A string that is already interned is found without taking a lock.
+	 *
+	 *          **Insertion:** Misses take a mutex, re-probe and publish the new record with a
+	 *          release store. At 50% load the table is rebuilt at twice the size and swapped
+	 *          in; replaced tables are kept until destruction so concurrent readers never see
+	 *          freed memory (at most as much again as the live table).
+	 */
+	class StringInterner final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Creates an empty interner.
+		 * @param[in] initialCapacity Initial lookup table slots (rounded up to a power of 2)
+		 */
+		inline explicit StringInterner( size_t initialCapacity = constants::INTERNER_DEFAULT_CAPACITY );
+
+		StringInterner( const StringInterner& ) = delete;
+		StringInterner& operator=( const StringInterner& ) = delete;
+
+		//----------------------------------------------
+		// Interning
+		//----------------------------------------------
+
+		/**
+		 * @brief Gets the handle of a string, interning it on first sight.
+		 * @param[in] text Bytes to intern (copied on first sight); strings, string views and
+		 *            C strings are hashed once, pre-hashed views are not rehashed
+		 * @return Handle equal to every other handle of the same bytes
+		 */
+		inline InternedString intern( const hashing::HashedStringView& text );
+
+		/**
+		 * @brief Looks up a string without interning it.
+		 * @param[in] text Bytes to look up
+		 * @return The handle, or nullopt if the string was never interned
+		 * @details Lock-free for hits and misses. Strings interned before the call are always
+		 *          found; one interned concurrently by another thread may or may not be.
+		 */
+		[[nodiscard]] inline std::optional<InternedString> find( const hashing::HashedStringView& text ) const noexcept;
+
+		/**
+		 * @brief Gets the string with a given id.
+		 * @param[in] id Id from InternedString::id(); must be less than size()
+		 * @return Handle of that string
+		 */
+		[[nodiscard]] inline InternedString at( uint32_t id ) const noexcept;
+
+		//----------------------------------------------
+		// Statistics
+		//----------------------------------------------
+
+		/** @brief Gets the number of distinct strings interned. */
+		[[nodiscard]] inline size_t size() const noexcept;
+
+		/**
+		 * @brief Gets the bytes held by the interner.
+		 * @return Arena blocks, record segments and lookup tables (including replaced ones)
+		 */
+		[[nodiscard]] inline size_t memoryUsage() const noexcept;
+
+	private:
+		/** @brief Open-addressing lookup table; replaced, never resized in place. */
+		struct Table
+		{
+			size_t mask;
+			std::unique_ptr<std::atomic<const detail::InternEntry*>[]> slots;
+		};
+
+		inline const detail::InternEntry* probe( const Table& table, std::string_view text, uint32_t hash ) const noexcept;
+		inline const detail::InternEntry* insert( std::string_view text, uint32_t hash );
+		inline std::string_view storeText( std::string_view text );
+		inline detail::InternEntry& newEntry();
+		inline void grow();
+		static inline void place( Table& table, const detail::InternEntry* entry ) noexcept;
+		static inline std::unique_ptr<Table> makeTable( size_t capacity );
+
+		std::atomic<const Table*> m_table{ nullptr }; ///< Live lookup table (read lock-free)
+		std::atomic<size_t> m_count{ 0 };			  ///< Interned strings
+
+		std::array<std::atomic<detail::InternEntry*>, constants::INTERNER_SEGMENT_COUNT> m_segments{}; ///< Record segments
+
+		mutable std::mutex m_mutex;						   ///< Serializes insertion
+		std::vector<std::unique_ptr<Table>> m_tables;	   ///< Live table (back) and replaced tables
+		std::vector<std::unique_ptr<char[]>> m_blocks;	   ///< Text arena blocks
+		std::vector<std::unique_ptr<detail::InternEntry[]>> m_segmentStorage; ///< Owns m_segments
+		char* m_cursor{ nullptr };						   ///< Next free byte in the current block
+		size_t m_remaining{ 0 };						   ///< Free bytes in the current block
+		size_t m_memory{ 0 };							   ///< Bytes allocated (under m_mutex)
+	};
+} // namespace nfx::core::strings
+
+//=====================================================================
+// Standard library integration
+//=====================================================================
+
+/** @brief std::hash returning the stored hash of an interned string. */
+template <>
+struct std::hash<nfx::core::strings::InternedString>
+{
+	[[nodiscard]] inline size_t operator()( nfx::core::strings::InternedString key ) const noexcept;
+};
+
+#include "nfx/detail/core/StringInterner.inl"
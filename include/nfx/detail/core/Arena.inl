@@ -0,0 +1,427 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Arena.inl
+ * @brief Huge-page and NUMA-aware bump allocator implementation
+ * @details Anonymous mmap chunks with MADV_HUGEPAGE / MAP_HUGETLB backing and mbind or
+ *          first-touch NUMA placement; aligned operator new off Linux
+ */
+
+#if defined( __linux__ )
+#	include <sched.h>
+#	include <sys/mman.h>
+#	include <sys/syscall.h>
+#	include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include "nfx/core/CPU.h"
+
+namespace nfx::core::memory
+{
+	namespace detail
+	{
+		//=====================================================================
+		// Page mapping
+		//=====================================================================
+
+		/** @brief Rounds `value` up to a power-of-2 `alignment`. */
+		inline constexpr size_t roundUp( size_t value, size_t alignment ) noexcept
+		{
+			return ( value + alignment - 1 ) & ~( alignment - 1 );
+		}
+
+		/** @brief Rounds a pointer up to a power-of-2 `alignment`. */
+		inline std::byte* alignUp( std::byte* pointer, size_t alignment ) noexcept
+		{
+			return reinterpret_cast<std::byte*>( roundUp( reinterpret_cast<uintptr_t>( pointer ), alignment ) );
+		}
+
+#if defined( __linux__ )
+		/** @brief Maps zeroed anonymous memory at an `alignment` boundary (over-maps, then trims). */
+		inline void* mapAligned( size_t bytes, size_t alignment ) noexcept
+		{
+			const size_t span = bytes + alignment - constants::SMALL_PAGE_SIZE;
+			void* raw = ::mmap( nullptr, span, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+			if ( raw == MAP_FAILED )
+			{
+				return nullptr;
+			}
+
+			auto* start = static_cast<std::byte*>( raw );
+			std::byte* aligned = alignUp( start, alignment );
+			const size_t head = static_cast<size_t>( aligned - start );
+			const size_t tail = span - head - bytes;
+			if ( head > 0 )
+			{
+				::munmap( start, head );
+			}
+			if ( tail > 0 )
+			{
+				::munmap( aligned + bytes, tail );
+			}
+
+			return aligned;
+		}
+
+		/** @brief Maps explicit huge pages from the reserved pool; nullptr if the pool is short. */
+		inline void* mapHugeTlb( size_t bytes ) noexcept
+		{
+			int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#	if defined( MAP_HUGE_2MB )
+			flags |= MAP_HUGE_2MB;
+#	endif
+			void* base = ::mmap( nullptr, bytes, PROT_READ | PROT_WRITE, flags, -1, 0 );
+
+			return base == MAP_FAILED ? nullptr : base;
+		}
+
+		/** @brief Sets an MPOL_BIND policy for one node on a range whose pages are not yet faulted. */
+		inline bool bindToNode( void* base, size_t bytes, uint32_t node ) noexcept
+		{
+#	if defined( SYS_mbind )
+			constexpr int bindPolicy = 2; // MPOL_BIND in <linux/mempolicy.h>
+			constexpr size_t bitsPerWord = sizeof( unsigned long ) * 8;
+
+			std::array<unsigned long, 16> mask{};
+			if ( node >= mask.size() * bitsPerWord )
+			{
+				return false;
+			}
+			mask[node / bitsPerWord] = 1ul << ( node % bitsPerWord );
+
+			// maxnode counts one past the last mask bit the kernel reads
+			return ::syscall( SYS_mbind, base, bytes, bindPolicy, mask.data(), mask.size() * bitsPerWord + 1, 0u ) == 0;
+#	else
+			(void)base;
+			(void)bytes;
+			(void)node;
+			return false;
+#	endif
+		}
+
+		/** @brief Writes one byte per page so every page is faulted in. */
+		inline void touchPages( void* base, size_t bytes, size_t pageSize ) noexcept
+		{
+			auto* bytesBase = static_cast<volatile std::byte*>( base );
+			for ( size_t offset = 0; offset < bytes; offset += pageSize )
+			{
+				bytesBase[offset] = std::byte{ 0 };
+			}
+		}
+
+		/** @brief Faults a range in from a thread pinned to `node`, then restores the affinity. */
+		inline bool touchOnNode( void* base, size_t bytes, size_t pageSize, uint32_t node )
+		{
+			cpu_set_t saved;
+			CPU_ZERO( &saved );
+			if ( ::sched_getaffinity( 0, sizeof( saved ), &saved ) != 0 || !cpu::pinCurrentThreadToNode( node ) )
+			{
+				return false;
+			}
+
+			touchPages( base, bytes, pageSize );
+			::sched_setaffinity( 0, sizeof( saved ), &saved );
+
+			return true;
+		}
+#endif
+	} // namespace detail
+
+	//=====================================================================
+	// Arena class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline Arena::Arena( const ArenaOptions& options ) noexcept
+		: m_options{ options }
+	{
+		const size_t pageSize = options.pages == PageSize::Small ? constants::SMALL_PAGE_SIZE : constants::HUGE_PAGE_SIZE;
+		m_options.chunkSize = detail::roundUp( std::max( options.chunkSize, pageSize ), pageSize );
+	}
+
+	inline Arena::~Arena()
+	{
+		release();
+	}
+
+	inline Arena::Arena( Arena&& other ) noexcept
+		: m_options{ other.m_options },
+		  m_chunks{ std::move( other.m_chunks ) },
+		  m_cursor{ std::exchange( other.m_cursor, nullptr ) },
+		  m_end{ std::exchange( other.m_end, nullptr ) },
+		  m_allocated{ std::exchange( other.m_allocated, 0 ) },
+		  m_mapped{ std::exchange( other.m_mapped, 0 ) },
+		  m_hugePageBytes{ std::exchange( other.m_hugePageBytes, 0 ) },
+		  m_numaBound{ std::exchange( other.m_numaBound, true ) }
+	{
+		other.m_chunks.clear();
+	}
+
+	inline Arena& Arena::operator=( Arena&& other ) noexcept
+	{
+		if ( this != &other )
+		{
+			release();
+			m_options = other.m_options;
+			m_chunks = std::move( other.m_chunks );
+			other.m_chunks.clear();
+			m_cursor = std::exchange( other.m_cursor, nullptr );
+			m_end = std::exchange( other.m_end, nullptr );
+			m_allocated = std::exchange( other.m_allocated, 0 );
+			m_mapped = std::exchange( other.m_mapped, 0 );
+			m_hugePageBytes = std::exchange( other.m_hugePageBytes, 0 );
+			m_numaBound = std::exchange( other.m_numaBound, true );
+		}
+
+		return *this;
+	}
+
+	//----------------------------------------------
+	// Allocation
+	//----------------------------------------------
+
+	inline void* Arena::allocate( size_t bytes, size_t alignment )
+	{
+		alignment = std::max<size_t>( alignment, 1 );
+		const size_t padding = alignment > constants::SMALL_PAGE_SIZE ? alignment : 0;
+
+		if ( bytes > m_options.chunkSize / 4 )
+		{
+			// Dedicated chunk; the shared chunk keeps serving small requests
+			if ( bytes > std::numeric_limits<size_t>::max() / 2 || !mapChunk( bytes + padding ) )
+			{
+				return nullptr;
+			}
+			auto* base = static_cast<std::byte*>( m_chunks.back().base );
+			std::byte* result = detail::alignUp( base, alignment );
+			m_allocated += static_cast<size_t>( result - base ) + bytes;
+
+			return result;
+		}
+
+		std::byte* result = detail::alignUp( m_cursor, alignment );
+		if ( m_cursor == nullptr || reinterpret_cast<uintptr_t>( result ) + bytes > reinterpret_cast<uintptr_t>( m_end ) )
+		{
+			if ( !mapChunk( bytes + padding ) )
+			{
+				return nullptr;
+			}
+			m_cursor = static_cast<std::byte*>( m_chunks.back().base );
+			m_end = m_cursor + m_chunks.back().size;
+			result = detail::alignUp( m_cursor, alignment );
+		}
+
+		m_allocated += static_cast<size_t>( result + bytes - m_cursor );
+		m_cursor = result + bytes;
+
+		return result;
+	}
+
+	template <typename T>
+	inline T* Arena::allocate( size_t count )
+	{
+		if ( count > std::numeric_limits<size_t>::max() / sizeof( T ) )
+		{
+			return nullptr;
+		}
+
+		return static_cast<T*>( allocate( count * sizeof( T ), alignof( T ) ) );
+	}
+
+	inline void Arena::release() noexcept
+	{
+		for ( const Chunk& chunk : m_chunks )
+		{
+#if defined( __linux__ )
+			::munmap( chunk.base, chunk.size );
+#else
+			::operator delete( chunk.base, std::align_val_t{ constants::HUGE_PAGE_SIZE } );
+#endif
+		}
+
+		m_chunks.clear();
+		m_cursor = nullptr;
+		m_end = nullptr;
+		m_allocated = 0;
+		m_mapped = 0;
+		m_hugePageBytes = 0;
+		m_numaBound = true;
+	}
+
+	//----------------------------------------------
+	// Statistics
+	//----------------------------------------------
+
+	inline const ArenaOptions& Arena::options() const noexcept
+	{
+		return m_options;
+	}
+
+	inline size_t Arena::bytesAllocated() const noexcept
+	{
+		return m_allocated;
+	}
+
+	inline size_t Arena::bytesMapped() const noexcept
+	{
+		return m_mapped;
+	}
+
+	inline size_t Arena::hugePageBytes() const noexcept
+	{
+		return m_hugePageBytes;
+	}
+
+	inline size_t Arena::chunkCount() const noexcept
+	{
+		return m_chunks.size();
+	}
+
+	inline bool Arena::numaBound() const noexcept
+	{
+		return m_options.numaNode.has_value() && m_numaBound;
+	}
+
+	//----------------------------------------------
+	// Internals
+	//----------------------------------------------
+
+	inline bool Arena::mapChunk( size_t minimumBytes )
+	{
+		const bool huge = m_options.pages != PageSize::Small;
+		const size_t pageSize = huge ? constants::HUGE_PAGE_SIZE : constants::SMALL_PAGE_SIZE;
+		const size_t size = detail::roundUp( std::max( minimumBytes, m_options.chunkSize ), pageSize );
+		m_chunks.reserve( m_chunks.size() + 1 );
+
+		Chunk chunk{ nullptr, size, PageSize::Small };
+#if defined( __linux__ )
+		if ( m_options.pages == PageSize::ExplicitHuge )
+		{
+			chunk.base = detail::mapHugeTlb( size );
+			chunk.pages = PageSize::ExplicitHuge;
+		}
+		if ( chunk.base == nullptr )
+		{
+			chunk.base = detail::mapAligned( size, pageSize );
+			if ( chunk.base == nullptr )
+			{
+				return false;
+			}
+			// Small chunks opt out so the comparison holds under THP "always"
+			if ( huge )
+			{
+				chunk.pages = ::madvise( chunk.base, size, MADV_HUGEPAGE ) == 0 ? PageSize::TransparentHuge : PageSize::Small;
+			}
+			else
+			{
+				::madvise( chunk.base, size, MADV_NOHUGEPAGE );
+			}
+		}
+
+		bool touched = false;
+		if ( m_options.numaNode.has_value() )
+		{
+			const uint32_t node = *m_options.numaNode;
+			// mbind rejects unknown nodes itself; topology() (and its first-use detection) is only
+			// reached on the first-touch fallback
+			bool bound = detail::bindToNode( chunk.base, size, node );
+			if ( !bound )
+			{
+				bound = touched = detail::touchOnNode( chunk.base, size, pageSize, node );
+			}
+			m_numaBound = m_numaBound && bound;
+		}
+		if ( m_options.prefault && !touched )
+		{
+			detail::touchPages( chunk.base, size, pageSize );
+		}
+#else
+		chunk.base = ::operator new( size, std::align_val_t{ constants::HUGE_PAGE_SIZE }, std::nothrow );
+		if ( chunk.base == nullptr )
+		{
+			return false;
+		}
+		std::memset( chunk.base, 0, size );
+		m_numaBound = m_numaBound && !m_options.numaNode.has_value();
+#endif
+
+		m_chunks.push_back( chunk );
+		m_mapped += size;
+		m_hugePageBytes += chunk.pages == PageSize::Small ? 0 : size;
+
+		return true;
+	}
+
+	//=====================================================================
+	// ArenaAllocator class
+	//=====================================================================
+
+	template <typename T>
+	inline ArenaAllocator<T>::ArenaAllocator( Arena& arena ) noexcept
+		: m_arena{ &arena }
+	{
+	}
+
+	template <typename T>
+	template <typename U>
+	inline ArenaAllocator<T>::ArenaAllocator( const ArenaAllocator<U>& other ) noexcept
+		: m_arena{ &other.arena() }
+	{
+	}
+
+	template <typename T>
+	inline T* ArenaAllocator<T>::allocate( size_t count )
+	{
+		T* result = m_arena->template allocate<T>( count );
+		if ( result == nullptr )
+		{
+			throw std::bad_alloc{};
+		}
+
+		return result;
+	}
+
+	template <typename T>
+	inline void ArenaAllocator<T>::deallocate( T* pointer, size_t count ) noexcept
+	{
+		(void)pointer;
+		(void)count;
+	}
+
+	template <typename T>
+	inline Arena& ArenaAllocator<T>::arena() const noexcept
+	{
+		return *m_arena;
+	}
+} // namespace nfx::core::memory
@@ -0,0 +1,118 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BatchLookup.inl
+ * @brief Batched hash-then-prefetch lookup implementation
+ * @details Three-stage group pipeline: hash and map, prefetch, resolve
+ */
+
+#if defined( _MSC_VER ) && !defined( __clang__ )
+#	include <xmmintrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <string_view>
+#include <type_traits>
+
+#include "nfx/core/Hashing.h"
+
+namespace nfx::core::hashing
+{
+	namespace detail
+	{
+		/** @brief Starts loading the cache line at `address` into L1D for reading. */
+		inline void prefetchForRead( const void* address ) noexcept
+		{
+#if defined( _MSC_VER ) && !defined( __clang__ )
+			_mm_prefetch( static_cast<const char*>( address ), _MM_HINT_T0 );
+#elif defined( __GNUC__ )
+			__builtin_prefetch( address, 0 );
+#else
+			static_cast<void>( address );
+#endif
+		}
+	} // namespace detail
+
+	//=====================================================================
+	// Batched lookup
+	//=====================================================================
+
+	template <typename Key>
+	inline uint32_t LookupHash::operator()( const Key& key ) const noexcept
+	{
+		if constexpr ( std::is_integral_v<Key> )
+		{
+			return static_cast<uint32_t>( hashInteger( key ) );
+		}
+		else if constexpr ( requires { { key.hash() } -> std::convertible_to<uint32_t>; } )
+		{
+			// Pre-hashed keys (HashedStringView, HashedString)
+			return key.hash();
+		}
+		else
+		{
+			return hashStringView( std::string_view{ key } );
+		}
+	}
+
+	template <size_t BatchSize, typename Key, typename Result, typename BucketAt, typename Resolve, typename Hash>
+	inline void lookupBatch( std::span<const Key> keys, std::span<Result> results, uint32_t seed, size_t tableSize,
+		BucketAt&& bucketAt, Resolve&& resolve, Hash&& hash )
+	{
+		static_assert( BatchSize > 0, "BatchSize must be positive" );
+
+		const size_t count = std::min( keys.size(), results.size() );
+		std::array<uint32_t, BatchSize> slots;
+
+		size_t i{ 0 };
+		for ( ; i + BatchSize <= count; i += BatchSize )
+		{
+			// Stage 1: hash and map the whole group (independent work, no memory access)
+			for ( size_t j = 0; j < BatchSize; ++j )
+			{
+				slots[j] = seedMix( seed, hash( keys[i + j] ), tableSize );
+			}
+
+			// Stage 2: start every bucket miss of the group
+			for ( size_t j = 0; j < BatchSize; ++j )
+			{
+				detail::prefetchForRead( bucketAt( slots[j] ) );
+			}
+
+			// Stage 3: compares on (hopefully) arriving lines
+			for ( size_t j = 0; j < BatchSize; ++j )
+			{
+				results[i + j] = resolve( keys[i + j], slots[j] );
+			}
+		}
+
+		for ( ; i < count; ++i )
+		{
+			results[i] = resolve( keys[i], seedMix( seed, hash( keys[i] ), tableSize ) );
+		}
+	}
+} // namespace nfx::core::hashing
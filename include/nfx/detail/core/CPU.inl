@@ -25,21 +25,698 @@
 /**
  * @file CPU.inl
  * @brief CPU feature detection implementation
- * @details Runtime detection of processor features including SSE4.2, AVX, and AVX2
- *          instruction set extensions for optimized algorithm selection
+ * @details Single CPUID sweep with OSXSAVE / XCR0 checks into a constinit snapshot
+ *          that feature queries read with plain loads
  */
 
-#if defined( __GNUC__ )
-#	include <cpuid.h>
+#if defined( __x86_64__ ) || defined( __i386__ ) || defined( _M_X64 ) || defined( _M_IX86 )
+#	define NFX_CORE_CPU_X86 1
+#	if defined( _MSC_VER )
+#		include <intrin.h>
+#		include <immintrin.h>
+#	elif defined( __GNUC__ )
+#		include <cpuid.h>
+#	endif
 #endif
-#if defined( _MSC_VER ) || defined( __SSE4_2__ )
-#	include <nmmintrin.h>
+
+#if defined( __linux__ )
+#	include <sched.h>
 #endif
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace nfx::core::cpu
 {
+	namespace detail
+	{
+		//=====================================================================
+		// CPUID access
+		//=====================================================================
+
+		/** @brief Executes CPUID for a leaf / subleaf; registers are zero if the leaf is unsupported. */
+		inline std::array<uint32_t, 4> cpuid( uint32_t leaf, uint32_t subleaf = 0 ) noexcept
+		{
+			std::array<uint32_t, 4> regs{}; // EAX, EBX, ECX, EDX
+#if defined( NFX_CORE_CPU_X86 ) && defined( _MSC_VER )
+			std::array<int, 4> cpuInfo{};
+			__cpuidex( cpuInfo.data(), static_cast<int>( leaf ), static_cast<int>( subleaf ) );
+			for ( size_t i = 0; i < 4; ++i )
+			{
+				regs[i] = static_cast<uint32_t>( cpuInfo[i] );
+			}
+#elif defined( NFX_CORE_CPU_X86 ) && defined( __GNUC__ )
+			if ( !__get_cpuid_count( leaf, subleaf, &regs[0], &regs[1], &regs[2], &regs[3] ) )
+			{
+				regs.fill( 0 );
+			}
+#else
+			(void)leaf;
+			(void)subleaf;
+#endif
+			return regs;
+		}
+
+		/**
+		 * @brief Executes CPUID without the max-leaf check of cpuid().
+		 * @details For the hypervisor range (0x40000000+), which lies above the basic max leaf
+		 *          but is valid whenever CPUID 1 ECX bit 31 is set; `__get_cpuid_count` zeroes it.
+		 */
+		inline std::array<uint32_t, 4> cpuidUnchecked( uint32_t leaf, uint32_t subleaf = 0 ) noexcept
+		{
+			std::array<uint32_t, 4> regs{}; // EAX, EBX, ECX, EDX
+#if defined( NFX_CORE_CPU_X86 ) && defined( _MSC_VER )
+			std::array<int, 4> cpuInfo{};
+			__cpuidex( cpuInfo.data(), static_cast<int>( leaf ), static_cast<int>( subleaf ) );
+			for ( size_t i = 0; i < 4; ++i )
+			{
+				regs[i] = static_cast<uint32_t>( cpuInfo[i] );
+			}
+#elif defined( NFX_CORE_CPU_X86 ) && defined( __GNUC__ )
+			__cpuid_count( leaf, subleaf, regs[0], regs[1], regs[2], regs[3] );
+#else
+			(void)leaf;
+			(void)subleaf;
+#endif
+			return regs;
+		}
+
+		/** @brief Reads XCR0 (OS-enabled register state); only valid when OSXSAVE is set. */
+		inline uint64_t xgetbv0() noexcept
+		{
+#if defined( NFX_CORE_CPU_X86 ) && defined( _MSC_VER )
+			return _xgetbv( 0 );
+#elif defined( NFX_CORE_CPU_X86 ) && defined( __GNUC__ )
+			// Encoded directly so no -mxsave target flag is required
+			uint32_t eax, edx;
+			__asm__ volatile( "xgetbv" : "=a"( eax ), "=d"( edx ) : "c"( 0 ) );
+			return ( static_cast<uint64_t>( edx ) << 32 ) | eax;
+#else
+			return 0;
+#endif
+		}
+
+		//=====================================================================
+		// Feature detection
+		//=====================================================================
+
+		/** @brief XCR0 bits 1-2: SSE (XMM) and AVX (upper YMM) state. */
+		inline constexpr uint64_t XCR0_YMM_STATE{ 0x6 };
+
+		/** @brief XCR0 bits 1-2 and 5-7: additionally opmask, ZMM_Hi256 and Hi16_ZMM state. */
+		inline constexpr uint64_t XCR0_ZMM_STATE{ 0xE6 };
+
+		/** @brief Runs the CPUID sweep and applies the OS state checks. */
+		inline CpuFeatures detectFeatures() noexcept
+		{
+			CpuFeatures result{};
+
+			const uint32_t maxLeaf = cpuid( 0 )[0];
+			if ( maxLeaf < 1 )
+			{
+				return result;
+			}
+
+			const auto leaf1 = cpuid( 1 );
+			const uint32_t ecx1 = leaf1[2];
+			const auto bit = []( uint32_t reg, int n ) { return ( reg & ( 1u << n ) ) != 0; };
+
+			result.sse42 = bit( ecx1, 20 );
+			result.popcnt = bit( ecx1, 23 );
+			result.pclmul = bit( ecx1, 1 );
+			result.aes = bit( ecx1, 25 );
+
+			// CPUID only says the unit exists; XCR0 says the OS saves its registers on context switch
+			const bool osxsave = bit( ecx1, 27 );
+			const uint64_t xcr0 = osxsave ? xgetbv0() : 0;
+			const bool ymmEnabled = ( xcr0 & XCR0_YMM_STATE ) == XCR0_YMM_STATE;
+			const bool zmmEnabled = ( xcr0 & XCR0_ZMM_STATE ) == XCR0_ZMM_STATE;
+
+			result.avx = ymmEnabled && bit( ecx1, 28 );
+			result.fma = ymmEnabled && bit( ecx1, 12 );
+
+			if ( maxLeaf >= 7 )
+			{
+				const uint32_t ebx7 = cpuid( 7, 0 )[1];
+
+				result.bmi1 = bit( ebx7, 3 );
+				result.bmi2 = bit( ebx7, 8 );
+				result.sha = bit( ebx7, 29 );
+				result.avx2 = result.avx && bit( ebx7, 5 );
+
+				result.avx512f = zmmEnabled && bit( ebx7, 16 );
+				result.avx512dq = result.avx512f && bit( ebx7, 17 );
+				result.avx512cd = result.avx512f && bit( ebx7, 28 );
+				result.avx512bw = result.avx512f && bit( ebx7, 30 );
+				result.avx512vl = result.avx512f && bit( ebx7, 31 );
+			}
+
+			return result;
+		}
+
+		//=====================================================================
+		// Cache hierarchy detection
+		//=====================================================================
+
+		/** @brief Appends a cache, ignoring entries beyond CacheTopology::MAX_CACHES. */
+		inline void addCache( CacheTopology& topology, const CacheInfo& cache ) noexcept
+		{
+			if ( topology.count < CacheTopology::MAX_CACHES )
+			{
+				topology.caches[topology.count++] = cache;
+			}
+		}
+
+		/**
+		 * @brief Walks a deterministic cache parameters leaf (4 on Intel, 0x8000001D on AMD).
+		 * @details Both leaves share one layout: EAX type / level / sharing, EBX line size,
+		 *          partitions and ways, ECX sets. Subleaves end at type 0.
+		 */
+		inline void walkCacheLeaf( uint32_t leaf, CacheTopology& topology ) noexcept
+		{
+			for ( uint32_t subleaf = 0; subleaf < 16; ++subleaf )
+			{
+				const auto regs = cpuid( leaf, subleaf );
+				const uint32_t type = regs[0] & 0x1F;
+				if ( type == 0 )
+				{
+					break;
+				}
+				if ( type > 3 )
+				{
+					continue;
+				}
+
+				const uint32_t lineSize = ( regs[1] & 0xFFF ) + 1;
+				const uint32_t partitions = ( ( regs[1] >> 12 ) & 0x3FF ) + 1;
+				const uint32_t ways = ( ( regs[1] >> 22 ) & 0x3FF ) + 1;
+				const uint32_t sets = regs[2] + 1;
+				const bool fullyAssociative = ( regs[0] & ( 1u << 9 ) ) != 0;
+
+				CacheInfo cache;
+				cache.level = static_cast<uint8_t>( ( regs[0] >> 5 ) & 0x7 );
+				cache.type = static_cast<CacheType>( type );
+				cache.size = ways * partitions * lineSize * sets;
+				cache.associativity = fullyAssociative ? 0 : ways;
+				cache.lineSize = lineSize;
+				cache.sharedBy = ( ( regs[0] >> 14 ) & 0xFFF ) + 1;
+				addCache( topology, cache );
+			}
+		}
+
+		/** @brief Reads the hierarchy from CPUID; empty on non-x86 or when the leaves are masked. */
+		inline CacheTopology detectCachesCpuid() noexcept
+		{
+			CacheTopology topology;
+#if defined( NFX_CORE_CPU_X86 )
+			const auto vendor = cpuid( 0 );
+			const uint32_t maxLeaf = vendor[0];
+
+			// "AuthenticAMD" / "HygonGenuine": EBX 'Auth' / 'Hygo'
+			const bool amd = vendor[1] == 0x68747541 || vendor[1] == 0x6F677948;
+			if ( amd )
+			{
+				const uint32_t maxExtendedLeaf = cpuid( 0x80000000 )[0];
+				const bool topologyExtensions = maxExtendedLeaf >= 0x80000001 && ( cpuid( 0x80000001 )[2] & ( 1u << 22 ) ) != 0;
+				if ( topologyExtensions && maxExtendedLeaf >= 0x8000001D )
+				{
+					walkCacheLeaf( 0x8000001D, topology );
+				}
+			}
+			else if ( maxLeaf >= 4 )
+			{
+				walkCacheLeaf( 4, topology );
+			}
+#endif
+			return topology;
+		}
+
+		/** @brief Reads a small sysfs file into buffer; returns false if it cannot be read. */
+		inline bool readSysfsFile( const char* path, char* buffer, size_t capacity ) noexcept
+		{
+			std::FILE* file = std::fopen( path, "r" );
+			if ( file == nullptr )
+			{
+				return false;
+			}
+
+			const size_t length = std::fread( buffer, 1, capacity - 1, file );
+			std::fclose( file );
+			buffer[length] = '\0';
+
+			return length > 0;
+		}
+
+		/** @brief Parses a sysfs size such as "48K" or "32M" into bytes. */
+		inline uint32_t parseSysfsSize( const char* text ) noexcept
+		{
+			char* end = nullptr;
+			const unsigned long value = std::strtoul( text, &end, 10 );
+			const unsigned long scale = *end == 'K' ? 1024ul : *end == 'M' ? 1024ul * 1024ul : *end == 'G' ? 1024ul * 1024ul * 1024ul : 1ul;
+
+			return static_cast<uint32_t>( value * scale );
+		}
+
+		/** @brief Calls fn for every CPU in a sysfs list such as "0-3,8-11". */
+		template <typename Fn>
+		inline void forEachInSysfsList( const char* text, Fn&& fn ) noexcept
+		{
+			const char* cursor = text;
+			while ( *cursor >= '0' && *cursor <= '9' )
+			{
+				char* end = nullptr;
+				const unsigned long first = std::strtoul( cursor, &end, 10 );
+				unsigned long last = first;
+				if ( *end == '-' )
+				{
+					last = std::strtoul( end + 1, &end, 10 );
+				}
+				for ( unsigned long id = first; id <= last; ++id )
+				{
+					fn( static_cast<uint32_t>( id ) );
+				}
+				cursor = *end == ',' ? end + 1 : end;
+			}
+		}
+
+		/** @brief Counts the CPUs in a sysfs list such as "0-3,8-11". */
+		inline uint32_t countSysfsCpuList( const char* text ) noexcept
+		{
+			uint32_t count = 0;
+			forEachInSysfsList( text, [&count]( uint32_t ) { ++count; } );
+
+			return count;
+		}
+
+		/** @brief Reads the hierarchy of cpu0 from Linux sysfs; empty elsewhere. */
+		inline CacheTopology detectCachesSysfs() noexcept
+		{
+			CacheTopology topology;
+#if defined( __linux__ )
+			char path[96];
+			char text[256];
+			for ( int index = 0; index < 16; ++index )
+			{
+				const auto read = [&]( const char* attribute ) {
+					std::snprintf( path, sizeof( path ), "/sys/devices/system/cpu/cpu0/cache/index%d/%s", index, attribute );
+					return readSysfsFile( path, text, sizeof( text ) );
+				};
+
+				if ( !read( "level" ) )
+				{
+					break;
+				}
+
+				CacheInfo cache;
+				cache.level = static_cast<uint8_t>( std::strtoul( text, nullptr, 10 ) );
+				if ( read( "type" ) )
+				{
+					cache.type = text[0] == 'I' ? CacheType::Instruction : text[0] == 'U' ? CacheType::Unified : CacheType::Data;
+				}
+				if ( read( "size" ) )
+				{
+					cache.size = parseSysfsSize( text );
+				}
+				if ( read( "ways_of_associativity" ) )
+				{
+					cache.associativity = static_cast<uint32_t>( std::strtoul( text, nullptr, 10 ) );
+				}
+				if ( read( "coherency_line_size" ) )
+				{
+					cache.lineSize = static_cast<uint32_t>( std::strtoul( text, nullptr, 10 ) );
+				}
+				if ( read( "shared_cpu_list" ) )
+				{
+					cache.sharedBy = countSysfsCpuList( text );
+				}
+				addCache( topology, cache );
+			}
+
+			// Clamped span: proves the bound to the optimizer (otherwise -Warray-bounds in every includer)
+			const std::span<CacheInfo> caches{ topology.caches.data(), std::min<size_t>( topology.count, topology.caches.size() ) };
+			std::sort( caches.begin(), caches.end(),
+				[]( const CacheInfo& a, const CacheInfo& b ) { return a.level < b.level || ( a.level == b.level && a.type < b.type ); } );
+#endif
+			return topology;
+		}
+
+		/** @brief CPUID first, sysfs when CPUID reports no caches. */
+		inline CacheTopology detectCacheTopology() noexcept
+		{
+			const CacheTopology topology = detectCachesCpuid();
+			return topology.count > 0 ? topology : detectCachesSysfs();
+		}
+
+		//=====================================================================
+		// Processor topology detection
+		//=====================================================================
+
+		/** @brief Sets the calling thread's affinity; CPU numbers may exceed CPU_SETSIZE. */
+		inline bool setAffinity( std::span<const uint32_t> cpus ) noexcept
+		{
+#if defined( __linux__ )
+			if ( cpus.empty() )
+			{
+				return false;
+			}
+
+			const size_t count = static_cast<size_t>( *std::max_element( cpus.begin(), cpus.end() ) ) + 1;
+			cpu_set_t* set = CPU_ALLOC( count );
+			if ( set == nullptr )
+			{
+				return false;
+			}
+
+			const size_t bytes = CPU_ALLOC_SIZE( count );
+			CPU_ZERO_S( bytes, set );
+			for ( const uint32_t cpu : cpus )
+			{
+				CPU_SET_S( cpu, bytes, set );
+			}
+			const bool pinned = ::sched_setaffinity( 0, bytes, set ) == 0;
+			CPU_FREE( set );
+
+			return pinned;
+#else
+			(void)cpus;
+			return false;
+#endif
+		}
+
+		/** @brief Core class of the CPU executing this call (CPUID leaf 0x1A, EAX bits 31-24). */
+		inline CoreType currentCoreType() noexcept
+		{
+			switch ( cpuid( 0x1A )[0] >> 24 )
+			{
+				case 0x40:
+					return CoreType::Performance;
+				case 0x20:
+					return CoreType::Efficiency;
+				default:
+					return CoreType::Unknown;
+			}
+		}
+
+		/** @brief Reads an unsigned value from a sysfs file. */
+		inline bool readSysfsUint( const char* path, uint32_t& value ) noexcept
+		{
+			char text[32];
+			if ( !readSysfsFile( path, text, sizeof( text ) ) )
+			{
+				return false;
+			}
+			value = static_cast<uint32_t>( std::strtoul( text, nullptr, 10 ) );
+
+			return true;
+		}
+
+		/** @brief Fills package, core, SMT and NUMA placement from Linux sysfs. */
+		inline void readSysfsTopology( CpuTopology& topology )
+		{
+#if defined( __linux__ )
+			char path[96];
+			std::vector<char> text( 4096 );
+
+			if ( readSysfsFile( "/sys/devices/system/cpu/online", text.data(), text.size() ) )
+			{
+				forEachInSysfsList( text.data(), [&topology]( uint32_t id ) { topology.cpus.push_back( LogicalCpu{ id } ); } );
+			}
+
+			// Physical cores are identified by (package, core_id); core_id repeats across packages
+			std::vector<std::pair<uint64_t, uint32_t>> coreKeys;
+			for ( auto& cpu : topology.cpus )
+			{
+				uint32_t rawCore = cpu.id;
+				std::snprintf( path, sizeof( path ), "/sys/devices/system/cpu/cpu%u/topology/physical_package_id", cpu.id );
+				readSysfsUint( path, cpu.package );
+				std::snprintf( path, sizeof( path ), "/sys/devices/system/cpu/cpu%u/topology/core_id", cpu.id );
+				readSysfsUint( path, rawCore );
+
+				const uint64_t key = ( static_cast<uint64_t>( cpu.package ) << 32 ) | rawCore;
+				const auto it = std::find_if( coreKeys.begin(), coreKeys.end(), [key]( const auto& entry ) { return entry.first == key; } );
+				if ( it == coreKeys.end() )
+				{
+					cpu.core = static_cast<uint32_t>( coreKeys.size() );
+					cpu.smtIndex = 0;
+					coreKeys.emplace_back( key, 1 );
+				}
+				else
+				{
+					cpu.core = static_cast<uint32_t>( it - coreKeys.begin() );
+					cpu.smtIndex = it->second++;
+				}
+			}
+
+			if ( readSysfsFile( "/sys/devices/system/node/online", text.data(), text.size() ) )
+			{
+				std::vector<uint32_t> nodes;
+				forEachInSysfsList( text.data(), [&nodes]( uint32_t node ) { nodes.push_back( node ); } );
+				for ( const uint32_t node : nodes )
+				{
+					std::snprintf( path, sizeof( path ), "/sys/devices/system/node/node%u/cpulist", node );
+					if ( readSysfsFile( path, text.data(), text.size() ) )
+					{
+						forEachInSysfsList( text.data(), [&topology, node]( uint32_t id ) {
+							for ( auto& cpu : topology.cpus )
+							{
+								if ( cpu.id == id )
+								{
+									cpu.node = node;
+								}
+							}
+						} );
+					}
+				}
+				topology.numaNodes = static_cast<uint32_t>( nodes.size() );
+			}
+#else
+			(void)topology;
+#endif
+		}
+
+		/** @brief Classifies every CPU of a hybrid processor by running CPUID 0x1A on it. */
+		inline void readCoreTypes( CpuTopology& topology ) noexcept
+		{
+#if defined( __linux__ )
+			cpu_set_t saved;
+			CPU_ZERO( &saved );
+			if ( ::sched_getaffinity( 0, sizeof( saved ), &saved ) != 0 )
+			{
+				return;
+			}
+
+			for ( auto& cpu : topology.cpus )
+			{
+				const uint32_t id[]{ cpu.id };
+				if ( setAffinity( id ) )
+				{
+					cpu.type = currentCoreType();
+				}
+			}
+
+			::sched_setaffinity( 0, sizeof( saved ), &saved );
+#else
+			(void)topology;
+#endif
+		}
+
+		/** @brief Detects the processor topology (sysfs, CPUID 0x1A) with a flat fallback. */
+		inline CpuTopology detectCpuTopology()
+		{
+			CpuTopology topology;
+			readSysfsTopology( topology );
+
+			if ( topology.cpus.empty() )
+			{
+				const uint32_t count = std::max( 1u, std::thread::hardware_concurrency() );
+				for ( uint32_t id = 0; id < count; ++id )
+				{
+					topology.cpus.push_back( LogicalCpu{ id, 0, id } );
+				}
+			}
+
+			const uint32_t maxLeaf = cpuid( 0 )[0];
+			topology.hybrid = maxLeaf >= 0x1A && ( cpuid( 7, 0 )[3] & ( 1u << 15 ) ) != 0;
+			if ( topology.hybrid )
+			{
+				readCoreTypes( topology );
+			}
+			else
+			{
+				for ( auto& cpu : topology.cpus )
+				{
+					cpu.type = CoreType::Performance;
+				}
+			}
+
+			std::vector<uint32_t> packages;
+			for ( const auto& cpu : topology.cpus )
+			{
+				if ( std::find( packages.begin(), packages.end(), cpu.package ) == packages.end() )
+				{
+					packages.push_back( cpu.package );
+				}
+				topology.physicalCores = std::max( topology.physicalCores, cpu.core + 1 );
+			}
+			topology.packages = static_cast<uint32_t>( packages.size() );
+			topology.numaNodes = std::max( topology.numaNodes, 1u );
+
+			return topology;
+		}
+
+		//=====================================================================
+		// Processor identification
+		//=====================================================================
+
+		/** @brief Reads vendor, family, model, stepping and brand string from CPUID. */
+		inline CpuIdentity detectIdentity() noexcept
+		{
+			CpuIdentity identity;
+#if defined( NFX_CORE_CPU_X86 )
+			const auto leaf0 = cpuid( 0 );
+			if ( leaf0[0] < 1 )
+			{
+				return identity;
+			}
+
+			// Vendor string is EBX, EDX, ECX
+			char vendor[13]{};
+			std::memcpy( vendor + 0, &leaf0[1], 4 );
+			std::memcpy( vendor + 4, &leaf0[3], 4 );
+			std::memcpy( vendor + 8, &leaf0[2], 4 );
+			const std::string_view vendorName{ vendor };
+			identity.vendor = vendorName == "GenuineIntel"	 ? Vendor::Intel
+							  : vendorName == "AuthenticAMD" ? Vendor::AMD
+							  : vendorName == "HygonGenuine" ? Vendor::Hygon
+															 : Vendor::Unknown;
+
+			const uint32_t signature = cpuid( 1 )[0];
+			const uint32_t baseFamily = ( signature >> 8 ) & 0xF;
+			const uint32_t baseModel = ( signature >> 4 ) & 0xF;
+			identity.stepping = signature & 0xF;
+			identity.family = baseFamily == 0xF ? baseFamily + ( ( signature >> 20 ) & 0xFF ) : baseFamily;
+			identity.model = baseFamily == 0x6 || baseFamily == 0xF ? ( ( ( signature >> 16 ) & 0xF ) << 4 ) | baseModel : baseModel;
+			identity.microarchitecture = decodeMicroarchitecture( identity.vendor, identity.family, identity.model, identity.stepping );
+
+			if ( cpuid( 0x80000000 )[0] >= 0x80000004 )
+			{
+				for ( uint32_t i = 0; i < 3; ++i )
+				{
+					const auto part = cpuid( 0x80000002 + i );
+					std::memcpy( identity.brand + i * 16, part.data(), 16 );
+				}
+			}
+#endif
+			return identity;
+		}
+
+		/** @brief Host tuning: table entry adjusted to the detected features. */
+		inline TuningParameters detectTuning() noexcept
+		{
+			TuningParameters parameters = tuningFor( identity().microarchitecture );
+			parameters.preferAvx512 = parameters.preferAvx512 && features().avx512f;
+			parameters.fastPdepPext = parameters.fastPdepPext && features().bmi2;
+
+			return parameters;
+		}
+
+		//=====================================================================
+		// Snapshot storage
+		//=====================================================================
+
+		/** @brief Snapshot state: not detected, being published, ready. */
+		enum class SnapshotState : uint8_t
+		{
+			Empty = 0,
+			Publishing,
+			Ready
+		};
+
+		/** @brief Detect-once value in constinit storage, read without a static guard. */
+		template <typename T>
+		struct Snapshot
+		{
+			T value{};
+			std::atomic<SnapshotState> state{ SnapshotState::Empty };
+		};
+
+		/** @brief Slow path: publishes a detected value exactly once. */
+		template <typename T>
+		inline void publishSnapshot( Snapshot<T>& snapshot, T detected ) noexcept
+		{
+			SnapshotState expected{ SnapshotState::Empty };
+			if ( snapshot.state.compare_exchange_strong( expected, SnapshotState::Publishing, std::memory_order_acquire ) )
+			{
+				// Move, not copy: nothing can throw between Publishing and Ready
+				snapshot.value = std::move( detected );
+				snapshot.state.store( SnapshotState::Ready, std::memory_order_release );
+				return;
+			}
+
+			// Another thread won the race; its write takes a few nanoseconds
+			while ( snapshot.state.load( std::memory_order_acquire ) != SnapshotState::Ready )
+			{
+				std::this_thread::yield();
+			}
+		}
+
+		/**
+		 * @brief Returns the snapshot, detecting it on first use.
+		 * @details If `detect` throws, nothing is published and the next call detects again.
+		 */
+		template <typename T, typename Detect>
+		inline const T& readSnapshot( Snapshot<T>& snapshot, Detect detect ) noexcept( noexcept( detect() ) )
+		{
+			// Acquire load is a plain MOV on x86; the branch is only taken until first publication
+			if ( snapshot.state.load( std::memory_order_acquire ) != SnapshotState::Ready ) [[unlikely]]
+			{
+				publishSnapshot( snapshot, detect() );
+			}
+
+			return snapshot.value;
+		}
+
+		inline constinit Snapshot<CpuFeatures> g_features{};
+		inline constinit Snapshot<CacheTopology> g_cacheTopology{};
+		inline constinit Snapshot<CpuTopology> g_cpuTopology{};
+		inline constinit Snapshot<CpuIdentity> g_identity{};
+		inline constinit Snapshot<TuningParameters> g_tuning{};
+	} // namespace detail
+
+	//=====================================================================
+	// CPU feature snapshot
+	//=====================================================================
+
+	inline const CpuFeatures& features() noexcept
+	{
+		return detail::readSnapshot( detail::g_features, detail::detectFeatures );
+	}
+
+	namespace detail
+	{
+		/**
+		 * @brief Fills the snapshot during static initialization so later queries never detect.
+		 * @details Inline variables have partially-ordered initialization: in every translation
+		 *          unit that includes this header, this runs before the dynamic initializers
+		 *          defined after the include.
+		 */
+		inline const bool g_featuresInitialized = ( static_cast<void>( features() ), true );
+
+		/** @brief The snapshot as plain loads, without the ready-flag check of features(). */
+		inline const CpuFeatures& initializedFeatures() noexcept
+		{
+			return g_features.value;
+		}
+	} // namespace detail
+
 	//=====================================================================
 	// CPU feature detection
 	//=====================================================================
@@ -50,23 +727,7 @@ namespace nfx::core::cpu
 
 	inline bool hasSSE42Support() noexcept
 	{
-		static const bool s_hasSSE42 = []() {
-			bool hasSupport = false;
-#if defined( _MSC_VER )
-			std::array<int, 4> cpuInfo{};
-			__cpuid( cpuInfo.data(), 1 );
-			hasSupport = ( cpuInfo[2] & ( 1 << 20 ) ) != 0;
-#elif defined( __GNUC__ )
-			unsigned int eax, ebx, ecx, edx;
-			if ( __get_cpuid( 1, &eax, &ebx, &ecx, &edx ) )
-			{
-				hasSupport = ( ecx & ( 1 << 20 ) ) != 0;
-			}
-#endif
-			return hasSupport;
-		}();
-
-		return s_hasSSE42;
+		return detail::initializedFeatures().sse42;
 	}
 
 	//----------------------------
@@ -75,23 +736,7 @@ namespace nfx::core::cpu
 
 	inline bool hasAVXSupport() noexcept
 	{
-		static const bool s_hasAVX = []() {
-			bool hasSupport = false;
-#if defined( _MSC_VER )
-			std::array<int, 4> cpuInfo{};
-			__cpuid( cpuInfo.data(), 1 );					// Basic features leaf
-			hasSupport = ( cpuInfo[2] & ( 1 << 28 ) ) != 0; // ECX bit 28 = AVX
-#elif defined( __GNUC__ )
-			unsigned int eax, ebx, ecx, edx;
-			if ( __get_cpuid( 1, &eax, &ebx, &ecx, &edx ) )
-			{
-				hasSupport = ( ecx & ( 1 << 28 ) ) != 0; // ECX bit 28 = AVX
-			}
-#endif
-			return hasSupport;
-		}();
-
-		return s_hasAVX;
+		return detail::initializedFeatures().avx;
 	}
 
 	//----------------------------
@@ -100,22 +745,301 @@ namespace nfx::core::cpu
 
 	inline bool hasAVX2Support() noexcept
 	{
-		static const bool s_hasAVX2 = []() {
-			bool hasSupport = false;
-#if defined( _MSC_VER )
-			std::array<int, 4> cpuInfo{};
-			__cpuid( cpuInfo.data(), 7 );				   // Extended features leaf
-			hasSupport = ( cpuInfo[1] & ( 1 << 5 ) ) != 0; // EBX bit 5 = AVX2
-#elif defined( __GNUC__ )
-			unsigned int eax, ebx, ecx, edx;
-			if ( __get_cpuid_count( 7, 0, &eax, &ebx, &ecx, &edx ) )
+		return detail::initializedFeatures().avx2;
+	}
+
+	//=====================================================================
+	// Cache hierarchy
+	//=====================================================================
+
+	inline std::span<const CacheInfo> CacheTopology::all() const noexcept
+	{
+		return { caches.data(), count };
+	}
+
+	inline const CacheInfo* CacheTopology::dataCache( uint8_t level ) const noexcept
+	{
+		for ( const CacheInfo& cache : all() )
+		{
+			if ( cache.level == level && cache.type != CacheType::Instruction )
 			{
-				hasSupport = ( ebx & ( 1 << 5 ) ) != 0; // EBX bit 5 = AVX2
+				return &cache;
 			}
-#endif
-			return hasSupport;
-		}();
+		}
+
+		return nullptr;
+	}
+
+	inline size_t CacheTopology::dataCacheSize( uint8_t level ) const noexcept
+	{
+		const CacheInfo* cache = dataCache( level );
+		return cache != nullptr ? cache->size : 0;
+	}
 
-		return s_hasAVX2;
+	inline size_t CacheTopology::lineSize() const noexcept
+	{
+		const CacheInfo* cache = dataCache( 1 );
+		return cache != nullptr && cache->lineSize > 0 ? cache->lineSize : constants::DEFAULT_CACHE_LINE_SIZE;
+	}
+
+	inline const CacheTopology& cacheTopology() noexcept
+	{
+		return detail::readSnapshot( detail::g_cacheTopology, detail::detectCacheTopology );
+	}
+
+	//=====================================================================
+	// Processor topology
+	//=====================================================================
+
+	inline std::vector<uint32_t> CpuTopology::cpusOfType( CoreType type ) const
+	{
+		std::vector<uint32_t> result;
+		for ( const auto& cpu : cpus )
+		{
+			if ( cpu.type == type )
+			{
+				result.push_back( cpu.id );
+			}
+		}
+
+		return result;
+	}
+
+	inline std::vector<uint32_t> CpuTopology::cpusOnNode( uint32_t node ) const
+	{
+		std::vector<uint32_t> result;
+		for ( const auto& cpu : cpus )
+		{
+			if ( cpu.node == node )
+			{
+				result.push_back( cpu.id );
+			}
+		}
+
+		return result;
+	}
+
+	inline std::vector<uint32_t> CpuTopology::primaryThreads() const
+	{
+		std::vector<uint32_t> result;
+		for ( const auto& cpu : cpus )
+		{
+			if ( cpu.smtIndex == 0 )
+			{
+				result.push_back( cpu.id );
+			}
+		}
+
+		return result;
+	}
+
+	inline const CpuTopology& topology()
+	{
+		return detail::readSnapshot( detail::g_cpuTopology, detail::detectCpuTopology );
+	}
+
+	//=====================================================================
+	// Thread affinity
+	//=====================================================================
+
+	inline bool pinCurrentThread( std::span<const uint32_t> cpus ) noexcept
+	{
+		return detail::setAffinity( cpus );
+	}
+
+	inline bool pinCurrentThread( uint32_t cpu ) noexcept
+	{
+		const uint32_t cpus[]{ cpu };
+		return detail::setAffinity( cpus );
+	}
+
+	inline bool pinCurrentThreadToCoreType( CoreType type )
+	{
+		return detail::setAffinity( topology().cpusOfType( type ) );
+	}
+
+	inline bool pinCurrentThreadToNode( uint32_t node )
+	{
+		return detail::setAffinity( topology().cpusOnNode( node ) );
+	}
+
+	//=====================================================================
+	// Processor identification
+	//=====================================================================
+
+	inline const CpuIdentity& identity() noexcept
+	{
+		return detail::readSnapshot( detail::g_identity, detail::detectIdentity );
+	}
+
+	inline constexpr Microarchitecture decodeMicroarchitecture( Vendor vendor, uint32_t family, uint32_t model, uint32_t stepping ) noexcept
+	{
+		using enum Microarchitecture;
+
+		if ( vendor == Vendor::Intel && family == 0x6 )
+		{
+			switch ( model )
+			{
+				case 0x1A:
+				case 0x1E:
+				case 0x1F:
+				case 0x2E:
+					return Nehalem;
+				case 0x25:
+				case 0x2C:
+				case 0x2F:
+					return Westmere;
+				case 0x2A:
+				case 0x2D:
+					return SandyBridge;
+				case 0x3A:
+				case 0x3E:
+					return IvyBridge;
+				case 0x3C:
+				case 0x3F:
+				case 0x45:
+				case 0x46:
+					return Haswell;
+				case 0x3D:
+				case 0x47:
+				case 0x4F:
+				case 0x56:
+					return Broadwell;
+				case 0x4E:
+				case 0x5E:
+				case 0x8E:
+				case 0x9E:
+				case 0xA5:
+				case 0xA6:
+					return Skylake;
+				case 0x55:
+					return stepping >= 10 ? CooperLake : stepping >= 5 ? CascadeLake
+																	   : SkylakeServer;
+				case 0x7D:
+				case 0x7E:
+					return IceLakeClient;
+				case 0x6A:
+				case 0x6C:
+					return IceLakeServer;
+				case 0x8C:
+				case 0x8D:
+					return TigerLake;
+				case 0xA7:
+					return RocketLake;
+				case 0x97:
+				case 0x9A:
+					return AlderLake;
+				case 0xB7:
+				case 0xBA:
+				case 0xBF:
+					return RaptorLake;
+				case 0xAA:
+				case 0xAC:
+					return MeteorLake;
+				case 0x8F:
+					return SapphireRapids;
+				case 0xCF:
+					return EmeraldRapids;
+				case 0xAD:
+				case 0xAE:
+					return GraniteRapids;
+				case 0x5C:
+				case 0x5F:
+					return Goldmont;
+				case 0x7A:
+					return GoldmontPlus;
+				case 0x86:
+				case 0x96:
+				case 0x9C:
+					return Tremont;
+				case 0xBE:
+					return Gracemont;
+				case 0xAF:
+					return SierraForest;
+				default:
+					return Unknown;
+			}
+		}
+
+		if ( vendor == Vendor::Hygon && family == 0x18 )
+		{
+			return Zen;
+		}
+
+		if ( vendor == Vendor::AMD )
+		{
+			switch ( family )
+			{
+				case 0x17:
+					if ( model >= 0x30 )
+					{
+						return Zen2;
+					}
+					return model == 0x08 || model == 0x18 ? ZenPlus : Zen;
+				case 0x19:
+					return ( model >= 0x10 && model <= 0x1F ) || ( model >= 0x60 && model <= 0x7F ) || ( model >= 0xA0 && model <= 0xAF ) ? Zen4 : Zen3;
+				case 0x1A:
+					return Zen5;
+				default:
+					return Unknown;
+			}
+		}
+
+		return Unknown;
+	}
+
+	inline constexpr std::string_view microarchitectureName( Microarchitecture microarchitecture ) noexcept
+	{
+		constexpr std::array<std::string_view, 32> names{
+			"Unknown",
+			"Nehalem", "Westmere", "SandyBridge", "IvyBridge", "Haswell", "Broadwell",
+			"Skylake", "SkylakeServer", "CascadeLake", "CooperLake",
+			"IceLakeClient", "IceLakeServer", "TigerLake", "RocketLake",
+			"AlderLake", "RaptorLake", "MeteorLake",
+			"SapphireRapids", "EmeraldRapids", "GraniteRapids",
+			"Goldmont", "GoldmontPlus", "Tremont", "Gracemont", "SierraForest",
+			"Zen", "ZenPlus", "Zen2", "Zen3", "Zen4", "Zen5" };
+
+		const size_t index = static_cast<size_t>( microarchitecture );
+		return index < names.size() ? names[index] : names[0];
+	}
+
+	//=====================================================================
+	// Tuning parameters
+	//=====================================================================
+
+	inline constexpr TuningParameters tuningFor( Microarchitecture microarchitecture ) noexcept
+	{
+		using enum Microarchitecture;
+
+		TuningParameters parameters;
+		switch ( microarchitecture )
+		{
+			case Zen:
+			case ZenPlus:
+			case Zen2:
+				// PDEP / PEXT are microcoded with data-dependent latency (up to ~300 cycles)
+				parameters.fastPdepPext = false;
+				// crc32: latency 3, one issue per 3 cycles; a second stream finds no free slot
+				parameters.crc32Streams = 1;
+				break;
+			case SkylakeServer:
+			case CascadeLake:
+			case CooperLake:
+				// Heavy 512-bit instructions drop the core to a lower frequency license
+				parameters.preferAvx512 = false;
+				break;
+			default:
+				break;
+		}
+
+		return parameters;
+	}
+
+	inline const TuningParameters& tuning() noexcept
+	{
+		return detail::readSnapshot( detail::g_tuning, detail::detectTuning );
 	}
 } // namespace nfx::core::cpu
+
+#undef NFX_CORE_CPU_X86
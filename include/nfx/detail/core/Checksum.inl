@@ -0,0 +1,341 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Checksum.inl
+ * @brief CRC32-C implementation
+ * @details Slicing-by-8 software kernel, serial and stream-interleaved SSE4.2 kernels
+ *          with table-driven stream combination, and GF(2) polynomial arithmetic for
+ *          crc32cCombine()
+ */
+
+#if defined( __x86_64__ ) || defined( _M_X64 )
+#	define NFX_CORE_CRC32C_HARDWARE 1
+#	include <nmmintrin.h>
+#endif
+
+#include <array>
+#include <cstring>
+
+#include "nfx/core/CPU.h"
+#include "nfx/core/Dispatch.h"
+
+namespace nfx::core::checksum
+{
+	namespace detail
+	{
+		//=====================================================================
+		// GF(2) polynomial arithmetic
+		//=====================================================================
+
+		/** @brief Multiplies two reflected polynomials modulo the CRC32-C polynomial. */
+		inline constexpr uint32_t multiplyModP( uint32_t a, uint32_t b ) noexcept
+		{
+			uint32_t product = 0;
+			for ( uint32_t bit = 1u << 31; bit != 0; bit >>= 1 )
+			{
+				if ( a & bit )
+				{
+					product ^= b;
+				}
+				b = ( b & 1 ) ? ( b >> 1 ) ^ constants::CRC32C_POLYNOMIAL : b >> 1;
+			}
+
+			return product;
+		}
+
+		/** @brief x^(2^k) mod P for k = 0..63, reflected. */
+		inline constexpr std::array<uint32_t, 64> makePowerTable() noexcept
+		{
+			std::array<uint32_t, 64> table{};
+			table[0] = 1u << 30; // x^1
+			for ( size_t k = 1; k < table.size(); ++k )
+			{
+				table[k] = multiplyModP( table[k - 1], table[k - 1] );
+			}
+
+			return table;
+		}
+
+		inline constexpr std::array<uint32_t, 64> g_crc32cPowers = makePowerTable();
+
+		/** @brief x^(8 * bytes) mod P: the operator that appends `bytes` zero bytes to a CRC register. */
+		inline constexpr uint32_t zeroBytesOperator( size_t bytes ) noexcept
+		{
+			uint32_t result = 1u << 31; // x^0
+			for ( size_t k = 3; bytes != 0; bytes >>= 1, ++k )
+			{
+				if ( bytes & 1 )
+				{
+					result = multiplyModP( g_crc32cPowers[k], result );
+				}
+			}
+
+			return result;
+		}
+
+		//=====================================================================
+		// Lookup tables
+		//=====================================================================
+
+		/** @brief Slicing-by-8 tables: entry [k][b] is byte b followed by k zero bytes. */
+		inline constexpr std::array<std::array<uint32_t, 256>, 8> makeSlicingTables() noexcept
+		{
+			std::array<std::array<uint32_t, 256>, 8> tables{};
+			for ( uint32_t byte = 0; byte < 256; ++byte )
+			{
+				uint32_t crc = byte;
+				for ( int bit = 0; bit < 8; ++bit )
+				{
+					crc = ( crc & 1 ) ? ( crc >> 1 ) ^ constants::CRC32C_POLYNOMIAL : crc >> 1;
+				}
+				tables[0][byte] = crc;
+			}
+			for ( size_t k = 1; k < tables.size(); ++k )
+			{
+				for ( uint32_t byte = 0; byte < 256; ++byte )
+				{
+					const uint32_t previous = tables[k - 1][byte];
+					tables[k][byte] = ( previous >> 8 ) ^ tables[0][previous & 0xFF];
+				}
+			}
+
+			return tables;
+		}
+
+		inline constexpr std::array<std::array<uint32_t, 256>, 8> g_crc32cSlicing = makeSlicingTables();
+
+		/** @brief Byte-wise tables of a zero-bytes operator, so applying it costs four lookups. */
+		inline constexpr std::array<std::array<uint32_t, 256>, 4> makeShiftTables( uint32_t op ) noexcept
+		{
+			std::array<std::array<uint32_t, 256>, 4> tables{};
+			for ( size_t k = 0; k < tables.size(); ++k )
+			{
+				for ( uint32_t byte = 0; byte < 256; ++byte )
+				{
+					tables[k][byte] = multiplyModP( op, byte << ( 8 * k ) );
+				}
+			}
+
+			return tables;
+		}
+
+		/** @brief Advances a register past one constants::CRC32C_STREAM_BLOCK of zero bytes. */
+		inline constexpr std::array<std::array<uint32_t, 256>, 4> g_crc32cBlockShift = makeShiftTables( zeroBytesOperator( constants::CRC32C_STREAM_BLOCK ) );
+
+		inline uint32_t shiftBlock( uint32_t crc ) noexcept
+		{
+			return g_crc32cBlockShift[0][crc & 0xFF] ^ g_crc32cBlockShift[1][( crc >> 8 ) & 0xFF] ^
+				   g_crc32cBlockShift[2][( crc >> 16 ) & 0xFF] ^ g_crc32cBlockShift[3][crc >> 24];
+		}
+
+		inline uint64_t load64( const std::byte* p ) noexcept
+		{
+			uint64_t value;
+			std::memcpy( &value, p, sizeof( value ) );
+			return value;
+		}
+
+		//=====================================================================
+		// Kernels
+		//=====================================================================
+
+		/*
+		 * Kernels update the raw register: no initial value, no final XOR. The register is
+		 * linear over GF(2), so reg( s, A || B ) = shift( reg( s, A ), |B| ) ^ reg( 0, B ).
+		 * That is what lets independent streams and crc32cCombine() be stitched together.
+		 */
+
+		/** @brief Slicing-by-8: eight table lookups per 8 bytes, no special instructions. */
+		inline uint32_t crc32cSoftware( uint32_t crc, const std::byte* data, size_t size ) noexcept
+		{
+			const auto& t = g_crc32cSlicing;
+			for ( ; size >= 8; data += 8, size -= 8 )
+			{
+				const uint64_t word = load64( data ) ^ crc;
+				crc = t[7][word & 0xFF] ^ t[6][( word >> 8 ) & 0xFF] ^ t[5][( word >> 16 ) & 0xFF] ^ t[4][( word >> 24 ) & 0xFF] ^
+					  t[3][( word >> 32 ) & 0xFF] ^ t[2][( word >> 40 ) & 0xFF] ^ t[1][( word >> 48 ) & 0xFF] ^ t[0][word >> 56];
+			}
+			for ( ; size > 0; ++data, --size )
+			{
+				crc = ( crc >> 8 ) ^ t[0][( crc ^ static_cast<uint8_t>( *data ) ) & 0xFF];
+			}
+
+			return crc;
+		}
+
+#if defined( NFX_CORE_CRC32C_HARDWARE )
+		/** @brief One SSE4.2 stream: 8 bytes per `crc32` (3-cycle latency bound). */
+		NFX_CORE_TARGET( "sse4.2" )
+		inline uint32_t crc32cHardware( uint32_t crc, const std::byte* data, size_t size ) noexcept
+		{
+			uint64_t state = crc;
+			for ( ; size >= 8; data += 8, size -= 8 )
+			{
+				state = _mm_crc32_u64( state, load64( data ) );
+			}
+			crc = static_cast<uint32_t>( state );
+			for ( ; size > 0; ++data, --size )
+			{
+				crc = _mm_crc32_u8( crc, static_cast<uint8_t>( *data ) );
+			}
+
+			return crc;
+		}
+
+		/**
+		 * @brief `Streams` SSE4.2 streams over adjacent blocks, combined with a table-driven shift.
+		 * @details Each round checksums `Streams` consecutive CRC32C_STREAM_BLOCK blocks in
+		 *          parallel so the `crc32` latency overlaps (throughput bound), then folds
+		 *          them left to right. The tail is finished by one stream.
+		 */
+		template <size_t Streams>
+		NFX_CORE_TARGET( "sse4.2" )
+		inline uint32_t crc32cHardwareInterleaved( uint32_t crc, const std::byte* data, size_t size ) noexcept
+		{
+			constexpr size_t block = constants::CRC32C_STREAM_BLOCK;
+			for ( ; size >= Streams * block; data += Streams * block, size -= Streams * block )
+			{
+				std::array<uint64_t, Streams> state{};
+				state[0] = crc;
+				for ( size_t offset = 0; offset < block; offset += 8 )
+				{
+					for ( size_t s = 0; s < Streams; ++s )
+					{
+						state[s] = _mm_crc32_u64( state[s], load64( data + s * block + offset ) );
+					}
+				}
+
+				crc = static_cast<uint32_t>( state[0] );
+				for ( size_t s = 1; s < Streams; ++s )
+				{
+					crc = shiftBlock( crc ) ^ static_cast<uint32_t>( state[s] );
+				}
+			}
+
+			return crc32cHardware( crc, data, size );
+		}
+
+		/** @brief SSE4.2 entry: as many streams as cpu::tuning() says hide the `crc32` latency. */
+		NFX_CORE_TARGET( "sse4.2" )
+		inline uint32_t crc32cSse42( uint32_t crc, const std::byte* data, size_t size ) noexcept
+		{
+			// Too short for one interleaved round
+			if ( size < 2 * constants::CRC32C_STREAM_BLOCK )
+			{
+				return crc32cHardware( crc, data, size );
+			}
+
+			switch ( cpu::tuning().crc32Streams )
+			{
+				case 0:
+				case 1:
+					return crc32cHardware( crc, data, size );
+				case 2:
+					return crc32cHardwareInterleaved<2>( crc, data, size );
+				case 3:
+					return crc32cHardwareInterleaved<3>( crc, data, size );
+				default:
+					return crc32cHardwareInterleaved<4>( crc, data, size );
+			}
+		}
+#endif
+
+		using Crc32cKernel = uint32_t( uint32_t, const std::byte*, size_t );
+
+		/** @brief Process-wide CRC32-C kernel, best first. */
+		inline constinit auto g_crc32c = cpu::makeDispatcher<Crc32cKernel>(
+#if defined( NFX_CORE_CRC32C_HARDWARE )
+			cpu::DispatchCandidate<Crc32cKernel>{ "sse42", cpu::Feature::SSE42, &crc32cSse42 },
+#endif
+			cpu::DispatchCandidate<Crc32cKernel>{ "software", cpu::Feature::None, &crc32cSoftware } );
+	} // namespace detail
+
+	//=====================================================================
+	// CRC32-C
+	//=====================================================================
+
+	inline uint32_t crc32c( std::span<const std::byte> data ) noexcept
+	{
+		return detail::g_crc32c( constants::CRC32C_INITIAL, data.data(), data.size() ) ^ constants::CRC32C_FINAL_XOR;
+	}
+
+	inline uint32_t crc32c( std::string_view data ) noexcept
+	{
+		return crc32c( std::as_bytes( std::span{ data.data(), data.size() } ) );
+	}
+
+	inline uint32_t crc32cExtend( uint32_t crc, std::span<const std::byte> data ) noexcept
+	{
+		return detail::g_crc32c( crc ^ constants::CRC32C_FINAL_XOR, data.data(), data.size() ) ^ constants::CRC32C_FINAL_XOR;
+	}
+
+	inline uint32_t crc32cCombine( uint32_t crcA, uint32_t crcB, size_t lengthB ) noexcept
+	{
+		// The initial value and final XOR of B cancel against the zero-extended A
+		return detail::multiplyModP( detail::zeroBytesOperator( lengthB ), crcA ) ^ crcB;
+	}
+
+	//=====================================================================
+	// Blocks with a trailing CRC
+	//=====================================================================
+
+	inline uint32_t storeCrc32c( std::span<std::byte> block ) noexcept
+	{
+		if ( block.size() < constants::CRC32C_SIZE )
+		{
+			return 0;
+		}
+
+		const size_t payload = block.size() - constants::CRC32C_SIZE;
+		const uint32_t crc = crc32c( block.first( payload ) );
+		for ( size_t i = 0; i < constants::CRC32C_SIZE; ++i )
+		{
+			block[payload + i] = static_cast<std::byte>( crc >> ( 8 * i ) );
+		}
+
+		return crc;
+	}
+
+	inline bool verifyCrc32c( std::span<const std::byte> block ) noexcept
+	{
+		return block.size() >= constants::CRC32C_SIZE && crc32c( block ) == constants::CRC32C_RESIDUE;
+	}
+
+	inline bool verifyCrc32c( std::span<const std::byte> data, uint32_t expected ) noexcept
+	{
+		return crc32c( data ) == expected;
+	}
+
+	//=====================================================================
+	// Introspection
+	//=====================================================================
+
+	inline std::string_view crc32cImplementation() noexcept
+	{
+		return detail::g_crc32c.selectedName();
+	}
+} // namespace nfx::core::checksum
+
+#undef NFX_CORE_CRC32C_HARDWARE
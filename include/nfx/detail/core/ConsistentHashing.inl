@@ -0,0 +1,168 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ConsistentHashing.inl
+ * @brief Consistent hashing implementation
+ * @details Jump consistent hash (Lamping & Veach) and logarithmic-method weighted
+ *          rendezvous hashing
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+#include "nfx/core/Hashing.h"
+
+namespace nfx::core::hashing
+{
+	namespace detail
+	{
+		/** @brief Maps a 64-bit hash to a uniform double in the open interval (0, 1). */
+		inline double unitInterval( uint64_t hash ) noexcept
+		{
+			// Top 53 bits plus one half-ulp keeps the value strictly inside (0, 1)
+			return ( static_cast<double>( hash >> 11 ) + 0.5 ) * 0x1.0p-53;
+		}
+	} // namespace detail
+
+	//=====================================================================
+	// Consistent hashing
+	//=====================================================================
+
+	//----------------------------------------------
+	// Jump consistent hash
+	//----------------------------------------------
+
+	inline constexpr uint32_t jumpConsistentHash( uint64_t hash, uint32_t buckets ) noexcept
+	{
+		int64_t bucket{ -1 };
+		int64_t next{ 0 };
+
+		while ( next < static_cast<int64_t>( buckets ) )
+		{
+			bucket = next;
+			hash = hash * constants::DEFAULT_JUMP_HASH_LCG + 1;
+			next = static_cast<int64_t>( static_cast<double>( bucket + 1 ) *
+										 ( static_cast<double>( int64_t{ 1 } << 31 ) / static_cast<double>( ( hash >> 33 ) + 1 ) ) );
+		}
+
+		return bucket < 0 ? 0u : static_cast<uint32_t>( bucket );
+	}
+
+	inline void jumpConsistentHash( std::span<const uint64_t> hashes, uint32_t buckets, std::span<uint32_t> shards ) noexcept
+	{
+		const size_t count = std::min( hashes.size(), shards.size() );
+
+		// Independent keys: unrolled so several divide chains are in flight at once
+		size_t i{ 0 };
+		for ( ; i + 4 <= count; i += 4 )
+		{
+			shards[i] = jumpConsistentHash( hashes[i], buckets );
+			shards[i + 1] = jumpConsistentHash( hashes[i + 1], buckets );
+			shards[i + 2] = jumpConsistentHash( hashes[i + 2], buckets );
+			shards[i + 3] = jumpConsistentHash( hashes[i + 3], buckets );
+		}
+		for ( ; i < count; ++i )
+		{
+			shards[i] = jumpConsistentHash( hashes[i], buckets );
+		}
+	}
+
+	//----------------------------------------------
+	// Rendezvous (highest random weight) hashing
+	//----------------------------------------------
+
+	inline size_t rendezvousHash( uint64_t hash, std::span<const RendezvousNode> nodes ) noexcept
+	{
+		size_t best = nodes.size();
+		double bestScore = -std::numeric_limits<double>::infinity();
+
+		for ( size_t n = 0; n < nodes.size(); ++n )
+		{
+			// ln(u) < 0, so ln(u) / weight is maximized by the logarithmic-method winner
+			const double score = std::log( detail::unitInterval( combine( hash, nodes[n].id ) ) ) * ( 1.0 / nodes[n].weight );
+			if ( score > bestScore )
+			{
+				bestScore = score;
+				best = n;
+			}
+		}
+
+		return best;
+	}
+
+	inline constexpr size_t rendezvousHash( uint64_t hash, std::span<const uint64_t> nodeIds ) noexcept
+	{
+		size_t best = nodeIds.size();
+		uint64_t bestScore{ 0 };
+
+		for ( size_t n = 0; n < nodeIds.size(); ++n )
+		{
+			const uint64_t score = combine( hash, nodeIds[n] );
+			if ( best == nodeIds.size() || score > bestScore )
+			{
+				bestScore = score;
+				best = n;
+			}
+		}
+
+		return best;
+	}
+
+	inline void rendezvousHash( std::span<const uint64_t> hashes, std::span<const RendezvousNode> nodes, std::span<size_t> selected ) noexcept
+	{
+		constexpr size_t block = 64;
+		const size_t count = std::min( hashes.size(), selected.size() );
+
+		std::array<double, block> bestScore;
+		for ( size_t base = 0; base < count; base += block )
+		{
+			const size_t len = std::min( block, count - base );
+			bestScore.fill( -std::numeric_limits<double>::infinity() );
+			for ( size_t i = 0; i < len; ++i )
+			{
+				selected[base + i] = nodes.size();
+			}
+
+			// Node-major within a block: one reciprocal per node, independent keys in the inner loop
+			for ( size_t n = 0; n < nodes.size(); ++n )
+			{
+				const double inverseWeight = 1.0 / nodes[n].weight;
+				const uint64_t id = nodes[n].id;
+
+				for ( size_t i = 0; i < len; ++i )
+				{
+					const double score = std::log( detail::unitInterval( combine( hashes[base + i], id ) ) ) * inverseWeight;
+					if ( score > bestScore[i] )
+					{
+						bestScore[i] = score;
+						selected[base + i] = n;
+					}
+				}
+			}
+		}
+	}
+} // namespace nfx::core::hashing
@@ -0,0 +1,453 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file CountMinSketch.inl
+ * @brief Count-Min sketch and space-saving top-k implementation
+ * @details Double-hashed row indexing, conservative update, prefetching batch update
+ *          and heap-based space-saving summary
+ */
+
+#if defined( _MSC_VER ) && !defined( __clang__ )
+#	include <xmmintrin.h>
+#endif
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "nfx/core/Hashing.h"
+
+namespace nfx::core::sketch
+{
+	//=====================================================================
+	// CountMinSketch class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <size_t Depth, typename Allocator>
+	inline CountMinSketch<Depth, Allocator>::CountMinSketch( size_t width, const Allocator& allocator )
+		: m_width{ std::bit_ceil( std::clamp<size_t>( width, 16, constants::CMS_MAX_WIDTH ) ) },
+		  m_mask{ m_width - 1 },
+		  m_counters( Depth * m_width, 0, allocator )
+	{
+	}
+
+	template <size_t Depth, typename Allocator>
+	inline CountMinSketch<Depth, Allocator> CountMinSketch<Depth, Allocator>::fromErrorRate( double epsilon, const Allocator& allocator )
+	{
+		if ( !( epsilon > 0.0 ) || !std::isfinite( epsilon ) )
+		{
+			throw std::invalid_argument{ "CountMinSketch epsilon must be positive and finite" };
+		}
+
+		// Clamp in floating point: a tiny epsilon overflows size_t
+		constexpr double e = 2.718281828459045;
+		const double width = std::min( std::ceil( e / epsilon ), static_cast<double>( constants::CMS_MAX_WIDTH ) );
+
+		return CountMinSketch{ static_cast<size_t>( width ), allocator };
+	}
+
+	//----------------------------------------------
+	// Updates
+	//----------------------------------------------
+
+	template <size_t Depth, typename Allocator>
+	inline uint32_t CountMinSketch<Depth, Allocator>::add( uint64_t hash, uint32_t count ) noexcept
+	{
+		m_total += count;
+
+		return update( indices( hash ), count );
+	}
+
+	template <size_t Depth, typename Allocator>
+	inline void CountMinSketch<Depth, Allocator>::add( std::span<const uint64_t> hashes ) noexcept
+	{
+		constexpr size_t batch = constants::CMS_BATCH_SIZE;
+		std::array<std::array<size_t, Depth>, batch> slots;
+
+		size_t i{ 0 };
+		for ( ; i + batch <= hashes.size(); i += batch )
+		{
+			// Stage 1: hash and prefetch every counter the batch will touch
+			for ( size_t j = 0; j < batch; ++j )
+			{
+				slots[j] = indices( hashes[i + j] );
+				for ( size_t row = 0; row < Depth; ++row )
+				{
+#if defined( _MSC_VER ) && !defined( __clang__ )
+					_mm_prefetch( reinterpret_cast<const char*>( &m_counters[slots[j][row]] ), _MM_HINT_T0 );
+#elif defined( __GNUC__ )
+					__builtin_prefetch( &m_counters[slots[j][row]], 1 );
+#endif
+				}
+			}
+
+			// Stage 2: conservative updates on (hopefully) cached lines
+			for ( size_t j = 0; j < batch; ++j )
+			{
+				update( slots[j], 1 );
+			}
+		}
+
+		for ( ; i < hashes.size(); ++i )
+		{
+			update( indices( hashes[i] ), 1 );
+		}
+
+		m_total += hashes.size();
+	}
+
+	//----------------------------------------------
+	// Queries
+	//----------------------------------------------
+
+	template <size_t Depth, typename Allocator>
+	inline uint32_t CountMinSketch<Depth, Allocator>::estimate( uint64_t hash ) const noexcept
+	{
+		const auto slots = indices( hash );
+
+		uint32_t result = m_counters[slots[0]];
+		for ( size_t row = 1; row < Depth; ++row )
+		{
+			result = std::min( result, m_counters[slots[row]] );
+		}
+
+		return result;
+	}
+
+	template <size_t Depth, typename Allocator>
+	inline uint64_t CountMinSketch<Depth, Allocator>::totalCount() const noexcept
+	{
+		return m_total;
+	}
+
+	template <size_t Depth, typename Allocator>
+	inline size_t CountMinSketch<Depth, Allocator>::width() const noexcept
+	{
+		return m_width;
+	}
+
+	//----------------------------------------------
+	// Merging and reset
+	//----------------------------------------------
+
+	template <size_t Depth, typename Allocator>
+	inline bool CountMinSketch<Depth, Allocator>::merge( const CountMinSketch& other ) noexcept
+	{
+		if ( other.m_width != m_width )
+		{
+			return false;
+		}
+
+		for ( size_t i = 0; i < m_counters.size(); ++i )
+		{
+			const uint32_t sum = m_counters[i] + other.m_counters[i];
+			m_counters[i] = sum < m_counters[i] ? std::numeric_limits<uint32_t>::max() : sum;
+		}
+		m_total += other.m_total;
+
+		return true;
+	}
+
+	template <size_t Depth, typename Allocator>
+	inline void CountMinSketch<Depth, Allocator>::clear() noexcept
+	{
+		std::fill( m_counters.begin(), m_counters.end(), 0u );
+		m_total = 0;
+	}
+
+	//----------------------------------------------
+	// Private implementation
+	//----------------------------------------------
+
+	template <size_t Depth, typename Allocator>
+	inline std::array<size_t, Depth> CountMinSketch<Depth, Allocator>::indices( uint64_t hash ) const noexcept
+	{
+		// Kirsch-Mitzenmacher: g_i(x) = h1(x) + i * h2(x), h2 forced odd so rows never coincide
+		const uint64_t mixed = static_cast<uint64_t>( hashing::hashInteger( hash ) );
+		const size_t h1 = static_cast<size_t>( mixed & 0xFFFFFFFFu );
+		const size_t h2 = static_cast<size_t>( mixed >> 32 ) | 1u;
+
+		std::array<size_t, Depth> slots;
+		for ( size_t row = 0; row < Depth; ++row )
+		{
+			slots[row] = row * m_width + ( ( h1 + row * h2 ) & m_mask );
+		}
+
+		return slots;
+	}
+
+	template <size_t Depth, typename Allocator>
+	inline uint32_t CountMinSketch<Depth, Allocator>::update( const std::array<size_t, Depth>& slots, uint32_t count ) noexcept
+	{
+		uint32_t current = m_counters[slots[0]];
+		for ( size_t row = 1; row < Depth; ++row )
+		{
+			current = std::min( current, m_counters[slots[row]] );
+		}
+
+		const uint32_t target = current > std::numeric_limits<uint32_t>::max() - count
+									? std::numeric_limits<uint32_t>::max()
+									: current + count;
+
+		// Conservative update: never raise a counter above the new minimum estimate
+		for ( size_t row = 0; row < Depth; ++row )
+		{
+			uint32_t& counter = m_counters[slots[row]];
+			counter = std::max( counter, target );
+		}
+
+		return target;
+	}
+
+	//=====================================================================
+	// TopK class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename Key, typename Hash>
+	inline TopK<Key, Hash>::TopK( size_t capacity )
+		: m_capacity{ std::max<size_t>( capacity, 1 ) }
+	{
+		m_heap.reserve( m_capacity );
+		m_index.reserve( m_capacity );
+	}
+
+	//----------------------------------------------
+	// Updates
+	//----------------------------------------------
+
+	template <typename Key, typename Hash>
+	inline void TopK<Key, Hash>::add( const Key& key, uint64_t count )
+	{
+		if ( const auto it = m_index.find( key ); it != m_index.end() )
+		{
+			m_heap[it->second].count += count;
+			siftDown( it->second );
+			return;
+		}
+
+		if ( m_heap.size() < m_capacity )
+		{
+			m_heap.push_back( Entry{ key, count, 0 } );
+			m_index.emplace( key, m_heap.size() - 1 );
+			siftUp( m_heap.size() - 1 );
+			return;
+		}
+
+		// Space-saving: the newcomer inherits the evicted minimum as its error bound
+		const uint64_t minimum = m_heap.front().count;
+		replaceMin( key, minimum + count, minimum );
+	}
+
+	template <typename Key, typename Hash>
+	inline void TopK<Key, Hash>::offer( const Key& key, uint64_t estimate )
+	{
+		if ( const auto it = m_index.find( key ); it != m_index.end() )
+		{
+			Entry& entry = m_heap[it->second];
+			if ( estimate > entry.count )
+			{
+				entry.count = estimate;
+				siftDown( it->second );
+			}
+			return;
+		}
+
+		if ( m_heap.size() < m_capacity )
+		{
+			m_heap.push_back( Entry{ key, estimate, 0 } );
+			m_index.emplace( key, m_heap.size() - 1 );
+			siftUp( m_heap.size() - 1 );
+			return;
+		}
+
+		if ( estimate > m_heap.front().count )
+		{
+			replaceMin( key, estimate, 0 );
+		}
+	}
+
+	template <typename Key, typename Hash>
+	inline void TopK<Key, Hash>::merge( const TopK& other )
+	{
+		const uint64_t ownMin = m_heap.size() == m_capacity ? minCount() : 0;
+		const uint64_t otherMin = other.m_heap.size() == other.m_capacity ? other.minCount() : 0;
+
+		std::vector<Entry> combined;
+		combined.reserve( m_heap.size() + other.m_heap.size() );
+
+		for ( const Entry& entry : m_heap )
+		{
+			if ( const auto it = other.m_index.find( entry.key ); it != other.m_index.end() )
+			{
+				const Entry& match = other.m_heap[it->second];
+				combined.push_back( Entry{ entry.key, entry.count + match.count, entry.error + match.error } );
+			}
+			else
+			{
+				combined.push_back( Entry{ entry.key, entry.count + otherMin, entry.error + otherMin } );
+			}
+		}
+		for ( const Entry& entry : other.m_heap )
+		{
+			if ( m_index.find( entry.key ) == m_index.end() )
+			{
+				combined.push_back( Entry{ entry.key, entry.count + ownMin, entry.error + ownMin } );
+			}
+		}
+
+		if ( combined.size() > m_capacity )
+		{
+			std::nth_element( combined.begin(), combined.begin() + static_cast<std::ptrdiff_t>( m_capacity ), combined.end(),
+				[]( const Entry& a, const Entry& b ) { return a.count > b.count; } );
+			combined.resize( m_capacity );
+		}
+
+		clear();
+		for ( const Entry& entry : combined )
+		{
+			m_heap.push_back( entry );
+			m_index.emplace( entry.key, m_heap.size() - 1 );
+			siftUp( m_heap.size() - 1 );
+		}
+	}
+
+	template <typename Key, typename Hash>
+	inline void TopK<Key, Hash>::clear() noexcept
+	{
+		m_heap.clear();
+		m_index.clear();
+	}
+
+	//----------------------------------------------
+	// Queries
+	//----------------------------------------------
+
+	template <typename Key, typename Hash>
+	inline std::vector<typename TopK<Key, Hash>::Entry> TopK<Key, Hash>::entries() const
+	{
+		std::vector<Entry> result{ m_heap };
+		std::sort( result.begin(), result.end(), []( const Entry& a, const Entry& b ) { return a.count > b.count; } );
+
+		return result;
+	}
+
+	template <typename Key, typename Hash>
+	inline bool TopK<Key, Hash>::contains( const Key& key ) const
+	{
+		return m_index.find( key ) != m_index.end();
+	}
+
+	template <typename Key, typename Hash>
+	inline uint64_t TopK<Key, Hash>::minCount() const noexcept
+	{
+		return m_heap.size() < m_capacity ? 0 : m_heap.front().count;
+	}
+
+	template <typename Key, typename Hash>
+	inline size_t TopK<Key, Hash>::size() const noexcept
+	{
+		return m_heap.size();
+	}
+
+	template <typename Key, typename Hash>
+	inline size_t TopK<Key, Hash>::capacity() const noexcept
+	{
+		return m_capacity;
+	}
+
+	//----------------------------------------------
+	// Private implementation
+	//----------------------------------------------
+
+	template <typename Key, typename Hash>
+	inline void TopK<Key, Hash>::siftUp( size_t pos )
+	{
+		while ( pos > 0 )
+		{
+			const size_t parent = ( pos - 1 ) / 2;
+			if ( m_heap[parent].count <= m_heap[pos].count )
+			{
+				break;
+			}
+			swapEntries( parent, pos );
+			pos = parent;
+		}
+	}
+
+	template <typename Key, typename Hash>
+	inline void TopK<Key, Hash>::siftDown( size_t pos )
+	{
+		const size_t size = m_heap.size();
+		while ( true )
+		{
+			const size_t left = 2 * pos + 1;
+			const size_t right = left + 1;
+			size_t smallest = pos;
+
+			if ( left < size && m_heap[left].count < m_heap[smallest].count )
+			{
+				smallest = left;
+			}
+			if ( right < size && m_heap[right].count < m_heap[smallest].count )
+			{
+				smallest = right;
+			}
+			if ( smallest == pos )
+			{
+				break;
+			}
+
+			swapEntries( pos, smallest );
+			pos = smallest;
+		}
+	}
+
+	template <typename Key, typename Hash>
+	inline void TopK<Key, Hash>::swapEntries( size_t a, size_t b )
+	{
+		std::swap( m_heap[a], m_heap[b] );
+		m_index[m_heap[a].key] = a;
+		m_index[m_heap[b].key] = b;
+	}
+
+	template <typename Key, typename Hash>
+	inline void TopK<Key, Hash>::replaceMin( const Key& key, uint64_t count, uint64_t error )
+	{
+		m_index.erase( m_heap.front().key );
+		m_heap.front() = Entry{ key, count, error };
+		m_index.emplace( key, 0 );
+		siftDown( 0 );
+	}
+} // namespace nfx::core::sketch
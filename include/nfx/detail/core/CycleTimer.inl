@@ -0,0 +1,217 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/**
+ * @file CycleTimer.inl
+ * @brief Cycle-counter timing implementation
+ * @details Counter reads, CPUID property detection and frequency calibration
+ */
+
+#if defined( __x86_64__ ) || defined( __i386__ ) || defined( _M_X64 ) || defined( _M_IX86 )
+#	define NFX_CORE_TSC_X86 1
+#	if defined( _MSC_VER )
+#		include <intrin.h>
+#	else
+#		include <x86intrin.h>
+#	endif
+#elif defined( __aarch64__ ) && defined( __GNUC__ )
+#	define NFX_CORE_TSC_ARM64 1
+#endif
+
+#include <chrono>
+#include <cstring>
+
+namespace nfx::core::cpu
+{
+	//=====================================================================
+	// Counter reads
+	//=====================================================================
+
+	template <TscRead Mode>
+	inline uint64_t readCycles() noexcept
+	{
+#if defined( NFX_CORE_TSC_X86 )
+		if constexpr ( Mode == TscRead::Begin )
+		{
+			_mm_lfence();
+			return __rdtsc();
+		}
+		else if constexpr ( Mode == TscRead::End )
+		{
+			unsigned int aux;
+			const uint64_t cycles = __rdtscp( &aux );
+			_mm_lfence();
+			return cycles;
+		}
+		else if constexpr ( Mode == TscRead::Serialized )
+		{
+			static_cast<void>( detail::cpuid( 0 ) );
+			return __rdtsc();
+		}
+		else
+		{
+			return __rdtsc();
+		}
+#elif defined( NFX_CORE_TSC_ARM64 )
+		uint64_t cycles;
+		if constexpr ( Mode != TscRead::Relaxed )
+		{
+			__asm__ volatile( "isb" ::: "memory" );
+		}
+		__asm__ volatile( "mrs %0, cntvct_el0" : "=r"( cycles ) );
+		return cycles;
+#else
+		return static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now().time_since_epoch() ).count() );
+#endif
+	}
+
+	//=====================================================================
+	// Counter properties
+	//=====================================================================
+
+	inline bool TscInfo::reliable() const noexcept
+	{
+		return invariant;
+	}
+
+	namespace detail
+	{
+		/** @brief Measures the counter frequency against steady_clock over `window`. */
+		inline double measureTscFrequency( std::chrono::nanoseconds window ) noexcept
+		{
+			using Clock = std::chrono::steady_clock;
+
+			const Clock::time_point clockStart = Clock::now();
+			const uint64_t cyclesStart = readCycles<TscRead::Begin>();
+			Clock::time_point clockEnd = clockStart;
+			while ( clockEnd - clockStart < window )
+			{
+				clockEnd = Clock::now();
+			}
+			const uint64_t cyclesEnd = readCycles<TscRead::Begin>();
+
+			const double seconds = std::chrono::duration<double>( clockEnd - clockStart ).count();
+			return static_cast<double>( cyclesEnd - cyclesStart ) / seconds;
+		}
+
+		/** @brief Reads counter properties from CPUID and calibrates the frequency. */
+		inline TscInfo detectTscInfo() noexcept
+		{
+			TscInfo info;
+#if defined( NFX_CORE_TSC_X86 )
+			const uint32_t maxLeaf = cpuid( 0 )[0];
+			const uint32_t maxExtendedLeaf = cpuid( 0x80000000 )[0];
+
+			info.hypervisor = ( cpuid( 1 )[2] & ( 1u << 31 ) ) != 0;
+			if ( info.hypervisor )
+			{
+				// Above the basic max leaf, so cpuid() would report zeros
+				const auto vendor = cpuidUnchecked( 0x40000000 );
+				std::memcpy( info.hypervisorVendor + 0, &vendor[1], 4 );
+				std::memcpy( info.hypervisorVendor + 4, &vendor[2], 4 );
+				std::memcpy( info.hypervisorVendor + 8, &vendor[3], 4 );
+			}
+			if ( maxExtendedLeaf >= 0x80000001 )
+			{
+				info.rdtscp = ( cpuid( 0x80000001 )[3] & ( 1u << 27 ) ) != 0;
+			}
+			if ( maxExtendedLeaf >= 0x80000007 )
+			{
+				info.invariant = ( cpuid( 0x80000007 )[3] & ( 1u << 8 ) ) != 0;
+			}
+
+			// Leaf 0x15: TSC = crystal * EBX / EAX; ECX is the crystal frequency when enumerated
+			if ( maxLeaf >= 0x15 )
+			{
+				const auto ratio = cpuid( 0x15 );
+				if ( ratio[0] != 0 && ratio[1] != 0 && ratio[2] != 0 )
+				{
+					info.frequencyHz = static_cast<double>( ratio[2] ) * ratio[1] / ratio[0];
+					info.frequencyFromCpuid = true;
+				}
+			}
+#elif defined( NFX_CORE_TSC_ARM64 )
+			// The generic timer is architecturally constant-rate
+			uint64_t frequency;
+			__asm__ volatile( "mrs %0, cntfrq_el0" : "=r"( frequency ) );
+			info.invariant = true;
+			info.frequencyHz = static_cast<double>( frequency );
+			info.frequencyFromCpuid = frequency != 0;
+#else
+			info.invariant = true;
+			info.frequencyHz = 1e9;
+			info.frequencyFromCpuid = true;
+#endif
+			if ( info.frequencyHz <= 0.0 )
+			{
+				info.frequencyHz = measureTscFrequency( std::chrono::milliseconds{ 20 } );
+			}
+			info.nanosecondsPerCycle = 1e9 / info.frequencyHz;
+
+			return info;
+		}
+
+		inline constinit Snapshot<TscInfo> g_tscInfo{};
+	} // namespace detail
+
+	inline const TscInfo& tscInfo() noexcept
+	{
+		return detail::readSnapshot( detail::g_tscInfo, detail::detectTscInfo );
+	}
+
+	inline double cyclesToNanoseconds( uint64_t cycles ) noexcept
+	{
+		return static_cast<double>( cycles ) * tscInfo().nanosecondsPerCycle;
+	}
+
+	//=====================================================================
+	// CycleTimer class
+	//=====================================================================
+
+	inline CycleTimer::CycleTimer() noexcept
+		: m_rdtscp{ tscInfo().rdtscp },
+		  m_start{ readCycles<TscRead::Begin>() }
+	{
+	}
+
+	inline void CycleTimer::restart() noexcept
+	{
+		m_start = readCycles<TscRead::Begin>();
+	}
+
+	inline uint64_t CycleTimer::elapsedCycles() const noexcept
+	{
+		const uint64_t now = m_rdtscp ? readCycles<TscRead::End>() : readCycles<TscRead::Begin>();
+		return now - m_start;
+	}
+
+	inline double CycleTimer::elapsedNanoseconds() const noexcept
+	{
+		return cyclesToNanoseconds( elapsedCycles() );
+	}
+} // namespace nfx::core::cpu
+
+#undef NFX_CORE_TSC_X86
+#undef NFX_CORE_TSC_ARM64
@@ -0,0 +1,418 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/**
+ * @file Dispatch.inl
+ * @brief Runtime function multiversioning implementation
+ * @details Feature set operations, dispatch mask handling and Dispatcher resolution
+ */
+
+#include <cstdlib>
+
+namespace nfx::core::cpu
+{
+	//=====================================================================
+	// Feature sets
+	//=====================================================================
+
+	inline constexpr Feature operator|( Feature lhs, Feature rhs ) noexcept
+	{
+		return static_cast<Feature>( static_cast<uint32_t>( lhs ) | static_cast<uint32_t>( rhs ) );
+	}
+
+	inline constexpr Feature operator&( Feature lhs, Feature rhs ) noexcept
+	{
+		return static_cast<Feature>( static_cast<uint32_t>( lhs ) & static_cast<uint32_t>( rhs ) );
+	}
+
+	inline constexpr Feature operator~( Feature features ) noexcept
+	{
+		return static_cast<Feature>( ~static_cast<uint32_t>( features ) & static_cast<uint32_t>( Feature::All ) );
+	}
+
+	inline constexpr bool hasAll( Feature available, Feature required ) noexcept
+	{
+		return ( available & required ) == required;
+	}
+
+	inline constexpr Feature toFeatureSet( const CpuFeatures& features ) noexcept
+	{
+		Feature set{ Feature::None };
+		const auto add = [&set]( bool supported, Feature feature ) {
+			if ( supported )
+			{
+				set = set | feature;
+			}
+		};
+
+		add( features.sse42, Feature::SSE42 );
+		add( features.popcnt, Feature::POPCNT );
+		add( features.pclmul, Feature::PCLMUL );
+		add( features.aes, Feature::AES );
+		add( features.avx, Feature::AVX );
+		add( features.avx2, Feature::AVX2 );
+		add( features.bmi1, Feature::BMI1 );
+		add( features.bmi2, Feature::BMI2 );
+		add( features.fma, Feature::FMA );
+		add( features.avx512f, Feature::AVX512F );
+		add( features.avx512dq, Feature::AVX512DQ );
+		add( features.avx512cd, Feature::AVX512CD );
+		add( features.avx512bw, Feature::AVX512BW );
+		add( features.avx512vl, Feature::AVX512VL );
+		add( features.sha, Feature::SHA );
+
+		return set;
+	}
+
+	inline constexpr Feature toFeatureSet( const TuningParameters& parameters ) noexcept
+	{
+		Feature set{ Feature::None };
+		if ( parameters.fastPdepPext )
+		{
+			set = set | Feature::FastPdepPext;
+		}
+		if ( parameters.preferAvx512 )
+		{
+			set = set | Feature::FastAvx512;
+		}
+
+		return set;
+	}
+
+	inline constexpr std::string_view featureName( Feature feature ) noexcept
+	{
+		switch ( feature )
+		{
+			case Feature::SSE42:
+				return "sse42";
+			case Feature::POPCNT:
+				return "popcnt";
+			case Feature::PCLMUL:
+				return "pclmul";
+			case Feature::AES:
+				return "aes";
+			case Feature::AVX:
+				return "avx";
+			case Feature::AVX2:
+				return "avx2";
+			case Feature::BMI1:
+				return "bmi1";
+			case Feature::BMI2:
+				return "bmi2";
+			case Feature::FMA:
+				return "fma";
+			case Feature::AVX512F:
+				return "avx512f";
+			case Feature::AVX512DQ:
+				return "avx512dq";
+			case Feature::AVX512CD:
+				return "avx512cd";
+			case Feature::AVX512BW:
+				return "avx512bw";
+			case Feature::AVX512VL:
+				return "avx512vl";
+			case Feature::SHA:
+				return "sha";
+			case Feature::FastPdepPext:
+				return "fast_pdep";
+			case Feature::FastAvx512:
+				return "fast_avx512";
+			default:
+				return {};
+		}
+	}
+
+	inline Feature parseFeatureList( std::string_view list ) noexcept
+	{
+		Feature set{ Feature::None };
+		while ( !list.empty() )
+		{
+			const size_t comma = list.find( ',' );
+			std::string_view name = list.substr( 0, comma );
+			list = comma == std::string_view::npos ? std::string_view{} : list.substr( comma + 1 );
+
+			while ( !name.empty() && ( name.front() == ' ' || name.front() == '\t' ) )
+			{
+				name.remove_prefix( 1 );
+			}
+			while ( !name.empty() && ( name.back() == ' ' || name.back() == '\t' || name.back() == '\n' ) )
+			{
+				name.remove_suffix( 1 );
+			}
+
+			if ( name == "all" )
+			{
+				return Feature::All;
+			}
+			for ( uint32_t bit = 1; bit < static_cast<uint32_t>( Feature::All ); bit <<= 1 )
+			{
+				if ( featureName( static_cast<Feature>( bit ) ) == name )
+				{
+					set = set | static_cast<Feature>( bit );
+				}
+			}
+		}
+
+		return set;
+	}
+
+	inline std::string describeFeatures( Feature features )
+	{
+		std::string names;
+		for ( uint32_t bit = 1; bit < static_cast<uint32_t>( Feature::All ); bit <<= 1 )
+		{
+			if ( hasAll( features, static_cast<Feature>( bit ) ) )
+			{
+				names += names.empty() ? "" : ", ";
+				names += featureName( static_cast<Feature>( bit ) );
+			}
+		}
+
+		return names.empty() ? std::string{ "none" } : names;
+	}
+
+	//=====================================================================
+	// Build configuration report
+	//=====================================================================
+
+	inline constexpr bool BuildReport::matchesHost() const noexcept
+	{
+		return missed == Feature::None && unsupported == Feature::None;
+	}
+
+	inline BuildReport buildReport( Feature compiled ) noexcept
+	{
+		// Tuning pseudo-features are not compile flags
+		constexpr Feature isa = ~( Feature::FastPdepPext | Feature::FastAvx512 );
+
+		BuildReport report;
+		report.compiled = compiled & isa;
+		report.detected = toFeatureSet( features() );
+		report.missed = report.detected & ~report.compiled;
+		report.unsupported = report.compiled & ~report.detected;
+
+		return report;
+	}
+
+	inline bool warnMissedFeatures( Feature compiled, std::FILE* stream )
+	{
+		const BuildReport report = buildReport( compiled );
+		if ( report.matchesHost() || stream == nullptr )
+		{
+			return false;
+		}
+
+		if ( report.unsupported != Feature::None )
+		{
+			std::fprintf( stream, "nfx-core: warning: build uses %s, which this CPU does not support\n", describeFeatures( report.unsupported ).c_str() );
+		}
+		if ( report.missed != Feature::None )
+		{
+			std::fprintf( stream, "nfx-core: warning: CPU supports %s, not enabled in this build", describeFeatures( report.missed ).c_str() );
+			if ( hasAll( report.missed, Feature::SSE42 ) )
+			{
+				std::fprintf( stream, " (crc32() and hashStringView() use the software CRC32-C; compile with -msse4.2 or -march=native)" );
+			}
+			std::fprintf( stream, "\n" );
+		}
+
+		return true;
+	}
+
+	//=====================================================================
+	// Dispatch mask
+	//=====================================================================
+
+	namespace detail
+	{
+		inline constinit std::atomic<uint32_t> g_dispatchMask{ static_cast<uint32_t>( Feature::All ) };
+
+		/** @brief Drops features whose base feature is missing. */
+		inline constexpr Feature closeDependencies( Feature set ) noexcept
+		{
+			constexpr Feature avx512Subsets = Feature::AVX512DQ | Feature::AVX512CD | Feature::AVX512BW | Feature::AVX512VL | Feature::FastAvx512;
+
+			if ( !hasAll( set, Feature::AVX ) )
+			{
+				set = set & ~( Feature::AVX2 | Feature::FMA );
+			}
+			if ( !hasAll( set, Feature::AVX2 ) )
+			{
+				set = set & ~Feature::AVX512F;
+			}
+			if ( !hasAll( set, Feature::AVX512F ) )
+			{
+				set = set & ~avx512Subsets;
+			}
+			if ( !hasAll( set, Feature::BMI2 ) )
+			{
+				set = set & ~Feature::FastPdepPext;
+			}
+
+			return set;
+		}
+	} // namespace detail
+
+	inline void setDispatchMask( Feature allowed ) noexcept
+	{
+		detail::g_dispatchMask.store( static_cast<uint32_t>( allowed ), std::memory_order_relaxed );
+	}
+
+	inline Feature dispatchMask() noexcept
+	{
+		return static_cast<Feature>( detail::g_dispatchMask.load( std::memory_order_relaxed ) );
+	}
+
+	inline Feature dispatchFeatures() noexcept
+	{
+		Feature available = ( toFeatureSet( features() ) | toFeatureSet( tuning() ) ) & dispatchMask();
+
+		if ( const char* disabled = std::getenv( constants::DISPATCH_DISABLE_ENV ) )
+		{
+			available = available & ~parseFeatureList( disabled );
+		}
+
+		return detail::closeDependencies( available );
+	}
+
+	//=====================================================================
+	// Dispatcher
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	namespace detail
+	{
+		/**
+		 * @brief Rejects a candidate list without a Feature::None fallback.
+		 * @details Not constexpr: in a `constinit` dispatcher the call is a compile error naming
+		 *          this function; otherwise the process aborts on construction, before an
+		 *          unsupported instruction set could be run.
+		 */
+		[[noreturn]] inline void dispatcherNeedsFeatureNoneFallback( const char* lastCandidate ) noexcept
+		{
+			std::fprintf( stderr, "nfx-core: fatal: dispatch candidate '%s' is last but does not require Feature::None\n", lastCandidate );
+			std::abort();
+		}
+	} // namespace detail
+
+	template <typename R, typename... Args, size_t N>
+	inline constexpr Dispatcher<R( Args... ), N>::Dispatcher( const std::array<Candidate, N>& candidates ) noexcept
+		: m_candidates{ candidates }
+	{
+		if ( m_candidates[N - 1].required != Feature::None )
+		{
+			detail::dispatcherNeedsFeatureNoneFallback( m_candidates[N - 1].name );
+		}
+	}
+
+	//----------------------------------------------
+	// Invocation
+	//----------------------------------------------
+
+	template <typename R, typename... Args, size_t N>
+	inline R Dispatcher<R( Args... ), N>::operator()( Args... args ) const
+	{
+		Function function = m_function.load( std::memory_order_relaxed );
+		if ( function == nullptr ) [[unlikely]]
+		{
+			function = resolve();
+		}
+
+		return function( std::forward<Args>( args )... );
+	}
+
+	//----------------------------------------------
+	// Resolution
+	//----------------------------------------------
+
+	template <typename R, typename... Args, size_t N>
+	inline typename Dispatcher<R( Args... ), N>::Function Dispatcher<R( Args... ), N>::resolve() const noexcept
+	{
+		return resolve( dispatchFeatures() );
+	}
+
+	template <typename R, typename... Args, size_t N>
+	inline typename Dispatcher<R( Args... ), N>::Function Dispatcher<R( Args... ), N>::resolve( Feature available ) const noexcept
+	{
+		// The constructor guarantees the last candidate requires nothing
+		size_t selected = N - 1;
+		for ( size_t i = 0; i < N; ++i )
+		{
+			if ( hasAll( available, m_candidates[i].required ) )
+			{
+				selected = i;
+				break;
+			}
+		}
+
+		m_selected.store( selected, std::memory_order_relaxed );
+		m_function.store( m_candidates[selected].function, std::memory_order_relaxed );
+
+		return m_candidates[selected].function;
+	}
+
+	template <typename R, typename... Args, size_t N>
+	inline void Dispatcher<R( Args... ), N>::reset() noexcept
+	{
+		m_function.store( nullptr, std::memory_order_relaxed );
+		m_selected.store( N, std::memory_order_relaxed );
+	}
+
+	//----------------------------------------------
+	// Introspection
+	//----------------------------------------------
+
+	template <typename R, typename... Args, size_t N>
+	inline std::string_view Dispatcher<R( Args... ), N>::selectedName() const noexcept
+	{
+		size_t selected = m_selected.load( std::memory_order_relaxed );
+		if ( selected >= N )
+		{
+			resolve();
+			selected = m_selected.load( std::memory_order_relaxed );
+		}
+
+		return m_candidates[selected].name;
+	}
+
+	template <typename R, typename... Args, size_t N>
+	inline std::span<const typename Dispatcher<R( Args... ), N>::Candidate> Dispatcher<R( Args... ), N>::candidates() const noexcept
+	{
+		return m_candidates;
+	}
+
+	//=====================================================================
+	// Factory
+	//=====================================================================
+
+	template <typename Signature, typename... Candidates>
+	inline constexpr Dispatcher<Signature, sizeof...( Candidates )> makeDispatcher( const Candidates&... candidates ) noexcept
+	{
+		return Dispatcher<Signature, sizeof...( Candidates )>{ std::array<DispatchCandidate<Signature>, sizeof...( Candidates )>{ candidates... } };
+	}
+} // namespace nfx::core::cpu
@@ -0,0 +1,273 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file HashedString.inl
+ * @brief Pre-hashed string implementation
+ */
+
+#include <utility>
+
+#include "nfx/core/KeyEquality.h"
+
+namespace nfx::core::hashing
+{
+	//=====================================================================
+	// HashedStringView class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline constexpr HashedStringView::HashedStringView( std::string_view text, uint32_t hash, bool hashed ) noexcept
+		: m_text{ text }, m_hash{ hash }, m_hashed{ hashed }
+	{
+	}
+
+	inline HashedStringView::HashedStringView() noexcept
+		: HashedStringView{ std::string_view{} }
+	{
+	}
+
+	inline HashedStringView::HashedStringView( std::string_view text ) noexcept
+		: HashedStringView{ text, hashing::hashStringView( text ), true }
+	{
+	}
+
+	inline HashedStringView::HashedStringView( const char* text ) noexcept
+		: HashedStringView{ std::string_view{ text } }
+	{
+	}
+
+	inline HashedStringView::HashedStringView( const std::string& text ) noexcept
+		: HashedStringView{ std::string_view{ text } }
+	{
+	}
+
+	inline constexpr HashedStringView::HashedStringView( std::string_view text, uint32_t hash ) noexcept
+		: HashedStringView{ text, hash, true }
+	{
+	}
+
+	inline constexpr HashedStringView HashedStringView::deferred( std::string_view text ) noexcept
+	{
+		return HashedStringView{ text, 0, false };
+	}
+
+	//----------------------------------------------
+	// Accessors
+	//----------------------------------------------
+
+	inline uint32_t HashedStringView::hash() const noexcept
+	{
+		if ( !m_hashed )
+		{
+			m_hash = hashing::hashStringView( m_text );
+			m_hashed = true;
+		}
+
+		return m_hash;
+	}
+
+	inline constexpr bool HashedStringView::hasHash() const noexcept
+	{
+		return m_hashed;
+	}
+
+	inline constexpr std::string_view HashedStringView::view() const noexcept
+	{
+		return m_text;
+	}
+
+	inline constexpr size_t HashedStringView::size() const noexcept
+	{
+		return m_text.size();
+	}
+
+	inline constexpr bool HashedStringView::empty() const noexcept
+	{
+		return m_text.empty();
+	}
+
+	inline constexpr HashedStringView::operator std::string_view() const noexcept
+	{
+		return m_text;
+	}
+
+	//----------------------------------------------
+	// Comparison
+	//----------------------------------------------
+
+	inline bool operator==( const HashedStringView& lhs, const HashedStringView& rhs ) noexcept
+	{
+		return hashedKeysEqual( lhs.hash(), lhs.m_text, rhs.hash(), rhs.m_text );
+	}
+
+	//=====================================================================
+	// HashedString class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline HashedString::HashedString()
+		: m_hash{ hashing::hashStringView( std::string_view{} ) }
+	{
+	}
+
+	inline HashedString::HashedString( std::string text )
+		: m_text{ std::move( text ) }, m_hash{ hashing::hashStringView( std::string_view{ m_text } ) }
+	{
+	}
+
+	inline HashedString::HashedString( std::string_view text )
+		: HashedString{ std::string{ text } }
+	{
+	}
+
+	inline HashedString::HashedString( const char* text )
+		: HashedString{ std::string{ text } }
+	{
+	}
+
+	inline HashedString::HashedString( const HashedStringView& text )
+		: m_text{ text.view() }, m_hash{ text.hash() }
+	{
+	}
+
+	//----------------------------------------------
+	// Accessors
+	//----------------------------------------------
+
+	inline uint32_t HashedString::hash() const noexcept
+	{
+		return m_hash;
+	}
+
+	inline const std::string& HashedString::str() const noexcept
+	{
+		return m_text;
+	}
+
+	inline std::string_view HashedString::view() const noexcept
+	{
+		return m_text;
+	}
+
+	inline size_t HashedString::size() const noexcept
+	{
+		return m_text.size();
+	}
+
+	inline bool HashedString::empty() const noexcept
+	{
+		return m_text.empty();
+	}
+
+	inline HashedString::operator HashedStringView() const noexcept
+	{
+		return HashedStringView{ m_text, m_hash };
+	}
+
+	//----------------------------------------------
+	// Comparison
+	//----------------------------------------------
+
+	inline bool operator==( const HashedString& lhs, const HashedString& rhs ) noexcept
+	{
+		return hashedKeysEqual( lhs.m_hash, lhs.m_text, rhs.m_hash, rhs.m_text );
+	}
+
+	inline bool operator==( const HashedString& lhs, const HashedStringView& rhs ) noexcept
+	{
+		return hashedKeysEqual( lhs.m_hash, lhs.m_text, rhs.hash(), rhs.view() );
+	}
+
+	//=====================================================================
+	// Comparison with plain strings
+	//=====================================================================
+
+	template <PlainText Text>
+	inline bool operator==( const HashedStringView& lhs, const Text& rhs ) noexcept
+	{
+		return keysEqual( lhs.view(), std::string_view{ rhs } );
+	}
+
+	template <PlainText Text>
+	inline bool operator==( const HashedString& lhs, const Text& rhs ) noexcept
+	{
+		return keysEqual( lhs.view(), std::string_view{ rhs } );
+	}
+
+	//=====================================================================
+	// Hashing without rehashing
+	//=====================================================================
+
+	inline uint32_t hashStringView( const HashedStringView& key ) noexcept
+	{
+		return key.hash();
+	}
+
+	inline uint32_t hashStringView( const HashedString& key ) noexcept
+	{
+		return key.hash();
+	}
+
+	template <uint64_t MixConstant>
+	inline uint32_t seedMix( uint32_t seed, const HashedStringView& key, size_t size ) noexcept
+	{
+		return seedMix<MixConstant>( seed, key.hash(), size );
+	}
+
+	inline size_t HashedStringHash::operator()( const HashedString& key ) const noexcept
+	{
+		return key.hash();
+	}
+
+	inline size_t HashedStringHash::operator()( const HashedStringView& key ) const noexcept
+	{
+		return key.hash();
+	}
+
+	inline size_t HashedStringHash::operator()( std::string_view key ) const noexcept
+	{
+		return hashing::hashStringView( key );
+	}
+} // namespace nfx::core::hashing
+
+//=====================================================================
+// Standard library integration
+//=====================================================================
+
+inline size_t std::hash<nfx::core::hashing::HashedStringView>::operator()( const nfx::core::hashing::HashedStringView& key ) const noexcept
+{
+	return key.hash();
+}
+
+inline size_t std::hash<nfx::core::hashing::HashedString>::operator()( const nfx::core::hashing::HashedString& key ) const noexcept
+{
+	return key.hash();
+}
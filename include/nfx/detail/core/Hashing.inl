@@ -30,8 +30,66 @@
  *          and multiplicative hashing for integers with proper avalanche properties
  */
 
+#if defined( _MSC_VER ) && !defined( __clang__ ) && defined( _M_X64 )
+#	include <intrin.h>
+#endif
+
+#include <bit>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+/** @brief 2, 4 and 8 byte CRC32-C steps are available at compile time (SSE4.2 on x86-64). */
+#if ( defined( _MSC_VER ) && !defined( __clang__ ) && defined( _M_X64 ) ) || ( defined( __SSE4_2__ ) && defined( __x86_64__ ) )
+#	define NFX_CORE_HASHING_WIDE_CRC32 1
+#endif
+
 namespace nfx::core::hashing
 {
+	namespace detail
+	{
+		/** @brief High 64 bits of the 128-bit product a * b. */
+		inline constexpr uint64_t mulHigh64( uint64_t a, uint64_t b ) noexcept
+		{
+#if defined( __SIZEOF_INT128__ )
+			// __extension__ keeps -Wpedantic quiet about the non-ISO 128-bit type
+			__extension__ typedef unsigned __int128 uint128;
+			return static_cast<uint64_t>( ( static_cast<uint128>( a ) * b ) >> 64 );
+#else
+#	if defined( _MSC_VER ) && !defined( __clang__ ) && defined( _M_X64 )
+			if ( !std::is_constant_evaluated() )
+			{
+				return __umulh( a, b );
+			}
+#	endif
+			// Portable schoolbook multiplication on 32-bit halves
+			const uint64_t aLo = a & 0xFFFFFFFFu;
+			const uint64_t aHi = a >> 32;
+			const uint64_t bLo = b & 0xFFFFFFFFu;
+			const uint64_t bHi = b >> 32;
+
+			const uint64_t loLo = aLo * bLo;
+			const uint64_t hiLo = aHi * bLo;
+			const uint64_t loHi = aLo * bHi;
+			const uint64_t cross = ( loLo >> 32 ) + ( hiLo & 0xFFFFFFFFu ) + loHi;
+
+			return aHi * bHi + ( hiLo >> 32 ) + ( cross >> 32 );
+#endif
+		}
+
+		/** @brief Seed mixing shared by the seedMix() family: 64-bit multiplicative hash before reduction. */
+		template <uint64_t MixConstant>
+		inline constexpr uint64_t seedMixState( uint32_t seed, uint32_t hash ) noexcept
+		{
+			uint32_t x{ seed + hash }; // Mix seed with original hash
+			x ^= x >> 12;			   // Thomas Wang's bit-mixing: spread high bits to low positions
+			x ^= x << 25;			   // Fold low bits back to high positions for avalanche effect
+			x ^= x >> 27;			   // Final avalanche step ensures all bits influence result
+
+			return x * MixConstant;
+		}
+	} // namespace detail
+
 	//=====================================================================
 	// Hash infrastructure
 	//=====================================================================
@@ -79,10 +137,7 @@ namespace nfx::core::hashing
 	inline constexpr uint32_t seedMix( uint32_t seed, uint32_t hash, size_t size ) noexcept
 	{
 		// Mixes the primary hash with the seed to find the final table slot
-		uint32_t x{ seed + hash }; // Mix seed with original hash
-		x ^= x >> 12;			   // Thomas Wang's bit-mixing: spread high bits to low positions
-		x ^= x << 25;			   // Fold low bits back to high positions for avalanche effect
-		x ^= x >> 27;			   // Final avalanche step ensures all bits influence result
+		const uint64_t x{ detail::seedMixState<MixConstant>( seed, hash ) };
 
 		/*
 		 * Final step: Multiplicative hashing with 64-bit magic constant followed by modulo reduction.
@@ -98,7 +153,72 @@ namespace nfx::core::hashing
 		 *
 		 * - Cast to uint32_t: Return type matches the expected table index size.
 		 */
-		return static_cast<uint32_t>( ( x * MixConstant ) & ( size - 1 ) );
+		return static_cast<uint32_t>( x & ( size - 1 ) );
+	}
+
+	template <uint64_t MixConstant>
+	inline constexpr size_t seedMix64( uint64_t seed, uint64_t hash, size_t size ) noexcept
+	{
+		// xorshift64* on the full 64-bit state
+		uint64_t x{ seed + hash };
+		x ^= x >> 12;
+		x ^= x << 25;
+		x ^= x >> 27;
+		x *= MixConstant;
+
+		// Top log2(size) bits of the product; size is a power of 2
+		if ( size <= 1 )
+		{
+			return 0;
+		}
+
+		return static_cast<size_t>( x >> ( 64 - std::countr_zero( size ) ) );
+	}
+
+	//----------------------------------------------
+	// Range reduction
+	//----------------------------------------------
+
+	inline constexpr uint32_t fastRange32( uint32_t hash, uint32_t n ) noexcept
+	{
+		return static_cast<uint32_t>( ( static_cast<uint64_t>( hash ) * n ) >> 32 );
+	}
+
+	inline constexpr uint64_t fastRange64( uint64_t hash, uint64_t n ) noexcept
+	{
+		return detail::mulHigh64( hash, n );
+	}
+
+	inline constexpr FastMod::FastMod( uint32_t divisor ) noexcept
+		: m_reciprocal{ divisor == 0 ? 0 : UINT64_MAX / divisor + 1 },
+		  m_divisor{ divisor }
+	{
+	}
+
+	inline constexpr uint32_t FastMod::mod( uint32_t value ) const noexcept
+	{
+		// Fractional part of value / divisor, scaled back up by the divisor
+		const uint64_t fraction = m_reciprocal * value;
+
+		return static_cast<uint32_t>( detail::mulHigh64( fraction, m_divisor ) );
+	}
+
+	inline constexpr uint32_t FastMod::divisor() const noexcept
+	{
+		return m_divisor;
+	}
+
+	template <uint64_t MixConstant>
+	inline constexpr uint32_t seedMixRange( uint32_t seed, uint32_t hash, size_t size ) noexcept
+	{
+		// Reduce from the high bits of the product, which carry the most mixing
+		return static_cast<uint32_t>( fastRange64( detail::seedMixState<MixConstant>( seed, hash ), static_cast<uint64_t>( size ) ) );
+	}
+
+	template <uint64_t MixConstant>
+	inline constexpr uint32_t seedMix( uint32_t seed, uint32_t hash, const FastMod& size ) noexcept
+	{
+		return size.mod( static_cast<uint32_t>( detail::seedMixState<MixConstant>( seed, hash ) >> 32 ) );
 	}
 
 	//----------------------------------------------
@@ -153,6 +273,425 @@ namespace nfx::core::hashing
 		return hashValue;
 	}
 
+	//----------------------------
+	// Wide string hashing
+	//----------------------------
+
+	namespace detail
+	{
+		/** @brief U+FFFD, substituted for unpaired surrogates and out-of-range code points. */
+		inline constexpr char32_t UNICODE_REPLACEMENT_CHARACTER{ 0xFFFD };
+
+		/**
+		 * @brief CRC32-C of the low `Bytes` bytes of `value`, least significant byte first.
+		 * @details Equal to `Bytes` calls of crc32(); with SSE4.2 on x86-64 it is one 2, 4 or
+		 *          8 byte instruction (a 2 and a 1 byte one for 3 bytes).
+		 */
+		template <size_t Bytes>
+		inline uint32_t crc32Bytes( uint32_t hash, uint64_t value ) noexcept
+		{
+			static_assert( Bytes >= 1 && Bytes <= 8 && ( Bytes <= 4 || Bytes == 8 ), "Bytes must be 1-4 or 8" );
+
+#if defined( NFX_CORE_HASHING_WIDE_CRC32 )
+			if constexpr ( Bytes == 8 )
+			{
+#	if defined( _MSC_VER ) && !defined( __clang__ )
+				return static_cast<uint32_t>( _mm_crc32_u64( hash, value ) );
+#	else
+				return static_cast<uint32_t>( __builtin_ia32_crc32di( hash, value ) );
+#	endif
+			}
+			else if constexpr ( Bytes == 4 )
+			{
+#	if defined( _MSC_VER ) && !defined( __clang__ )
+				return _mm_crc32_u32( hash, static_cast<uint32_t>( value ) );
+#	else
+				return __builtin_ia32_crc32si( hash, static_cast<uint32_t>( value ) );
+#	endif
+			}
+			else if constexpr ( Bytes == 1 )
+			{
+				return crc32( hash, static_cast<uint8_t>( value ) );
+			}
+			else
+			{
+#	if defined( _MSC_VER ) && !defined( __clang__ )
+				hash = _mm_crc32_u16( hash, static_cast<uint16_t>( value ) );
+#	else
+				hash = __builtin_ia32_crc32hi( hash, static_cast<uint16_t>( value ) );
+#	endif
+				return Bytes == 3 ? crc32( hash, static_cast<uint8_t>( value >> 16 ) ) : hash;
+			}
+#else
+			for ( size_t i = 0; i < Bytes; ++i )
+			{
+				hash = crc32( hash, static_cast<uint8_t>( value >> ( 8 * i ) ) );
+			}
+
+			return hash;
+#endif
+		}
+
+		/** @brief Selects `a` when `condition` holds and `b` otherwise, without a branch. */
+		inline constexpr uint64_t selectBits( bool condition, uint64_t a, uint64_t b ) noexcept
+		{
+			return b ^ ( ( a ^ b ) & ( uint64_t{ 0 } - condition ) );
+		}
+
+		/** @brief UTF-8 sequence length of a code point, by its bit width (0-21). */
+		inline constexpr uint8_t UTF8_LENGTH_BY_WIDTH[22]{ 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4 };
+
+		/** @brief Bits kept from the shifted groups, by sequence length: bit 6 of the last byte only stays for ASCII. */
+		inline constexpr uint64_t UTF8_KEEP[5]{ 0, 0x7F, 0xBFFF, 0xBFFFFF, 0xBFFFFFFF };
+
+		/** @brief Lead-byte prefix and continuation-byte 0x80 bits, by sequence length (first byte lowest). */
+		inline constexpr uint64_t UTF8_MARKERS[5]{ 0, 0, 0x80C0, 0x8080E0, 0x808080F0 };
+
+		/** @brief UTF-8 encoding of one code point (at most U+10FFFF), first byte lowest, without branches. */
+		inline constexpr uint64_t encodeUtf8( char32_t codePoint, size_t& count ) noexcept
+		{
+			const uint64_t cp{ codePoint };
+			count = UTF8_LENGTH_BY_WIDTH[std::bit_width( static_cast<uint32_t>( codePoint ) )];
+
+			// 6-bit groups, most significant first (7 bits in the last): the 4-byte form without markers
+			const uint64_t groups = ( cp >> 18 ) | ( ( cp >> 4 ) & 0x3F00 ) | ( ( cp << 10 ) & 0x3F0000 ) | ( ( cp << 24 ) & 0x7F000000 );
+
+			// Shorter forms drop the leading zero groups
+			return ( ( groups >> ( 32 - 8 * count ) ) & UTF8_KEEP[count] ) | UTF8_MARKERS[count];
+		}
+
+		/** @brief The code point itself, or U+FFFD for surrogates and values above U+10FFFF. */
+		inline constexpr char32_t scalarValue( uint32_t codePoint ) noexcept
+		{
+			const bool valid = codePoint <= 0x10FFFF && codePoint - 0xD800 >= 0x800;
+			return valid ? static_cast<char32_t>( codePoint ) : UNICODE_REPLACEMENT_CHARACTER;
+		}
+
+		/**
+		 * @brief Collects UTF-8 bytes in a register and feeds them to CRC32-C eight at a time.
+		 * @details Mixed-script text would otherwise take one 1-4 byte step per code point, each
+		 *          waiting on the previous one and chosen by an unpredictable branch. With the
+		 *          hardware instruction the 8-byte step is computed for every append and kept
+		 *          only when the word is full, so no branch depends on the text.
+		 */
+		class Utf8Crc32 final
+		{
+		public:
+			explicit Utf8Crc32( uint32_t hash ) noexcept
+				: m_hash{ hash }
+			{
+			}
+
+			/** @brief Appends `bits` (8-64, a multiple of 8) bits of bytes, first byte lowest. */
+			void append( uint64_t bytes, uint32_t bits ) noexcept
+			{
+				const uint64_t word = m_pending | ( bytes << m_pendingBits );
+				const uint64_t carry = ( bytes >> ( 63 - m_pendingBits ) ) >> 1; // Bytes past the full word
+				const bool full = m_pendingBits + bits >= 64;
+#if defined( NFX_CORE_HASHING_WIDE_CRC32 )
+				m_hash = static_cast<uint32_t>( selectBits( full, crc32Bytes<8>( m_hash, word ), m_hash ) );
+#else
+				if ( full )
+				{
+					m_hash = crc32Bytes<8>( m_hash, word );
+				}
+#endif
+				m_pending = selectBits( full, carry, word );
+				m_pendingBits = ( m_pendingBits + bits ) & 63;
+			}
+
+			/** @brief Appends the UTF-8 encoding of a code point (at most U+10FFFF). */
+			void append( char32_t codePoint ) noexcept
+			{
+				size_t count;
+				const uint64_t bytes = encodeUtf8( codePoint, count );
+				append( bytes, static_cast<uint32_t>( 8 * count ) );
+			}
+
+			/** @brief Appends the UTF-8 encodings of two code points (at most 8 bytes) in one step. */
+			void append( char32_t first, char32_t second ) noexcept
+			{
+				size_t firstCount;
+				size_t secondCount;
+				const uint64_t firstBytes = encodeUtf8( first, firstCount );
+				const uint64_t secondBytes = encodeUtf8( second, secondCount );
+				append( firstBytes | ( secondBytes << ( 8 * firstCount ) ), static_cast<uint32_t>( 8 * ( firstCount + secondCount ) ) );
+			}
+
+			/** @brief Feeds the remaining bytes and returns the hash. */
+			uint32_t finish() noexcept
+			{
+				if ( m_pendingBits >= 32 )
+				{
+					m_hash = crc32Bytes<4>( m_hash, m_pending );
+					m_pending >>= 32;
+				}
+				if ( m_pendingBits & 16 )
+				{
+					m_hash = crc32Bytes<2>( m_hash, m_pending );
+					m_pending >>= 16;
+				}
+				if ( m_pendingBits & 8 )
+				{
+					m_hash = crc32Bytes<1>( m_hash, m_pending );
+				}
+
+				return m_hash;
+			}
+
+		private:
+			uint32_t m_hash;
+			uint64_t m_pending{ 0 };	  ///< Bytes not yet hashed, first byte lowest
+			uint32_t m_pendingBits{ 0 }; ///< Valid bits in m_pending (0-56)
+		};
+
+		/** @brief Packs four ASCII UTF-16 code units (one little-endian word) into their four UTF-8 bytes. */
+		inline constexpr uint64_t packAscii16( uint64_t units ) noexcept
+		{
+			return ( units & 0x7F ) | ( ( units >> 8 ) & 0x7F00 ) | ( ( units >> 16 ) & 0x7F0000 ) | ( ( units >> 24 ) & 0x7F000000 );
+		}
+
+		/** @brief Packs two ASCII UTF-32 code units (one little-endian word) into their two UTF-8 bytes. */
+		inline constexpr uint64_t packAscii32( uint64_t units ) noexcept
+		{
+			return ( units & 0x7F ) | ( ( units >> 24 ) & 0x7F00 );
+		}
+
+		/** @brief CRC32-C over a byte range, equal to one crc32() step per byte. */
+		inline uint32_t crc32Range( uint32_t hash, const unsigned char* bytes, size_t size ) noexcept
+		{
+#if defined( NFX_CORE_HASHING_WIDE_CRC32 )
+			// Little-endian: a wide step over a word equals its bytes fed one at a time
+			for ( ; size >= 8; bytes += 8, size -= 8 )
+			{
+				uint64_t word;
+				std::memcpy( &word, bytes, 8 );
+				hash = crc32Bytes<8>( hash, word );
+			}
+			if ( size >= 4 )
+			{
+				uint32_t word;
+				std::memcpy( &word, bytes, 4 );
+				hash = crc32Bytes<4>( hash, word );
+				bytes += 4;
+				size -= 4;
+			}
+			if ( size >= 2 )
+			{
+				uint16_t word;
+				std::memcpy( &word, bytes, 2 );
+				hash = crc32Bytes<2>( hash, word );
+				bytes += 2;
+				size -= 2;
+			}
+			if ( size != 0 )
+			{
+				hash = crc32( hash, *bytes );
+			}
+#else
+			for ( size_t i = 0; i < size; ++i )
+			{
+				hash = crc32( hash, bytes[i] );
+			}
+#endif
+
+			return hash;
+		}
+
+		/** @brief Raw-bytes hash of a code unit sequence, equal to hashStringView() over its bytes. */
+		template <uint32_t InitialHash, typename CharT>
+		inline uint32_t hashCodeUnits( std::basic_string_view<CharT> key ) noexcept
+		{
+			return crc32Range( InitialHash, reinterpret_cast<const unsigned char*>( key.data() ), key.size() * sizeof( CharT ) );
+		}
+
+		/** @brief Decodes the code point at `units[i]` and advances past it; unpaired surrogates become U+FFFD. */
+		template <typename CharT>
+		inline char32_t decodeUtf16( const CharT* units, size_t& i, size_t count ) noexcept
+		{
+			const char32_t unit = static_cast<char16_t>( units[i++] );
+			if ( unit < 0xD800 || unit > 0xDFFF )
+			{
+				return unit;
+			}
+
+			const char32_t next = i < count ? static_cast<char16_t>( units[i] ) : 0;
+			if ( unit <= 0xDBFF && next >= 0xDC00 && next <= 0xDFFF )
+			{
+				++i;
+				return 0x10000 + ( ( unit - 0xD800 ) << 10 ) + ( next - 0xDC00 );
+			}
+
+			return UNICODE_REPLACEMENT_CHARACTER;
+		}
+
+		/** @brief UTF-8 hash of a UTF-16 code unit sequence (`char16_t`, or a 2-byte `wchar_t`). */
+		template <uint32_t InitialHash, typename CharT>
+		inline uint32_t hashUtf16AsUtf8( std::basic_string_view<CharT> key ) noexcept
+		{
+			const CharT* units = key.data();
+			const size_t count = key.size();
+			Utf8Crc32 crc{ InitialHash };
+
+			// Blocks of 8 code units: 8 ASCII ones pack into one 8-byte word, others are encoded two at a time
+			for ( size_t i = 0; i < count; )
+			{
+				if ( std::endian::native == std::endian::little && count - i >= 8 )
+				{
+					uint64_t lo;
+					uint64_t hi;
+					std::memcpy( &lo, units + i, 8 );
+					std::memcpy( &hi, units + i + 4, 8 );
+					if ( ( ( lo | hi ) & 0xFF80FF80FF80FF80ull ) == 0 )
+					{
+						crc.append( packAscii16( lo ) | ( packAscii16( hi ) << 32 ), 64 );
+						i += 8;
+						continue;
+					}
+				}
+
+				// A surrogate pair may straddle `end`; the next block resumes after it
+				const size_t end = count - i >= 8 ? i + 8 : count;
+				while ( i < end )
+				{
+					const char32_t first = decodeUtf16( units, i, count );
+					if ( i < end )
+					{
+						crc.append( first, decodeUtf16( units, i, count ) );
+					}
+					else
+					{
+						crc.append( first );
+					}
+				}
+			}
+
+			return crc.finish();
+		}
+
+		/** @brief UTF-8 hash of a UTF-32 code unit sequence (`char32_t`, or a 4-byte `wchar_t`). */
+		template <uint32_t InitialHash, typename CharT>
+		inline uint32_t hashUtf32AsUtf8( std::basic_string_view<CharT> key ) noexcept
+		{
+			const CharT* units = key.data();
+			const size_t count = key.size();
+			Utf8Crc32 crc{ InitialHash };
+
+			// Blocks of 8 code units: 8 ASCII ones pack into one 8-byte word, others are encoded two at a time
+			for ( size_t i = 0; i < count; )
+			{
+				if ( std::endian::native == std::endian::little && count - i >= 8 )
+				{
+					uint64_t words[4];
+					std::memcpy( words, units + i, 32 );
+					if ( ( ( words[0] | words[1] | words[2] | words[3] ) & 0xFFFFFF80FFFFFF80ull ) == 0 )
+					{
+						crc.append( packAscii32( words[0] ) | ( packAscii32( words[1] ) << 16 ) | ( packAscii32( words[2] ) << 32 ) | ( packAscii32( words[3] ) << 48 ), 64 );
+						i += 8;
+						continue;
+					}
+				}
+
+				const size_t end = count - i >= 8 ? i + 8 : count;
+				for ( ; i + 2 <= end; i += 2 )
+				{
+					crc.append( scalarValue( static_cast<uint32_t>( units[i] ) ), scalarValue( static_cast<uint32_t>( units[i + 1] ) ) );
+				}
+				if ( i < end )
+				{
+					crc.append( scalarValue( static_cast<uint32_t>( units[i++] ) ) );
+				}
+			}
+
+			return crc.finish();
+		}
+	} // namespace detail
+
+	template <uint32_t InitialHash>
+	inline uint32_t hashStringView( std::u16string_view key ) noexcept
+	{
+		return detail::hashCodeUnits<InitialHash>( key );
+	}
+
+	template <uint32_t InitialHash>
+	inline uint32_t hashStringView( std::u32string_view key ) noexcept
+	{
+		return detail::hashCodeUnits<InitialHash>( key );
+	}
+
+	template <uint32_t InitialHash>
+	inline uint32_t hashStringView( std::wstring_view key ) noexcept
+	{
+		return detail::hashCodeUnits<InitialHash>( key );
+	}
+
+	template <uint32_t InitialHash>
+	inline uint32_t hashStringViewAsUtf8( std::u16string_view key ) noexcept
+	{
+		return detail::hashUtf16AsUtf8<InitialHash>( key );
+	}
+
+	template <uint32_t InitialHash>
+	inline uint32_t hashStringViewAsUtf8( std::u32string_view key ) noexcept
+	{
+		return detail::hashUtf32AsUtf8<InitialHash>( key );
+	}
+
+	template <uint32_t InitialHash>
+	inline uint32_t hashStringViewAsUtf8( std::wstring_view key ) noexcept
+	{
+		if constexpr ( sizeof( wchar_t ) == 2 )
+		{
+			return detail::hashUtf16AsUtf8<InitialHash>( key );
+		}
+		else
+		{
+			return detail::hashUtf32AsUtf8<InitialHash>( key );
+		}
+	}
+
+	//----------------------------
+	// Binary key hashing
+	//----------------------------
+
+	template <uint32_t InitialHash>
+	inline uint32_t hashBytes( std::span<const std::byte> bytes ) noexcept
+	{
+		return detail::crc32Range( InitialHash, reinterpret_cast<const unsigned char*>( bytes.data() ), bytes.size() );
+	}
+
+	template <uint32_t InitialHash, typename T>
+		requires std::has_unique_object_representations_v<T>
+	inline uint32_t hashObject( const T& value ) noexcept
+	{
+		const auto* bytes = reinterpret_cast<const unsigned char*>( std::addressof( value ) );
+
+#if defined( NFX_CORE_HASHING_WIDE_CRC32 )
+		// Common key sizes: straight-line 8- and 4-byte steps, no length loop
+		constexpr size_t size = sizeof( T );
+		if constexpr ( size == 4 || size == 8 || size == 12 || size == 16 || size == 32 )
+		{
+			uint32_t hashValue = InitialHash;
+			for ( size_t offset = 0; offset + 8 <= size; offset += 8 ) // 0 to 4 words, unrolled
+			{
+				uint64_t word;
+				std::memcpy( &word, bytes + offset, 8 );
+				hashValue = detail::crc32Bytes<8>( hashValue, word );
+			}
+			if constexpr ( size % 8 == 4 )
+			{
+				uint32_t word;
+				std::memcpy( &word, bytes + size - 4, 4 );
+				hashValue = detail::crc32Bytes<4>( hashValue, word );
+			}
+
+			return hashValue;
+		}
+#endif
+
+		return detail::crc32Range( InitialHash, bytes, sizeof( T ) );
+	}
+
 	//----------------------------
 	// Integer hashing
 	//----------------------------
@@ -198,3 +737,5 @@ namespace nfx::core::hashing
 		}
 	}
 } // namespace nfx::core::hashing
+
+#undef NFX_CORE_HASHING_WIDE_CRC32
@@ -0,0 +1,620 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file HyperLogLog.inl
+ * @brief HyperLogLog cardinality sketch implementation
+ * @details Sparse/dense register management, SIMD merge, Ertl's improved raw
+ *          estimator and varint/6-bit packed serialization
+ */
+
+#if defined( __AVX2__ )
+#	include <immintrin.h>
+#elif defined( __SSE2__ ) || defined( _M_X64 )
+#	include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+#include "nfx/core/Hashing.h"
+
+namespace nfx::core::sketch
+{
+	namespace detail
+	{
+		//=====================================================================
+		// Estimator helpers
+		//=====================================================================
+
+		/*
+		 * Ertl, "New cardinality estimation algorithms for HyperLogLog sketches" (2017).
+		 * sigma() corrects for empty registers and tau() for saturated registers, which
+		 * gives an unbiased estimate over the whole range without HLL++ bias tables.
+		 */
+
+		inline double hllSigma( double x ) noexcept
+		{
+			if ( x == 1.0 )
+			{
+				return std::numeric_limits<double>::infinity();
+			}
+
+			double y{ 1.0 };
+			double z{ x };
+			double zPrev;
+			do
+			{
+				x *= x;
+				zPrev = z;
+				z += x * y;
+				y += y;
+			} while ( z != zPrev );
+
+			return z;
+		}
+
+		inline double hllTau( double x ) noexcept
+		{
+			if ( x == 0.0 || x == 1.0 )
+			{
+				return 0.0;
+			}
+
+			double y{ 1.0 };
+			double z{ 1.0 - x };
+			double zPrev;
+			do
+			{
+				x = std::sqrt( x );
+				zPrev = z;
+				y *= 0.5;
+				z -= ( 1.0 - x ) * ( 1.0 - x ) * y;
+			} while ( z != zPrev );
+
+			return z / 3.0;
+		}
+
+		//=====================================================================
+		// Register merge kernel
+		//=====================================================================
+
+		inline void hllMaxRegisters( uint8_t* dst, const uint8_t* src, size_t count ) noexcept
+		{
+			size_t i{ 0 };
+
+#if defined( __AVX2__ )
+			for ( ; i + 32 <= count; i += 32 )
+			{
+				const __m256i a = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( dst + i ) );
+				const __m256i b = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( src + i ) );
+				_mm256_storeu_si256( reinterpret_cast<__m256i*>( dst + i ), _mm256_max_epu8( a, b ) );
+			}
+#endif
+#if defined( __SSE2__ ) || defined( _M_X64 )
+			for ( ; i + 16 <= count; i += 16 )
+			{
+				const __m128i a = _mm_loadu_si128( reinterpret_cast<const __m128i*>( dst + i ) );
+				const __m128i b = _mm_loadu_si128( reinterpret_cast<const __m128i*>( src + i ) );
+				_mm_storeu_si128( reinterpret_cast<__m128i*>( dst + i ), _mm_max_epu8( a, b ) );
+			}
+#endif
+			for ( ; i < count; ++i )
+			{
+				dst[i] = std::max( dst[i], src[i] );
+			}
+		}
+
+		//=====================================================================
+		// Varint helpers
+		//=====================================================================
+
+		inline void hllWriteVarint( std::vector<std::byte>& out, uint32_t value )
+		{
+			while ( value >= 0x80 )
+			{
+				out.push_back( static_cast<std::byte>( ( value & 0x7F ) | 0x80 ) );
+				value >>= 7;
+			}
+			out.push_back( static_cast<std::byte>( value ) );
+		}
+
+		inline bool hllReadVarint( std::span<const std::byte> bytes, size_t& pos, uint32_t& value ) noexcept
+		{
+			value = 0;
+			for ( uint32_t shift = 0; shift < 35; shift += 7 )
+			{
+				if ( pos >= bytes.size() )
+				{
+					return false;
+				}
+
+				const uint32_t byte = static_cast<uint32_t>( bytes[pos++] );
+				value |= ( byte & 0x7F ) << shift;
+				if ( ( byte & 0x80 ) == 0 )
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+	} // namespace detail
+
+	//=====================================================================
+	// HyperLogLog class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Insertion
+	//----------------------------------------------
+
+	template <uint8_t Precision>
+	inline void HyperLogLog<Precision>::add( uint64_t hash )
+	{
+		if ( !m_registers.empty() )
+		{
+			addDense( hash );
+			return;
+		}
+
+		m_sparseBuffer.push_back( encodeSparse( hash ) );
+		if ( m_sparseBuffer.size() >= SPARSE_BUFFER_LIMIT )
+		{
+			flushSparse();
+			if ( m_sparse.size() > SPARSE_LIMIT )
+			{
+				convertToDense();
+			}
+		}
+	}
+
+	template <uint8_t Precision>
+	inline void HyperLogLog<Precision>::add( std::span<const uint64_t> hashes )
+	{
+		size_t i{ 0 };
+
+		if ( m_registers.empty() )
+		{
+			// Sparse: append the batch in chunks so the buffer never grows past one flush
+			while ( i < hashes.size() && m_registers.empty() )
+			{
+				const size_t chunk = std::min( hashes.size() - i, SPARSE_BUFFER_LIMIT );
+				for ( size_t j = 0; j < chunk; ++j )
+				{
+					m_sparseBuffer.push_back( encodeSparse( hashes[i + j] ) );
+				}
+				i += chunk;
+
+				flushSparse();
+				if ( m_sparse.size() > SPARSE_LIMIT )
+				{
+					convertToDense();
+				}
+			}
+		}
+
+		// Dense: four independent register updates per iteration
+		for ( ; i + 4 <= hashes.size(); i += 4 )
+		{
+			addDense( hashes[i] );
+			addDense( hashes[i + 1] );
+			addDense( hashes[i + 2] );
+			addDense( hashes[i + 3] );
+		}
+		for ( ; i < hashes.size(); ++i )
+		{
+			addDense( hashes[i] );
+		}
+	}
+
+	//----------------------------------------------
+	// Merging
+	//----------------------------------------------
+
+	template <uint8_t Precision>
+	inline void HyperLogLog<Precision>::merge( const HyperLogLog& other )
+	{
+		if ( this == &other )
+		{
+			return;
+		}
+
+		if ( other.m_registers.empty() )
+		{
+			if ( m_registers.empty() )
+			{
+				std::vector<uint32_t> scratch;
+				flushSparse();
+				mergeSparseEntries( other.sortedSparseEntries( scratch ) );
+				if ( m_sparse.size() > SPARSE_LIMIT )
+				{
+					convertToDense();
+				}
+			}
+			else
+			{
+				// Folding is order-independent, so the unsorted buffer can be folded as is
+				foldSparseIntoRegisters( other.m_sparse );
+				foldSparseIntoRegisters( other.m_sparseBuffer );
+			}
+
+			return;
+		}
+
+		if ( m_registers.empty() )
+		{
+			convertToDense();
+		}
+
+		detail::hllMaxRegisters( m_registers.data(), other.m_registers.data(), REGISTER_COUNT );
+	}
+
+	//----------------------------------------------
+	// Estimation
+	//----------------------------------------------
+
+	template <uint8_t Precision>
+	inline double HyperLogLog<Precision>::estimate() const
+	{
+		if ( m_registers.empty() )
+		{
+			// Linear counting over the 2^25 sparse buckets
+			std::vector<uint32_t> scratch;
+			constexpr double sparseBuckets = static_cast<double>( uint64_t{ 1 } << constants::HLL_SPARSE_PRECISION );
+			const double occupied = static_cast<double>( sortedSparseEntries( scratch ).size() );
+
+			return sparseBuckets * std::log( sparseBuckets / ( sparseBuckets - occupied ) );
+		}
+
+		/*
+		 * Register histogram, split over four sub-histograms so consecutive registers with
+		 * the same rank do not serialize on one counter (store-to-load forwarding stalls).
+		 */
+		constexpr size_t q = 64 - Precision;
+		std::array<std::array<uint32_t, 64>, 4> partial{};
+		size_t i{ 0 };
+		for ( ; i + 4 <= REGISTER_COUNT; i += 4 )
+		{
+			++partial[0][m_registers[i]];
+			++partial[1][m_registers[i + 1]];
+			++partial[2][m_registers[i + 2]];
+			++partial[3][m_registers[i + 3]];
+		}
+
+		std::array<double, 64> histogram{};
+		for ( size_t k = 0; k <= q + 1; ++k )
+		{
+			histogram[k] = static_cast<double>( partial[0][k] + partial[1][k] + partial[2][k] + partial[3][k] );
+		}
+
+		constexpr double m = static_cast<double>( REGISTER_COUNT );
+		double z = m * detail::hllTau( 1.0 - histogram[q + 1] / m );
+		for ( size_t k = q; k >= 1; --k )
+		{
+			z = 0.5 * ( z + histogram[k] );
+		}
+		z += m * detail::hllSigma( histogram[0] / m );
+
+		constexpr double alphaInf = 0.721347520444481703680; // 1 / (2 ln 2)
+
+		return alphaInf * m * m / z;
+	}
+
+	//----------------------------------------------
+	// State
+	//----------------------------------------------
+
+	template <uint8_t Precision>
+	inline bool HyperLogLog<Precision>::isSparse() const noexcept
+	{
+		return m_registers.empty();
+	}
+
+	template <uint8_t Precision>
+	inline bool HyperLogLog<Precision>::isEmpty() const noexcept
+	{
+		if ( !m_registers.empty() )
+		{
+			return std::all_of( m_registers.begin(), m_registers.end(), []( uint8_t r ) { return r == 0; } );
+		}
+
+		return m_sparse.empty() && m_sparseBuffer.empty();
+	}
+
+	template <uint8_t Precision>
+	inline void HyperLogLog<Precision>::clear() noexcept
+	{
+		m_sparse.clear();
+		m_sparseBuffer.clear();
+		m_registers.clear();
+		m_registers.shrink_to_fit();
+	}
+
+	//----------------------------------------------
+	// Serialization
+	//----------------------------------------------
+
+	template <uint8_t Precision>
+	inline std::vector<std::byte> HyperLogLog<Precision>::serialize() const
+	{
+		std::vector<std::byte> out;
+		out.push_back( static_cast<std::byte>( constants::HLL_SERIALIZATION_VERSION ) );
+		out.push_back( static_cast<std::byte>( Precision ) );
+
+		if ( m_registers.empty() )
+		{
+			std::vector<uint32_t> scratch;
+			const std::vector<uint32_t>& entries = sortedSparseEntries( scratch );
+			out.push_back( std::byte{ 0 } );
+			out.reserve( out.size() + 5 + entries.size() * 2 );
+
+			detail::hllWriteVarint( out, static_cast<uint32_t>( entries.size() ) );
+			uint32_t previous{ 0 };
+			for ( const uint32_t entry : entries )
+			{
+				detail::hllWriteVarint( out, entry - previous );
+				previous = entry;
+			}
+
+			return out;
+		}
+
+		out.push_back( std::byte{ 1 } );
+		out.reserve( out.size() + REGISTER_COUNT / 4 * 3 );
+		for ( size_t i = 0; i < REGISTER_COUNT; i += 4 )
+		{
+			const uint32_t packed = static_cast<uint32_t>( m_registers[i] ) |
+									( static_cast<uint32_t>( m_registers[i + 1] ) << 6 ) |
+									( static_cast<uint32_t>( m_registers[i + 2] ) << 12 ) |
+									( static_cast<uint32_t>( m_registers[i + 3] ) << 18 );
+			out.push_back( static_cast<std::byte>( packed & 0xFF ) );
+			out.push_back( static_cast<std::byte>( ( packed >> 8 ) & 0xFF ) );
+			out.push_back( static_cast<std::byte>( ( packed >> 16 ) & 0xFF ) );
+		}
+
+		return out;
+	}
+
+	template <uint8_t Precision>
+	inline std::optional<HyperLogLog<Precision>> HyperLogLog<Precision>::deserialize( std::span<const std::byte> bytes )
+	{
+		if ( bytes.size() < 3 ||
+			 static_cast<uint8_t>( bytes[0] ) != constants::HLL_SERIALIZATION_VERSION ||
+			 static_cast<uint8_t>( bytes[1] ) != Precision )
+		{
+			return std::nullopt;
+		}
+
+		HyperLogLog sketch;
+		const uint8_t representation = static_cast<uint8_t>( bytes[2] );
+
+		if ( representation == 0 )
+		{
+			size_t pos{ 3 };
+			uint32_t count;
+			if ( !detail::hllReadVarint( bytes, pos, count ) || count > bytes.size() - pos )
+			{
+				return std::nullopt;
+			}
+
+			sketch.m_sparse.reserve( count );
+			uint32_t entry{ 0 };
+			for ( uint32_t i = 0; i < count; ++i )
+			{
+				uint32_t delta;
+				if ( !detail::hllReadVarint( bytes, pos, delta ) ||
+					 ( i > 0 && delta == 0 ) ||
+					 delta > ( uint32_t{ 0xFFFFFFFF } - entry ) )
+				{
+					return std::nullopt;
+				}
+
+				entry += delta;
+				const uint32_t rank = entry & 0x3F;
+				if ( ( entry >> 6 ) >= ( uint32_t{ 1 } << constants::HLL_SPARSE_PRECISION ) ||
+					 rank == 0 || rank > 64 - constants::HLL_SPARSE_PRECISION + 1 )
+				{
+					return std::nullopt;
+				}
+
+				// Entries must be strictly ordered by index (one entry per sparse bucket)
+				if ( !sketch.m_sparse.empty() && ( sketch.m_sparse.back() >> 6 ) == ( entry >> 6 ) )
+				{
+					return std::nullopt;
+				}
+				sketch.m_sparse.push_back( entry );
+			}
+
+			if ( pos != bytes.size() )
+			{
+				return std::nullopt;
+			}
+
+			// A sketch serialized between buffer flushes may hold slightly more than the sparse limit
+			if ( sketch.m_sparse.size() > SPARSE_LIMIT )
+			{
+				sketch.convertToDense();
+			}
+
+			return sketch;
+		}
+
+		if ( representation != 1 || bytes.size() != 3 + REGISTER_COUNT / 4 * 3 )
+		{
+			return std::nullopt;
+		}
+
+		sketch.m_registers.resize( REGISTER_COUNT );
+		size_t pos{ 3 };
+		for ( size_t i = 0; i < REGISTER_COUNT; i += 4, pos += 3 )
+		{
+			const uint32_t packed = static_cast<uint32_t>( bytes[pos] ) |
+									( static_cast<uint32_t>( bytes[pos + 1] ) << 8 ) |
+									( static_cast<uint32_t>( bytes[pos + 2] ) << 16 );
+			for ( size_t j = 0; j < 4; ++j )
+			{
+				const uint8_t rank = static_cast<uint8_t>( ( packed >> ( 6 * j ) ) & 0x3F );
+				if ( rank > MAX_RANK )
+				{
+					return std::nullopt;
+				}
+				sketch.m_registers[i + j] = rank;
+			}
+		}
+
+		return sketch;
+	}
+
+	//----------------------------------------------
+	// Private implementation
+	//----------------------------------------------
+
+	template <uint8_t Precision>
+	inline uint32_t HyperLogLog<Precision>::encodeSparse( uint64_t hash ) noexcept
+	{
+		// Entry layout: [25-bit sparse index][6-bit rank of the remaining 39 bits]
+		const uint64_t mixed = static_cast<uint64_t>( hashing::hashInteger( hash ) );
+		const uint32_t index = static_cast<uint32_t>( mixed >> ( 64 - constants::HLL_SPARSE_PRECISION ) );
+		const uint64_t rest = mixed << constants::HLL_SPARSE_PRECISION;
+		const uint32_t rank = static_cast<uint32_t>( std::min( std::countl_zero( rest ), 64 - constants::HLL_SPARSE_PRECISION ) ) + 1;
+
+		return ( index << 6 ) | rank;
+	}
+
+	template <uint8_t Precision>
+	inline void HyperLogLog<Precision>::addDense( uint64_t hash ) noexcept
+	{
+		const uint64_t mixed = static_cast<uint64_t>( hashing::hashInteger( hash ) );
+		const size_t index = static_cast<size_t>( mixed >> ( 64 - Precision ) );
+		const uint8_t rank = static_cast<uint8_t>( std::min( std::countl_zero( mixed << Precision ), 64 - Precision ) + 1 );
+
+		uint8_t& reg = m_registers[index];
+		reg = std::max( reg, rank );
+	}
+
+	template <uint8_t Precision>
+	inline void HyperLogLog<Precision>::flushSparse()
+	{
+		if ( m_sparseBuffer.empty() )
+		{
+			return;
+		}
+
+		std::sort( m_sparseBuffer.begin(), m_sparseBuffer.end() );
+		mergeSparseEntries( m_sparseBuffer );
+		m_sparseBuffer.clear();
+	}
+
+	template <uint8_t Precision>
+	inline const std::vector<uint32_t>& HyperLogLog<Precision>::sortedSparseEntries( std::vector<uint32_t>& scratch ) const
+	{
+		if ( m_sparseBuffer.empty() )
+		{
+			return m_sparse;
+		}
+
+		std::vector<uint32_t> buffer{ m_sparseBuffer };
+		std::sort( buffer.begin(), buffer.end() );
+		scratch = mergeSorted( m_sparse, buffer );
+
+		return scratch;
+	}
+
+	template <uint8_t Precision>
+	inline void HyperLogLog<Precision>::mergeSparseEntries( const std::vector<uint32_t>& entries )
+	{
+		m_sparse = mergeSorted( m_sparse, entries );
+	}
+
+	template <uint8_t Precision>
+	inline std::vector<uint32_t> HyperLogLog<Precision>::mergeSorted( const std::vector<uint32_t>& lhs, const std::vector<uint32_t>& rhs )
+	{
+		// Both inputs sorted by entry, so equal indices are adjacent and the last one has the highest rank
+		std::vector<uint32_t> merged;
+		merged.reserve( lhs.size() + rhs.size() );
+
+		auto a = lhs.begin();
+		auto b = rhs.begin();
+		while ( a != lhs.end() || b != rhs.end() )
+		{
+			uint32_t next;
+			if ( b == rhs.end() || ( a != lhs.end() && *a < *b ) )
+			{
+				next = *a++;
+			}
+			else
+			{
+				next = *b++;
+			}
+
+			if ( !merged.empty() && ( merged.back() >> 6 ) == ( next >> 6 ) )
+			{
+				merged.back() = std::max( merged.back(), next );
+			}
+			else
+			{
+				merged.push_back( next );
+			}
+		}
+
+		return merged;
+	}
+
+	template <uint8_t Precision>
+	inline void HyperLogLog<Precision>::convertToDense()
+	{
+		flushSparse();
+		m_registers.assign( REGISTER_COUNT, 0 );
+		foldSparseIntoRegisters( m_sparse );
+
+		m_sparse.clear();
+		m_sparse.shrink_to_fit();
+	}
+
+	template <uint8_t Precision>
+	inline void HyperLogLog<Precision>::foldSparseIntoRegisters( const std::vector<uint32_t>& entries ) noexcept
+	{
+		for ( const uint32_t entry : entries )
+		{
+			/*
+			 * The top p bits of the 25-bit sparse index select the dense register. The
+			 * remaining (25 - p) index bits are the leading bits of the dense rank window:
+			 * if any is set the rank is determined by them, otherwise it continues into
+			 * the 39 bits summarized by the sparse rank.
+			 */
+			const uint32_t index = entry >> 6;
+			const uint32_t low = index & ( ( uint32_t{ 1 } << SPARSE_SHIFT ) - 1 );
+			const uint8_t rank = low != 0
+									 ? static_cast<uint8_t>( std::countl_zero( low ) - ( 32 - SPARSE_SHIFT ) + 1 )
+									 : static_cast<uint8_t>( SPARSE_SHIFT + ( entry & 0x3F ) );
+
+			uint8_t& reg = m_registers[index >> SPARSE_SHIFT];
+			reg = std::max( reg, rank );
+		}
+	}
+} // namespace nfx::core::sketch
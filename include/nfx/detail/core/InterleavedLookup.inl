@@ -0,0 +1,309 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file InterleavedLookup.inl
+ * @brief Coroutine-interleaved lookup implementation
+ * @details Per-thread coroutine frame pool, LookupTask and the round-robin scheduler
+ */
+
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "nfx/core/BatchLookup.h"
+
+namespace nfx::core::hashing
+{
+	namespace detail
+	{
+		//=====================================================================
+		// Coroutine frame pool
+		//=====================================================================
+
+		/**
+		 * @brief Per-thread free lists of coroutine frames in 64-byte size classes up to 1 KiB.
+		 * @details A lookup coroutine has one frame size, so after the first `width` lookups
+		 *          every frame comes from the free list. Larger frames use the global heap.
+		 */
+		class FramePool final
+		{
+		public:
+			static constexpr size_t GRANULE{ 64 };
+			static constexpr size_t CLASS_COUNT{ 16 };
+
+			FramePool() noexcept = default;
+			FramePool( const FramePool& ) = delete;
+			FramePool& operator=( const FramePool& ) = delete;
+
+			~FramePool()
+			{
+				for ( FreeFrame* head : m_free )
+				{
+					while ( head != nullptr )
+					{
+						FreeFrame* next = head->next;
+						::operator delete( head );
+						head = next;
+					}
+				}
+			}
+
+			static FramePool& forThisThread() noexcept
+			{
+				thread_local FramePool s_pool;
+				return s_pool;
+			}
+
+			void* allocate( size_t size )
+			{
+				const size_t sizeClass = ( size + GRANULE - 1 ) / GRANULE - 1;
+				if ( sizeClass >= CLASS_COUNT )
+				{
+					return ::operator new( size );
+				}
+
+				if ( FreeFrame* frame = m_free[sizeClass]; frame != nullptr )
+				{
+					m_free[sizeClass] = frame->next;
+					return frame;
+				}
+
+				return ::operator new( ( sizeClass + 1 ) * GRANULE );
+			}
+
+			void deallocate( void* frame, size_t size ) noexcept
+			{
+				const size_t sizeClass = ( size + GRANULE - 1 ) / GRANULE - 1;
+				if ( sizeClass >= CLASS_COUNT )
+				{
+					::operator delete( frame );
+					return;
+				}
+
+				m_free[sizeClass] = ::new ( frame ) FreeFrame{ m_free[sizeClass] };
+			}
+
+		private:
+			struct FreeFrame
+			{
+				FreeFrame* next;
+			};
+
+			std::array<FreeFrame*, CLASS_COUNT> m_free{}; ///< Free list heads per size class
+		};
+	} // namespace detail
+
+	//=====================================================================
+	// LookupTask class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Promise
+	//----------------------------------------------
+
+	template <typename Result>
+	inline LookupTask<Result> LookupTask<Result>::promise_type::get_return_object() noexcept
+	{
+		return LookupTask{ std::coroutine_handle<promise_type>::from_promise( *this ) };
+	}
+
+	template <typename Result>
+	inline std::suspend_never LookupTask<Result>::promise_type::initial_suspend() const noexcept
+	{
+		return {};
+	}
+
+	template <typename Result>
+	inline std::suspend_always LookupTask<Result>::promise_type::final_suspend() const noexcept
+	{
+		return {};
+	}
+
+	template <typename Result>
+	inline void LookupTask<Result>::promise_type::return_value( Result result ) noexcept
+	{
+		value = std::move( result );
+	}
+
+	template <typename Result>
+	inline void LookupTask<Result>::promise_type::unhandled_exception() const noexcept
+	{
+		std::terminate();
+	}
+
+	template <typename Result>
+	inline void* LookupTask<Result>::promise_type::operator new( size_t size )
+	{
+		return detail::FramePool::forThisThread().allocate( size );
+	}
+
+	template <typename Result>
+	inline void LookupTask<Result>::promise_type::operator delete( void* frame, size_t size ) noexcept
+	{
+		detail::FramePool::forThisThread().deallocate( frame, size );
+	}
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename Result>
+	inline LookupTask<Result>::LookupTask( std::coroutine_handle<promise_type> handle ) noexcept
+		: m_handle{ handle }
+	{
+	}
+
+	template <typename Result>
+	inline LookupTask<Result>::LookupTask( LookupTask&& other ) noexcept
+		: m_handle{ std::exchange( other.m_handle, nullptr ) }
+	{
+	}
+
+	template <typename Result>
+	inline LookupTask<Result>& LookupTask<Result>::operator=( LookupTask&& other ) noexcept
+	{
+		if ( this != &other )
+		{
+			if ( m_handle )
+			{
+				m_handle.destroy();
+			}
+			m_handle = std::exchange( other.m_handle, nullptr );
+		}
+
+		return *this;
+	}
+
+	template <typename Result>
+	inline LookupTask<Result>::~LookupTask()
+	{
+		if ( m_handle )
+		{
+			m_handle.destroy();
+		}
+	}
+
+	//----------------------------------------------
+	// Scheduling
+	//----------------------------------------------
+
+	template <typename Result>
+	inline bool LookupTask<Result>::done() const noexcept
+	{
+		return !m_handle || m_handle.done();
+	}
+
+	template <typename Result>
+	inline void LookupTask<Result>::resume() const
+	{
+		m_handle.resume();
+	}
+
+	template <typename Result>
+	inline Result& LookupTask<Result>::result() noexcept
+	{
+		return m_handle.promise().value;
+	}
+
+	//=====================================================================
+	// Interleaved lookup
+	//=====================================================================
+
+	inline constexpr bool PrefetchAwaiter::await_ready() const noexcept
+	{
+		return false;
+	}
+
+	inline void PrefetchAwaiter::await_suspend( std::coroutine_handle<> ) const noexcept
+	{
+		detail::prefetchForRead( address );
+	}
+
+	inline constexpr void PrefetchAwaiter::await_resume() const noexcept
+	{
+	}
+
+	inline constexpr PrefetchAwaiter prefetchAndSuspend( const void* address ) noexcept
+	{
+		return PrefetchAwaiter{ address };
+	}
+
+	template <typename Key, typename Result, typename Lookup>
+	inline void interleaveLookups( std::span<const Key> keys, std::span<Result> results, Lookup&& lookup, size_t width )
+	{
+		using Task = std::invoke_result_t<Lookup&, const Key&>;
+
+		const size_t count = std::min( keys.size(), results.size() );
+		width = std::clamp<size_t>( width, 1, constants::MAX_INTERLEAVE_WIDTH );
+
+		std::array<Task, constants::MAX_INTERLEAVE_WIDTH> tasks;
+		std::array<size_t, constants::MAX_INTERLEAVE_WIDTH> owner; // Key index of each slot
+
+		// Start the first `width` lookups; each runs to its first prefetch
+		size_t next{ 0 };
+		size_t active{ 0 };
+		for ( ; active < width && next < count; ++active, ++next )
+		{
+			tasks[active] = lookup( keys[next] );
+			owner[active] = next;
+		}
+
+		while ( active > 0 )
+		{
+			for ( size_t slot = 0; slot < active; )
+			{
+				Task& task = tasks[slot];
+				if ( !task.done() )
+				{
+					task.resume();
+				}
+				if ( !task.done() )
+				{
+					++slot;
+					continue;
+				}
+
+				results[owner[slot]] = std::move( task.result() );
+				if ( next < count )
+				{
+					// Refill: the new lookup issues its prefetch now and is resumed next round
+					task = lookup( keys[next] );
+					owner[slot] = next++;
+					++slot;
+				}
+				else
+				{
+					// Drain: move the last active lookup into this slot and resume it this round
+					--active;
+					task = std::move( tasks[active] );
+					owner[slot] = owner[active];
+				}
+			}
+		}
+	}
+} // namespace nfx::core::hashing
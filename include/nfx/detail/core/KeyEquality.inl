@@ -0,0 +1,203 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file KeyEquality.inl
+ * @brief Short-key equality implementation
+ * @details Scalar overlapping loads, page-checked masked SSE2 compare and overlapping
+ *          SSE2/AVX2 block compares
+ */
+
+#if defined( __AVX2__ )
+#	include <immintrin.h>
+#elif defined( __SSE2__ ) || defined( _M_X64 )
+#	include <emmintrin.h>
+#endif
+
+#include <cstring>
+
+namespace nfx::core::hashing
+{
+	namespace detail
+	{
+		//=====================================================================
+		// Scalar paths
+		//=====================================================================
+
+		template <typename T>
+		inline T loadUnaligned( const uint8_t* p ) noexcept
+		{
+			T value;
+			std::memcpy( &value, p, sizeof( T ) );
+
+			return value;
+		}
+
+		/** @brief 1-16 bytes with overlapping loads: [0, 8) and [n - 8, n), and so on down. */
+		inline bool bytesEqualSmall( const uint8_t* a, const uint8_t* b, size_t length ) noexcept
+		{
+			if ( length >= 8 )
+			{
+				return ( ( loadUnaligned<uint64_t>( a ) ^ loadUnaligned<uint64_t>( b ) ) |
+						   ( loadUnaligned<uint64_t>( a + length - 8 ) ^ loadUnaligned<uint64_t>( b + length - 8 ) ) ) == 0;
+			}
+			if ( length >= 4 )
+			{
+				return ( ( loadUnaligned<uint32_t>( a ) ^ loadUnaligned<uint32_t>( b ) ) |
+						   ( loadUnaligned<uint32_t>( a + length - 4 ) ^ loadUnaligned<uint32_t>( b + length - 4 ) ) ) == 0;
+			}
+
+			// 1-3 bytes: first, middle and last cover every byte
+			return ( ( a[0] ^ b[0] ) | ( a[length >> 1] ^ b[length >> 1] ) | ( a[length - 1] ^ b[length - 1] ) ) == 0;
+		}
+
+#if defined( __SSE2__ ) || defined( _M_X64 )
+		//=====================================================================
+		// SSE2 / AVX2 paths
+		//=====================================================================
+
+		/** @brief Checks that a 16-byte load from `p` stays within p's page. */
+		inline bool loadStaysInPage( const uint8_t* p ) noexcept
+		{
+			return ( reinterpret_cast<uintptr_t>( p ) & ( constants::KEY_EQUAL_PAGE_SIZE - 1 ) ) <= constants::KEY_EQUAL_PAGE_SIZE - 16;
+		}
+
+		/** @brief Equality mask of 16 bytes: bit i set if a[i] == b[i]. */
+		inline uint32_t equalMask16( const uint8_t* a, const uint8_t* b ) noexcept
+		{
+			const __m128i x = _mm_loadu_si128( reinterpret_cast<const __m128i*>( a ) );
+			const __m128i y = _mm_loadu_si128( reinterpret_cast<const __m128i*>( b ) );
+
+			return static_cast<uint32_t>( _mm_movemask_epi8( _mm_cmpeq_epi8( x, y ) ) );
+		}
+
+		/**
+		 * @brief 16-byte load that may extend past the object at `p` (within its page).
+		 * @details An out-of-bounds read is undefined behaviour the optimizer may act on, so
+		 *          GCC and Clang get an opaque asm load: no bounds reasoning, no sanitizer
+		 *          instrumentation. The "memory" clobber orders it after earlier stores.
+		 */
+		inline __m128i loadPastEnd16( const uint8_t* p ) noexcept
+		{
+#	if defined( __GNUC__ )
+			__m128i value;
+#		if defined( __AVX__ )
+			__asm__( "vmovdqu (%1), %0" : "=x"( value ) : "r"( p ) : "memory" );
+#		else
+			__asm__( "movdqu (%1), %0" : "=x"( value ) : "r"( p ) : "memory" );
+#		endif
+			return value;
+#	else
+			return _mm_loadu_si128( reinterpret_cast<const __m128i*>( p ) );
+#	endif
+		}
+
+		/** @brief 1-16 bytes with one 16-byte load each; only the low `length` lanes count. */
+		inline bool bytesEqualMasked( const uint8_t* a, const uint8_t* b, size_t length ) noexcept
+		{
+			const uint32_t lanes = ( 1u << length ) - 1;
+			const uint32_t equal = static_cast<uint32_t>( _mm_movemask_epi8( _mm_cmpeq_epi8( loadPastEnd16( a ), loadPastEnd16( b ) ) ) );
+
+			return ( ~equal & lanes ) == 0;
+		}
+
+		/** @brief 16-32 bytes: [0, 16) and [n - 16, n). */
+		inline bool bytesEqual32( const uint8_t* a, const uint8_t* b, size_t length ) noexcept
+		{
+			return ( equalMask16( a, b ) & equalMask16( a + length - 16, b + length - 16 ) ) == 0xFFFF;
+		}
+
+		/** @brief 32-64 bytes: [0, 32) and [n - 32, n). */
+		inline bool bytesEqual64( const uint8_t* a, const uint8_t* b, size_t length ) noexcept
+		{
+#	if defined( __AVX2__ )
+			const __m256i x0 = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( a ) );
+			const __m256i y0 = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( b ) );
+			const __m256i x1 = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( a + length - 32 ) );
+			const __m256i y1 = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( b + length - 32 ) );
+			const __m256i equal = _mm256_and_si256( _mm256_cmpeq_epi8( x0, y0 ), _mm256_cmpeq_epi8( x1, y1 ) );
+
+			return static_cast<uint32_t>( _mm256_movemask_epi8( equal ) ) == 0xFFFFFFFFu;
+#	else
+			return ( equalMask16( a, b ) & equalMask16( a + 16, b + 16 ) &
+					   equalMask16( a + length - 32, b + length - 32 ) & equalMask16( a + length - 16, b + length - 16 ) ) == 0xFFFF;
+#	endif
+		}
+#endif
+	} // namespace detail
+
+	//=====================================================================
+	// Key equality
+	//=====================================================================
+
+	inline bool bytesEqual( const void* a, const void* b, size_t length ) noexcept
+	{
+		const auto* x = static_cast<const uint8_t*>( a );
+		const auto* y = static_cast<const uint8_t*>( b );
+
+		if ( length <= 16 )
+		{
+			if ( length == 0 )
+			{
+				return true;
+			}
+#if defined( __SSE2__ ) || defined( _M_X64 )
+			if ( detail::loadStaysInPage( x ) && detail::loadStaysInPage( y ) )
+			{
+				return detail::bytesEqualMasked( x, y, length );
+			}
+#endif
+			return detail::bytesEqualSmall( x, y, length );
+		}
+
+#if defined( __SSE2__ ) || defined( _M_X64 )
+		if ( length <= 32 )
+		{
+			return detail::bytesEqual32( x, y, length );
+		}
+		if ( length <= constants::KEY_EQUAL_INLINE_MAX )
+		{
+			return detail::bytesEqual64( x, y, length );
+		}
+#endif
+
+		return std::memcmp( x, y, length ) == 0;
+	}
+
+	inline bool keysEqual( std::string_view a, std::string_view b ) noexcept
+	{
+		return a.size() == b.size() && bytesEqual( a.data(), b.data(), a.size() );
+	}
+
+	inline bool hashedKeysEqual( uint32_t storedHash, std::string_view storedKey, uint32_t hash, std::string_view key ) noexcept
+	{
+		// One branch rejects both hash and length mismatches
+		if ( ( ( storedHash ^ hash ) | ( storedKey.size() ^ key.size() ) ) != 0 )
+		{
+			return false;
+		}
+
+		return bytesEqual( storedKey.data(), key.data(), key.size() );
+	}
+} // namespace nfx::core::hashing
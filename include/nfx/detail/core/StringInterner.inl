@@ -0,0 +1,312 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file StringInterner.inl
+ * @brief Thread-safe string interning pool implementation
+ * @details Lock-free probing of an atomically published table, mutex-serialized insertion
+ *          into arena blocks and doubling record segments
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#include "nfx/core/Hashing.h"
+#include "nfx/core/KeyEquality.h"
+
+namespace nfx::core::strings
+{
+	namespace detail
+	{
+		/** @brief Segment holding entry `id`: segment s covers [F * (2^s - 1), F * (2^(s+1) - 1)). */
+		inline constexpr size_t internSegmentOf( uint32_t id ) noexcept
+		{
+			return static_cast<size_t>( std::bit_width( id / constants::INTERNER_FIRST_SEGMENT + 1 ) ) - 1;
+		}
+
+		/** @brief Index of the first entry in segment `segment`. */
+		inline constexpr size_t internSegmentBase( size_t segment ) noexcept
+		{
+			return constants::INTERNER_FIRST_SEGMENT * ( ( size_t{ 1 } << segment ) - 1 );
+		}
+	} // namespace detail
+
+	//=====================================================================
+	// InternedString class
+	//=====================================================================
+
+	inline InternedString::InternedString( const detail::InternEntry* entry ) noexcept
+		: m_entry{ entry }
+	{
+	}
+
+	inline std::string_view InternedString::view() const noexcept
+	{
+		return m_entry != nullptr ? m_entry->text : std::string_view{};
+	}
+
+	inline const char* InternedString::c_str() const noexcept
+	{
+		return m_entry != nullptr ? m_entry->text.data() : "";
+	}
+
+	inline uint32_t InternedString::hash() const noexcept
+	{
+		return m_entry != nullptr ? m_entry->hash : hashing::hashStringView( std::string_view{} );
+	}
+
+	inline uint32_t InternedString::id() const noexcept
+	{
+		return m_entry->id;
+	}
+
+	inline size_t InternedString::size() const noexcept
+	{
+		return view().size();
+	}
+
+	inline InternedString::operator bool() const noexcept
+	{
+		return m_entry != nullptr;
+	}
+
+	inline InternedString::operator hashing::HashedStringView() const noexcept
+	{
+		return hashing::HashedStringView{ view(), hash() };
+	}
+
+	//=====================================================================
+	// StringInterner class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline StringInterner::StringInterner( size_t initialCapacity )
+	{
+		m_tables.push_back( makeTable( std::bit_ceil( std::max<size_t>( initialCapacity, 16 ) ) ) );
+		m_memory += ( m_tables.back()->mask + 1 ) * sizeof( std::atomic<const detail::InternEntry*> );
+		m_table.store( m_tables.back().get(), std::memory_order_release );
+	}
+
+	//----------------------------------------------
+	// Interning
+	//----------------------------------------------
+
+	inline InternedString StringInterner::intern( const hashing::HashedStringView& text )
+	{
+		// Fast path: already interned, no lock
+		if ( const auto* entry = probe( *m_table.load( std::memory_order_acquire ), text.view(), text.hash() ); entry != nullptr )
+		{
+			return InternedString{ entry };
+		}
+
+		return InternedString{ insert( text.view(), text.hash() ) };
+	}
+
+	inline std::optional<InternedString> StringInterner::find( const hashing::HashedStringView& text ) const noexcept
+	{
+		// grow() copies every entry before publishing a table, so whichever table the acquire
+		// load returns holds everything interned before this call started
+		if ( const auto* entry = probe( *m_table.load( std::memory_order_acquire ), text.view(), text.hash() ); entry != nullptr )
+		{
+			return InternedString{ entry };
+		}
+
+		return std::nullopt;
+	}
+
+	inline InternedString StringInterner::at( uint32_t id ) const noexcept
+	{
+		const size_t segment = detail::internSegmentOf( id );
+		const detail::InternEntry* entries = m_segments[segment].load( std::memory_order_acquire );
+
+		return InternedString{ &entries[id - detail::internSegmentBase( segment )] };
+	}
+
+	//----------------------------------------------
+	// Statistics
+	//----------------------------------------------
+
+	inline size_t StringInterner::size() const noexcept
+	{
+		return m_count.load( std::memory_order_acquire );
+	}
+
+	inline size_t StringInterner::memoryUsage() const noexcept
+	{
+		std::lock_guard lock{ m_mutex };
+
+		return m_memory;
+	}
+
+	//----------------------------------------------
+	// Internals
+	//----------------------------------------------
+
+	inline const detail::InternEntry* StringInterner::probe( const Table& table, std::string_view text, uint32_t hash ) const noexcept
+	{
+		for ( size_t slot = hashing::seedMix( 0, hash, table.mask + 1 );; slot = ( slot + 1 ) & table.mask )
+		{
+			const detail::InternEntry* entry = table.slots[slot].load( std::memory_order_acquire );
+			if ( entry == nullptr )
+			{
+				return nullptr;
+			}
+			if ( hashing::hashedKeysEqual( entry->hash, entry->text, hash, text ) )
+			{
+				return entry;
+			}
+		}
+	}
+
+	inline const detail::InternEntry* StringInterner::insert( std::string_view text, uint32_t hash )
+	{
+		std::lock_guard lock{ m_mutex };
+
+		// Another thread may have interned it (or grown the table) since the lock-free probe
+		if ( const auto* existing = probe( *m_tables.back(), text, hash ); existing != nullptr )
+		{
+			return existing;
+		}
+
+		detail::InternEntry& entry = newEntry();
+		entry.text = storeText( text );
+		entry.hash = hash;
+
+		place( *m_tables.back(), &entry );
+		m_count.store( entry.id + size_t{ 1 }, std::memory_order_release );
+
+		if ( ( entry.id + size_t{ 1 } ) * 2 > m_tables.back()->mask + 1 )
+		{
+			grow();
+		}
+
+		return &entry;
+	}
+
+	inline std::string_view StringInterner::storeText( std::string_view text )
+	{
+		// NUL terminator for c_str(); short strings are padded so a compare's 16-byte load never
+		// reaches the next string, which another thread may be writing under the lock
+		const size_t bytes = std::max( text.size() + 1, constants::INTERNER_MIN_TEXT_BYTES );
+		if ( bytes > m_remaining )
+		{
+			// Long strings get a block of their own and leave the current block in use
+			const size_t blockSize = bytes > constants::INTERNER_BLOCK_SIZE / 4 ? bytes : constants::INTERNER_BLOCK_SIZE;
+			m_blocks.push_back( std::make_unique_for_overwrite<char[]>( blockSize ) );
+			m_memory += blockSize;
+
+			if ( blockSize != constants::INTERNER_BLOCK_SIZE )
+			{
+				char* data = m_blocks.back().get();
+				std::memcpy( data, text.data(), text.size() );
+				data[text.size()] = '\0';
+
+				return std::string_view{ data, text.size() };
+			}
+
+			m_cursor = m_blocks.back().get();
+			m_remaining = blockSize;
+		}
+
+		char* data = m_cursor;
+		std::memcpy( data, text.data(), text.size() );
+		data[text.size()] = '\0';
+		m_cursor += bytes;
+		m_remaining -= bytes;
+
+		return std::string_view{ data, text.size() };
+	}
+
+	inline detail::InternEntry& StringInterner::newEntry()
+	{
+		const uint32_t id = static_cast<uint32_t>( m_count.load( std::memory_order_relaxed ) );
+		const size_t segment = detail::internSegmentOf( id );
+
+		detail::InternEntry* entries = m_segments[segment].load( std::memory_order_relaxed );
+		if ( entries == nullptr )
+		{
+			const size_t count = constants::INTERNER_FIRST_SEGMENT << segment;
+			m_segmentStorage.push_back( std::make_unique<detail::InternEntry[]>( count ) );
+			m_memory += count * sizeof( detail::InternEntry );
+
+			entries = m_segmentStorage.back().get();
+			m_segments[segment].store( entries, std::memory_order_release );
+		}
+
+		detail::InternEntry& entry = entries[id - detail::internSegmentBase( segment )];
+		entry.id = id;
+
+		return entry;
+	}
+
+	inline void StringInterner::grow()
+	{
+		const Table& current = *m_tables.back();
+		auto next = makeTable( ( current.mask + 1 ) * 2 );
+		for ( size_t slot = 0; slot <= current.mask; ++slot )
+		{
+			if ( const auto* entry = current.slots[slot].load( std::memory_order_relaxed ); entry != nullptr )
+			{
+				place( *next, entry );
+			}
+		}
+
+		// Readers still probing `current` stay valid: replaced tables are kept until destruction
+		m_memory += ( next->mask + 1 ) * sizeof( std::atomic<const detail::InternEntry*> );
+		m_table.store( next.get(), std::memory_order_release );
+		m_tables.push_back( std::move( next ) );
+	}
+
+	inline void StringInterner::place( Table& table, const detail::InternEntry* entry ) noexcept
+	{
+		size_t slot = hashing::seedMix( 0, entry->hash, table.mask + 1 );
+		while ( table.slots[slot].load( std::memory_order_relaxed ) != nullptr )
+		{
+			slot = ( slot + 1 ) & table.mask;
+		}
+		table.slots[slot].store( entry, std::memory_order_release );
+	}
+
+	inline std::unique_ptr<StringInterner::Table> StringInterner::makeTable( size_t capacity )
+	{
+		auto table = std::make_unique<Table>();
+		table->mask = capacity - 1;
+		table->slots = std::make_unique<std::atomic<const detail::InternEntry*>[]>( capacity );
+
+		return table;
+	}
+} // namespace nfx::core::strings
+
+//=====================================================================
+// Standard library integration
+//=====================================================================
+
+inline size_t std::hash<nfx::core::strings::InternedString>::operator()( nfx::core::strings::InternedString key ) const noexcept
+{
+	return key.hash();
+}
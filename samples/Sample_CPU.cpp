@@ -2,13 +2,16 @@
  * @file Sample_CPU.cpp
  * @brief Demonstrates CPU feature detection capabilities
  * @details This sample shows how to detect SSE4.2, AVX, and AVX2 support
- *          for runtime algorithm selection and optimization
+ *          for runtime algorithm selection and optimization, and how to read the
+ *          cache hierarchy for sizing blocks and partitions, and the processor
+ *          topology for placing worker threads
  */
 
 #include <iostream>
 #include <iomanip>
 
 #include <nfx/core/CPU.h>
+#include <nfx/core/Dispatch.h>
 
 int main()
 {
@@ -19,6 +22,19 @@ int main()
 	// CPU capability detection
 	//=========================================================================
 
+	std::cout << "--- Processor Identity ---" << std::endl;
+	std::cout << std::endl;
+
+	const auto& id = nfx::core::cpu::identity();
+	const auto& tuning = nfx::core::cpu::tuning();
+	std::cout << "  Brand:             " << id.brand << std::endl;
+	std::cout << "  Family/model/step: 0x" << std::hex << id.family << " / 0x" << id.model << std::dec << " / " << id.stepping << std::endl;
+	std::cout << "  Microarchitecture: " << nfx::core::cpu::microarchitectureName( id.microarchitecture ) << std::endl;
+	std::cout << "  Tuning:            PDEP/PEXT " << ( tuning.fastPdepPext ? "fast" : "slow" ) << ", AVX-512 "
+			  << ( tuning.preferAvx512 ? "preferred" : "avoided" ) << ", " << static_cast<int>( tuning.crc32Streams )
+			  << " CRC32 streams" << std::endl;
+	std::cout << std::endl;
+
 	std::cout << "--- Detected CPU Capabilities ---" << std::endl;
 	std::cout << std::endl;
 
@@ -87,6 +103,77 @@ int main()
 	}
 	std::cout << std::endl;
 
+	//=========================================================================
+	// Cache hierarchy
+	//=========================================================================
+
+	std::cout << "--- Cache Hierarchy ---" << std::endl;
+	std::cout << std::endl;
+
+	const auto& topology = nfx::core::cpu::cacheTopology();
+	for ( const auto& cache : topology.all() )
+	{
+		const char* type = cache.type == nfx::core::cpu::CacheType::Data
+							   ? "Data"
+						   : cache.type == nfx::core::cpu::CacheType::Instruction ? "Instruction"
+																					: "Unified";
+		std::cout << "  L" << static_cast<int>( cache.level ) << " " << std::left << std::setw( 12 ) << type << std::right
+				  << std::setw( 8 ) << cache.size / 1024 << " KiB, " << cache.associativity << "-way, "
+				  << cache.lineSize << " B lines, shared by " << cache.sharedBy << " CPU(s)" << std::endl;
+	}
+	if ( topology.count == 0 )
+	{
+		std::cout << "  Not exposed on this host; assuming " << topology.lineSize() << " B lines" << std::endl;
+	}
+	std::cout << std::endl;
+
+	//=========================================================================
+	// Processor topology
+	//=========================================================================
+
+	std::cout << "--- Processor Topology ---" << std::endl;
+	std::cout << std::endl;
+
+	const auto& processor = nfx::core::cpu::topology();
+	std::cout << "  Packages:       " << processor.packages << std::endl;
+	std::cout << "  Physical cores: " << processor.physicalCores << std::endl;
+	std::cout << "  Logical CPUs:   " << processor.cpus.size() << std::endl;
+	std::cout << "  NUMA nodes:     " << processor.numaNodes << std::endl;
+	std::cout << "  Hybrid:         " << ( processor.hybrid ? "yes" : "no" ) << std::endl;
+	if ( processor.hybrid )
+	{
+		std::cout << "    P-core CPUs:  " << processor.cpusOfType( nfx::core::cpu::CoreType::Performance ).size() << std::endl;
+		std::cout << "    E-core CPUs:  " << processor.cpusOfType( nfx::core::cpu::CoreType::Efficiency ).size() << std::endl;
+	}
+	std::cout << std::endl;
+
+	// One worker per physical core, on P-cores only when the processor is hybrid
+	std::cout << "  Worker placement: pin to " << processor.primaryThreads().size() << " primary SMT threads";
+	if ( processor.hybrid )
+	{
+		std::cout << " (or pinCurrentThreadToCoreType( CoreType::Performance ))";
+	}
+	std::cout << std::endl;
+	std::cout << std::endl;
+
+	//=========================================================================
+	// Build configuration report
+	//=========================================================================
+
+	std::cout << "--- Build Configuration ---" << std::endl;
+	std::cout << std::endl;
+
+	const auto build = nfx::core::cpu::buildReport( NFX_CORE_COMPILED_FEATURES );
+	std::cout << "  Compiled for:     " << nfx::core::cpu::describeFeatures( build.compiled ) << std::endl;
+	std::cout << "  Host supports:    " << nfx::core::cpu::describeFeatures( build.detected ) << std::endl;
+	std::cout << "  Missed by build:  " << nfx::core::cpu::describeFeatures( build.missed ) << std::endl;
+	std::cout << "  Unsupported:      " << nfx::core::cpu::describeFeatures( build.unsupported ) << std::endl;
+	if ( build.missed != nfx::core::cpu::Feature::None )
+	{
+		std::cout << "  Rebuild with -march=native (GCC/Clang) or /arch:AVX2 (MSVC) to use them" << std::endl;
+	}
+	std::cout << std::endl;
+
 	//=========================================================================
 	// Algorithm selection demo
 	//=========================================================================
@@ -0,0 +1,232 @@
+/**
+ * @file TESTS_Arena.cpp
+ * @brief Tests for the huge-page and NUMA-aware arena allocator
+ * @details Tests alignment, chunking, dedicated chunks for large requests, page backing
+ *          fallbacks, NUMA binding, bulk release, moves and the standard allocator adapter
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include <nfx/core/Arena.h>
+#include <nfx/core/CountMinSketch.h>
+#include <nfx/core/CPU.h>
+#include <nfx/core/Hashing.h>
+
+namespace nfx::core::memory::test
+{
+	using namespace nfx::core::memory;
+
+	//=====================================================================
+	// Allocation
+	//=====================================================================
+
+	TEST( ArenaTest, AllocatesAlignedDisjointZeroedBlocks )
+	{
+		Arena arena{ ArenaOptions{ PageSize::Small } };
+		EXPECT_EQ( arena.chunkCount(), 0u );
+
+		std::vector<std::pair<std::byte*, size_t>> blocks;
+		for ( size_t i = 1; i <= 200; ++i )
+		{
+			const size_t alignment = size_t{ 1 } << ( i % 7 );
+			auto* block = static_cast<std::byte*>( arena.allocate( i * 3, alignment ) );
+			ASSERT_NE( block, nullptr );
+			EXPECT_EQ( reinterpret_cast<uintptr_t>( block ) % alignment, 0u );
+			for ( size_t b = 0; b < i * 3; ++b )
+			{
+				EXPECT_EQ( block[b], std::byte{ 0 } );
+			}
+			std::memset( block, static_cast<int>( i ), i * 3 );
+			blocks.emplace_back( block, i * 3 );
+		}
+
+		// Every block still holds its own fill byte, so none overlap
+		for ( size_t i = 0; i < blocks.size(); ++i )
+		{
+			for ( size_t b = 0; b < blocks[i].second; ++b )
+			{
+				ASSERT_EQ( blocks[i].first[b], static_cast<std::byte>( i + 1 ) );
+			}
+		}
+
+		EXPECT_EQ( arena.chunkCount(), 1u );
+		EXPECT_GE( arena.bytesAllocated(), 3u * 200 * 201 / 2 );
+		EXPECT_LE( arena.bytesAllocated(), arena.bytesMapped() );
+	}
+
+	TEST( ArenaTest, TypedAllocationAndPageAlignment )
+	{
+		Arena arena;
+		uint64_t* values = arena.allocate<uint64_t>( 1000 );
+		ASSERT_NE( values, nullptr );
+		EXPECT_EQ( reinterpret_cast<uintptr_t>( values ) % alignof( uint64_t ), 0u );
+
+		void* page = arena.allocate( 100, constants::HUGE_PAGE_SIZE );
+		ASSERT_NE( page, nullptr );
+		EXPECT_EQ( reinterpret_cast<uintptr_t>( page ) % constants::HUGE_PAGE_SIZE, 0u );
+
+		EXPECT_EQ( arena.allocate<uint64_t>( SIZE_MAX / 4 ), nullptr );
+	}
+
+	TEST( ArenaTest, StartsNewChunkWhenFull )
+	{
+		ArenaOptions options{ PageSize::Small };
+		options.chunkSize = 64 * 1024;
+		Arena arena{ options };
+		EXPECT_EQ( arena.options().chunkSize, 64u * 1024 );
+
+		for ( size_t i = 0; i < 10; ++i )
+		{
+			ASSERT_NE( arena.allocate( 15 * 1024 ), nullptr );
+		}
+
+		EXPECT_EQ( arena.chunkCount(), 3u );
+		EXPECT_EQ( arena.bytesMapped(), 3u * 64 * 1024 );
+	}
+
+	TEST( ArenaTest, LargeRequestsGetDedicatedChunks )
+	{
+		ArenaOptions options{ PageSize::Small };
+		options.chunkSize = 64 * 1024;
+		Arena arena{ options };
+
+		auto* small = static_cast<std::byte*>( arena.allocate( 100 ) );
+		auto* large = static_cast<std::byte*>( arena.allocate( 1024 * 1024 + 1 ) );
+		auto* next = static_cast<std::byte*>( arena.allocate( 100 ) );
+		ASSERT_NE( small, nullptr );
+		ASSERT_NE( large, nullptr );
+
+		// The shared chunk keeps serving small requests after the large one
+		EXPECT_EQ( next, small + 100 + ( ( 16 - 100 % 16 ) % 16 ) );
+		EXPECT_EQ( arena.chunkCount(), 2u );
+		EXPECT_GE( arena.bytesMapped(), 64u * 1024 + 1024 * 1024 + 1 );
+		large[1024 * 1024] = std::byte{ 1 };
+	}
+
+	//=====================================================================
+	// Page backing and NUMA placement
+	//=====================================================================
+
+	TEST( ArenaTest, HugePageBackingIsReported )
+	{
+		Arena small{ ArenaOptions{ PageSize::Small } };
+		ASSERT_NE( small.allocate( 1024 ), nullptr );
+		EXPECT_EQ( small.hugePageBytes(), 0u );
+
+		// Transparent and explicit (falling back to transparent) chunks are 2 MiB multiples
+		for ( const PageSize pages : { PageSize::TransparentHuge, PageSize::ExplicitHuge } )
+		{
+			Arena arena{ ArenaOptions{ pages } };
+			auto* block = static_cast<std::byte*>( arena.allocate( 3 * 1024 * 1024 ) );
+			ASSERT_NE( block, nullptr );
+			block[3 * 1024 * 1024 - 1] = std::byte{ 1 };
+			EXPECT_EQ( arena.bytesMapped() % constants::HUGE_PAGE_SIZE, 0u );
+			EXPECT_LE( arena.hugePageBytes(), arena.bytesMapped() );
+		}
+	}
+
+	TEST( ArenaTest, BindsToExistingNode )
+	{
+		ArenaOptions options{ PageSize::TransparentHuge, 0u };
+		options.prefault = true;
+		Arena arena{ options };
+		auto* block = static_cast<std::byte*>( arena.allocate( 1024 ) );
+		ASSERT_NE( block, nullptr );
+		block[0] = std::byte{ 1 };
+
+		// Node 0 exists wherever the topology reports NUMA nodes
+		EXPECT_EQ( arena.numaBound(), nfx::core::cpu::topology().numaNodes > 0 );
+
+		Arena unbound;
+		ASSERT_NE( unbound.allocate( 1024 ), nullptr );
+		EXPECT_FALSE( unbound.numaBound() );
+
+		Arena missing{ ArenaOptions{ PageSize::Small, 100000u } };
+		ASSERT_NE( missing.allocate( 1024 ), nullptr );
+		EXPECT_FALSE( missing.numaBound() );
+	}
+
+	//=====================================================================
+	// Release and ownership
+	//=====================================================================
+
+	TEST( ArenaTest, ReleaseUnmapsEverything )
+	{
+		Arena arena;
+		ASSERT_NE( arena.allocate( 1000 ), nullptr );
+		ASSERT_NE( arena.allocate( 10 * 1024 * 1024 ), nullptr );
+		EXPECT_EQ( arena.chunkCount(), 2u );
+
+		arena.release();
+		EXPECT_EQ( arena.chunkCount(), 0u );
+		EXPECT_EQ( arena.bytesMapped(), 0u );
+		EXPECT_EQ( arena.bytesAllocated(), 0u );
+		EXPECT_EQ( arena.hugePageBytes(), 0u );
+
+		// Usable again after release
+		ASSERT_NE( arena.allocate( 1000 ), nullptr );
+		EXPECT_EQ( arena.chunkCount(), 1u );
+	}
+
+	TEST( ArenaTest, MoveTransfersChunks )
+	{
+		Arena source;
+		auto* block = static_cast<int*>( source.allocate( sizeof( int ) ) );
+		ASSERT_NE( block, nullptr );
+		*block = 42;
+		const size_t mapped = source.bytesMapped();
+
+		Arena target{ std::move( source ) };
+		EXPECT_EQ( target.bytesMapped(), mapped );
+		EXPECT_EQ( source.bytesMapped(), 0u );
+		EXPECT_EQ( source.chunkCount(), 0u );
+		EXPECT_EQ( *block, 42 );
+
+		Arena other;
+		ASSERT_NE( other.allocate( 16 ), nullptr );
+		other = std::move( target );
+		EXPECT_EQ( other.bytesMapped(), mapped );
+		EXPECT_EQ( *block, 42 );
+	}
+
+	//=====================================================================
+	// ArenaAllocator
+	//=====================================================================
+
+	TEST( ArenaAllocatorTest, BacksStandardContainers )
+	{
+		Arena arena;
+		std::vector<uint64_t, ArenaAllocator<uint64_t>> values{ ArenaAllocator<uint64_t>{ arena } };
+		for ( uint64_t i = 0; i < 100000; ++i )
+		{
+			values.push_back( i * i );
+		}
+
+		EXPECT_EQ( values[99999], 99999ull * 99999ull );
+		EXPECT_GE( arena.bytesAllocated(), 100000u * sizeof( uint64_t ) );
+
+		const ArenaAllocator<char> rebound{ values.get_allocator() };
+		EXPECT_EQ( &rebound.arena(), &arena );
+		EXPECT_TRUE( rebound == values.get_allocator() );
+	}
+
+	TEST( ArenaAllocatorTest, BacksCountMinSketch )
+	{
+		Arena arena;
+		nfx::core::sketch::CountMinSketch<4, ArenaAllocator<uint32_t>> placed{ 1 << 16, ArenaAllocator<uint32_t>{ arena } };
+		nfx::core::sketch::CountMinSketch<> reference{ 1 << 16 };
+		EXPECT_GE( arena.bytesAllocated(), 4u * ( 1 << 16 ) * sizeof( uint32_t ) );
+
+		for ( uint64_t i = 0; i < 10000; ++i )
+		{
+			const uint64_t hash = nfx::core::hashing::hashInteger( i % 977 );
+			EXPECT_EQ( placed.add( hash ), reference.add( hash ) );
+		}
+		EXPECT_EQ( placed.estimate( nfx::core::hashing::hashInteger( uint64_t{ 5 } ) ), reference.estimate( nfx::core::hashing::hashInteger( uint64_t{ 5 } ) ) );
+	}
+} // namespace nfx::core::memory::test
@@ -0,0 +1,205 @@
+/**
+ * @file TESTS_BatchLookup.cpp
+ * @brief Tests for batched hash-then-prefetch lookups
+ * @details Tests that lookupBatch() agrees with one-at-a-time probing for integer and
+ *          string keys, partial groups, custom hashes and short result spans
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/core/BatchLookup.h>
+#include <nfx/core/Hashing.h>
+
+namespace nfx::core::hashing::test
+{
+	using namespace nfx::core::hashing;
+
+	//=====================================================================
+	// Test helpers
+	//=====================================================================
+
+	/** @brief Minimal linear-probing table keyed by the same slot function as lookupBatch(). */
+	template <typename Key>
+	class ProbeTable
+	{
+	public:
+		struct Entry
+		{
+			Key key{};
+			uint32_t value{ 0 };
+			bool used{ false };
+		};
+
+		explicit ProbeTable( size_t size, uint32_t seed = 17 )
+			: m_entries( size ), m_seed{ seed }
+		{
+		}
+
+		void insert( const Key& key, uint32_t value )
+		{
+			for ( uint32_t slot = seedMix( m_seed, LookupHash{}( key ), m_entries.size() );; slot = ( slot + 1 ) & mask() )
+			{
+				if ( !m_entries[slot].used )
+				{
+					m_entries[slot] = { key, value, true };
+					return;
+				}
+			}
+		}
+
+		std::optional<uint32_t> probe( const Key& key, uint32_t slot ) const
+		{
+			for ( ; m_entries[slot].used; slot = ( slot + 1 ) & mask() )
+			{
+				if ( m_entries[slot].key == key )
+				{
+					return m_entries[slot].value;
+				}
+			}
+
+			return std::nullopt;
+		}
+
+		std::optional<uint32_t> find( const Key& key ) const
+		{
+			return probe( key, seedMix( m_seed, LookupHash{}( key ), m_entries.size() ) );
+		}
+
+		template <size_t BatchSize = constants::LOOKUP_BATCH_SIZE>
+		void findBatch( std::span<const Key> keys, std::span<std::optional<uint32_t>> results ) const
+		{
+			lookupBatch<BatchSize>(
+				keys, results, m_seed, m_entries.size(),
+				[this]( uint32_t slot ) { return static_cast<const void*>( &m_entries[slot] ); },
+				[this]( const Key& key, uint32_t slot ) { return probe( key, slot ); } );
+		}
+
+	private:
+		uint32_t mask() const noexcept
+		{
+			return static_cast<uint32_t>( m_entries.size() - 1 );
+		}
+
+		std::vector<Entry> m_entries;
+		uint32_t m_seed;
+	};
+
+	//=====================================================================
+	// Agreement with one-at-a-time probing
+	//=====================================================================
+
+	TEST( BatchLookupTest, IntegerKeysMatchSingleLookups )
+	{
+		ProbeTable<uint64_t> table{ 1024 };
+		for ( uint64_t k = 0; k < 600; ++k )
+		{
+			table.insert( k * 7919, static_cast<uint32_t>( k ) );
+		}
+
+		// Half present, half absent; 203 keys leave a partial trailing group
+		std::vector<uint64_t> keys;
+		for ( uint64_t k = 0; k < 203; ++k )
+		{
+			keys.push_back( k * 7919 * ( k % 2 == 0 ? 1 : 3 ) + ( k % 2 ) );
+		}
+
+		std::vector<std::optional<uint32_t>> results( keys.size() );
+		table.findBatch( std::span<const uint64_t>{ keys }, std::span{ results } );
+
+		for ( size_t i = 0; i < keys.size(); ++i )
+		{
+			EXPECT_EQ( results[i], table.find( keys[i] ) ) << "key " << keys[i];
+		}
+		EXPECT_EQ( results[0], 0u );
+		EXPECT_EQ( results[2], 2u );
+	}
+
+	TEST( BatchLookupTest, StringKeysUseHashStringView )
+	{
+		ProbeTable<std::string> table{ 256 };
+		std::vector<std::string> keys;
+		for ( uint32_t i = 0; i < 100; ++i )
+		{
+			keys.push_back( "user:" + std::to_string( i ) );
+			table.insert( keys.back(), i );
+		}
+		keys.push_back( "missing" );
+
+		std::vector<std::optional<uint32_t>> results( keys.size() );
+		table.findBatch( std::span<const std::string>{ keys }, std::span{ results } );
+
+		for ( uint32_t i = 0; i < 100; ++i )
+		{
+			EXPECT_EQ( results[i], i );
+		}
+		EXPECT_FALSE( results.back().has_value() );
+		EXPECT_EQ( LookupHash{}( keys[0] ), hashStringView( keys[0] ) );
+	}
+
+	TEST( BatchLookupTest, BatchSizeDoesNotChangeResults )
+	{
+		ProbeTable<uint64_t> table{ 512 };
+		std::vector<uint64_t> keys;
+		for ( uint64_t k = 0; k < 300; ++k )
+		{
+			table.insert( k, static_cast<uint32_t>( k * 3 ) );
+			keys.push_back( k * 2 );
+		}
+
+		std::vector<std::optional<uint32_t>> one( keys.size() );
+		std::vector<std::optional<uint32_t>> seven( keys.size() );
+		std::vector<std::optional<uint32_t>> many( keys.size() );
+		table.findBatch<1>( std::span<const uint64_t>{ keys }, std::span{ one } );
+		table.findBatch<7>( std::span<const uint64_t>{ keys }, std::span{ seven } );
+		table.findBatch<64>( std::span<const uint64_t>{ keys }, std::span{ many } );
+
+		EXPECT_EQ( one, seven );
+		EXPECT_EQ( one, many );
+	}
+
+	//=====================================================================
+	// Accessor contract
+	//=====================================================================
+
+	TEST( BatchLookupTest, CustomHashAndSlotsArePassedThrough )
+	{
+		const std::vector<uint32_t> keys{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18 };
+		std::vector<uint32_t> table( 64 );
+		std::vector<uint32_t> slots( keys.size() );
+		size_t prefetched{ 0 };
+
+		lookupBatch<4>(
+			std::span<const uint32_t>{ keys }, std::span{ slots }, 5, table.size(),
+			[&]( uint32_t slot ) { ++prefetched; return static_cast<const void*>( &table[slot] ); },
+			[]( uint32_t, uint32_t slot ) { return slot; },
+			[]( uint32_t key ) { return key * 0x9E3779B1u; } );
+
+		for ( size_t i = 0; i < keys.size(); ++i )
+		{
+			EXPECT_EQ( slots[i], seedMix( 5, keys[i] * 0x9E3779B1u, table.size() ) );
+		}
+
+		// Four full groups are prefetched; the two trailing keys are resolved directly
+		EXPECT_EQ( prefetched, 16u );
+	}
+
+	TEST( BatchLookupTest, ShortResultSpanLimitsWork )
+	{
+		const std::vector<uint64_t> keys( 40, 1 );
+		std::vector<int> results( 10, 0 );
+		size_t resolved{ 0 };
+
+		lookupBatch(
+			std::span<const uint64_t>{ keys }, std::span{ results }, 0, 16,
+			[&]( uint32_t slot ) { return static_cast<const void*>( &results[slot % results.size()] ); },
+			[&]( uint64_t, uint32_t ) { ++resolved; return 1; } );
+
+		EXPECT_EQ( resolved, results.size() );
+	}
+} // namespace nfx::core::hashing::test
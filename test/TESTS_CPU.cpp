@@ -0,0 +1,342 @@
+/**
+ * @file TESTS_CPU.cpp
+ * @brief Tests for CPU feature detection
+ * @details Tests covering the features() snapshot: stability, consistency with the
+ *          legacy queries, implied-feature invariants and agreement with the compiler's
+ *          own runtime detection, the cache hierarchy from CPUID and sysfs, processor
+ *          topology and thread pinning, microarchitecture decoding and tuning parameters
+ */
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#if defined( __linux__ )
+#	include <sched.h>
+#endif
+
+#include <nfx/core/CPU.h>
+
+namespace nfx::core::cpu::test
+{
+	using namespace nfx::core::cpu;
+
+	//=====================================================================
+	// Feature snapshot
+	//=====================================================================
+
+	TEST( CpuFeatures, SnapshotIsStable )
+	{
+		const CpuFeatures& first = features();
+		const CpuFeatures& second = features();
+		const CpuFeatures redetected = detail::detectFeatures();
+
+		// Same storage, not a fresh detection per call
+		EXPECT_EQ( &first, &second );
+		EXPECT_EQ( std::memcmp( &first, &redetected, sizeof( CpuFeatures ) ), 0 );
+	}
+
+	TEST( CpuFeatures, MatchesLegacyQueries )
+	{
+		EXPECT_EQ( hasSSE42Support(), features().sse42 );
+		EXPECT_EQ( hasAVXSupport(), features().avx );
+		EXPECT_EQ( hasAVX2Support(), features().avx2 );
+	}
+
+	TEST( CpuFeatures, ImpliedFeatures )
+	{
+		const CpuFeatures& f = features();
+
+		// Extensions that need YMM / ZMM state are never reported without their base
+		if ( f.avx2 || f.fma )
+		{
+			EXPECT_TRUE( f.avx );
+		}
+		if ( f.avx512f )
+		{
+			EXPECT_TRUE( f.avx );
+		}
+		if ( f.avx512dq || f.avx512cd || f.avx512bw || f.avx512vl )
+		{
+			EXPECT_TRUE( f.avx512f );
+		}
+	}
+
+	TEST( CpuFeatures, ConcurrentFirstUse )
+	{
+		std::vector<std::thread> threads;
+		std::vector<const CpuFeatures*> seen( 8, nullptr );
+		for ( size_t t = 0; t < seen.size(); ++t )
+		{
+			threads.emplace_back( [&seen, t]() { seen[t] = &features(); } );
+		}
+		for ( auto& thread : threads )
+		{
+			thread.join();
+		}
+
+		for ( const CpuFeatures* f : seen )
+		{
+			EXPECT_EQ( f, &features() );
+		}
+	}
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+	TEST( CpuFeatures, MatchesCompilerDetection )
+	{
+		// libgcc's detection also checks XCR0 for AVX / AVX-512
+		const CpuFeatures& f = features();
+
+		EXPECT_EQ( f.sse42, __builtin_cpu_supports( "sse4.2" ) != 0 );
+		EXPECT_EQ( f.popcnt, __builtin_cpu_supports( "popcnt" ) != 0 );
+		EXPECT_EQ( f.avx, __builtin_cpu_supports( "avx" ) != 0 );
+		EXPECT_EQ( f.avx2, __builtin_cpu_supports( "avx2" ) != 0 );
+		EXPECT_EQ( f.bmi1, __builtin_cpu_supports( "bmi" ) != 0 );
+		EXPECT_EQ( f.bmi2, __builtin_cpu_supports( "bmi2" ) != 0 );
+		EXPECT_EQ( f.fma, __builtin_cpu_supports( "fma" ) != 0 );
+		EXPECT_EQ( f.avx512f, __builtin_cpu_supports( "avx512f" ) != 0 );
+		EXPECT_EQ( f.avx512bw, __builtin_cpu_supports( "avx512bw" ) != 0 );
+		EXPECT_EQ( f.avx512vl, __builtin_cpu_supports( "avx512vl" ) != 0 );
+	}
+#endif
+
+	//=====================================================================
+	// Cache hierarchy
+	//=====================================================================
+
+	TEST( CacheTopology, LevelsAreOrderedAndSane )
+	{
+		const CacheTopology& topology = cacheTopology();
+		EXPECT_EQ( &topology, &cacheTopology() );
+		EXPECT_LE( topology.count, CacheTopology::MAX_CACHES );
+
+		uint8_t previousLevel = 0;
+		for ( const CacheInfo& cache : topology.all() )
+		{
+			EXPECT_GE( cache.level, previousLevel );
+			EXPECT_GE( cache.level, 1 );
+			EXPECT_GT( cache.size, 0u );
+			EXPECT_TRUE( std::has_single_bit( cache.lineSize ) );
+			previousLevel = cache.level;
+		}
+	}
+
+	TEST( CacheTopology, DataCacheQueries )
+	{
+		const CacheTopology& topology = cacheTopology();
+
+		EXPECT_TRUE( std::has_single_bit( topology.lineSize() ) );
+		EXPECT_EQ( topology.dataCache( 0 ), nullptr );
+		EXPECT_EQ( topology.dataCacheSize( 0 ), 0u );
+
+		const CacheInfo* l1 = topology.dataCache( 1 );
+		const CacheInfo* l2 = topology.dataCache( 2 );
+		if ( l1 == nullptr )
+		{
+			GTEST_SKIP() << "Cache hierarchy not exposed on this host";
+		}
+
+		EXPECT_NE( l1->type, CacheType::Instruction );
+		EXPECT_EQ( topology.lineSize(), l1->lineSize );
+		if ( l2 != nullptr )
+		{
+			// Caches grow outwards and are shared by at least as many CPUs
+			EXPECT_GT( l2->size, l1->size );
+			EXPECT_GE( l2->sharedBy, l1->sharedBy );
+		}
+	}
+
+	TEST( CacheTopology, CpuidAgreesWithSysfs )
+	{
+		const CacheTopology fromCpuid = detail::detectCachesCpuid();
+		const CacheTopology fromSysfs = detail::detectCachesSysfs();
+		if ( fromCpuid.count == 0 || fromSysfs.count == 0 )
+		{
+			GTEST_SKIP() << "Only one detection source available";
+		}
+
+		for ( uint8_t level = 1; level <= 3; ++level )
+		{
+			const CacheInfo* a = fromCpuid.dataCache( level );
+			const CacheInfo* b = fromSysfs.dataCache( level );
+			ASSERT_EQ( a == nullptr, b == nullptr ) << "L" << int{ level };
+			if ( a != nullptr )
+			{
+				EXPECT_EQ( a->size, b->size ) << "L" << int{ level };
+				EXPECT_EQ( a->lineSize, b->lineSize ) << "L" << int{ level };
+			}
+		}
+	}
+
+	TEST( CacheTopology, SysfsParsing )
+	{
+		EXPECT_EQ( detail::parseSysfsSize( "48K" ), 48u * 1024u );
+		EXPECT_EQ( detail::parseSysfsSize( "32M" ), 32u * 1024u * 1024u );
+		EXPECT_EQ( detail::parseSysfsSize( "512" ), 512u );
+
+		EXPECT_EQ( detail::countSysfsCpuList( "0" ), 1u );
+		EXPECT_EQ( detail::countSysfsCpuList( "0-3" ), 4u );
+		EXPECT_EQ( detail::countSysfsCpuList( "0-3,8-11\n" ), 8u );
+		EXPECT_EQ( detail::countSysfsCpuList( "0,2,4,6" ), 4u );
+	}
+
+	//=====================================================================
+	// Processor topology
+	//=====================================================================
+
+	TEST( CpuTopology, CountsAreConsistent )
+	{
+		const CpuTopology& topo = topology();
+		EXPECT_EQ( &topo, &topology() );
+
+		ASSERT_FALSE( topo.cpus.empty() );
+		EXPECT_GE( topo.packages, 1u );
+		EXPECT_GE( topo.numaNodes, 1u );
+		EXPECT_GE( topo.physicalCores, topo.packages );
+		EXPECT_LE( topo.physicalCores, topo.cpus.size() );
+		EXPECT_EQ( topo.primaryThreads().size(), topo.physicalCores );
+
+		for ( size_t i = 1; i < topo.cpus.size(); ++i )
+		{
+			EXPECT_LT( topo.cpus[i - 1].id, topo.cpus[i].id );
+		}
+	}
+
+	TEST( CpuTopology, CoreTypesAndNodesPartitionCpus )
+	{
+		const CpuTopology& topo = topology();
+
+		const size_t typed = topo.cpusOfType( CoreType::Performance ).size() + topo.cpusOfType( CoreType::Efficiency ).size() +
+							 topo.cpusOfType( CoreType::Unknown ).size();
+		EXPECT_EQ( typed, topo.cpus.size() );
+		if ( !topo.hybrid )
+		{
+			EXPECT_EQ( topo.cpusOfType( CoreType::Performance ).size(), topo.cpus.size() );
+		}
+
+		size_t onNodes = 0;
+		for ( uint32_t node = 0; node < 1024 && onNodes < topo.cpus.size(); ++node )
+		{
+			onNodes += topo.cpusOnNode( node ).size();
+		}
+		EXPECT_EQ( onNodes, topo.cpus.size() );
+	}
+
+#if defined( __linux__ )
+	TEST( CpuTopology, PinCurrentThread )
+	{
+		cpu_set_t saved;
+		ASSERT_EQ( sched_getaffinity( 0, sizeof( saved ), &saved ), 0 );
+
+		const uint32_t target = topology().cpus.back().id;
+		if ( !CPU_ISSET( target, &saved ) )
+		{
+			GTEST_SKIP() << "CPU " << target << " is outside this process's cpuset";
+		}
+
+		ASSERT_TRUE( pinCurrentThread( target ) );
+		EXPECT_EQ( static_cast<uint32_t>( sched_getcpu() ), target );
+
+		EXPECT_TRUE( pinCurrentThreadToNode( topology().cpus.back().node ) );
+		EXPECT_TRUE( pinCurrentThreadToCoreType( topology().cpus.back().type ) );
+		EXPECT_FALSE( pinCurrentThread( std::span<const uint32_t>{} ) );
+
+		ASSERT_EQ( sched_setaffinity( 0, sizeof( saved ), &saved ), 0 );
+	}
+#endif
+
+	//=====================================================================
+	// Processor identification
+	//=====================================================================
+
+	TEST( CpuIdentity, DecodesKnownSignatures )
+	{
+		using enum Microarchitecture;
+
+		static_assert( decodeMicroarchitecture( Vendor::Intel, 6, 0x55, 4 ) == SkylakeServer );
+		static_assert( decodeMicroarchitecture( Vendor::Intel, 6, 0x55, 7 ) == CascadeLake );
+		static_assert( decodeMicroarchitecture( Vendor::Intel, 6, 0x55, 11 ) == CooperLake );
+
+		EXPECT_EQ( decodeMicroarchitecture( Vendor::Intel, 6, 0x3C, 3 ), Haswell );
+		EXPECT_EQ( decodeMicroarchitecture( Vendor::Intel, 6, 0x9E, 10 ), Skylake );
+		EXPECT_EQ( decodeMicroarchitecture( Vendor::Intel, 6, 0x6A, 6 ), IceLakeServer );
+		EXPECT_EQ( decodeMicroarchitecture( Vendor::Intel, 6, 0x97, 2 ), AlderLake );
+		EXPECT_EQ( decodeMicroarchitecture( Vendor::Intel, 6, 0x8F, 8 ), SapphireRapids );
+		EXPECT_EQ( decodeMicroarchitecture( Vendor::Intel, 6, 0x86, 7 ), Tremont );
+		EXPECT_EQ( decodeMicroarchitecture( Vendor::AMD, 0x17, 0x01, 1 ), Zen );
+		EXPECT_EQ( decodeMicroarchitecture( Vendor::AMD, 0x17, 0x08, 2 ), ZenPlus );
+		EXPECT_EQ( decodeMicroarchitecture( Vendor::AMD, 0x17, 0x31, 0 ), Zen2 );
+		EXPECT_EQ( decodeMicroarchitecture( Vendor::AMD, 0x17, 0x71, 0 ), Zen2 );
+		EXPECT_EQ( decodeMicroarchitecture( Vendor::AMD, 0x19, 0x01, 1 ), Zen3 );
+		EXPECT_EQ( decodeMicroarchitecture( Vendor::AMD, 0x19, 0x21, 0 ), Zen3 );
+		EXPECT_EQ( decodeMicroarchitecture( Vendor::AMD, 0x19, 0x11, 1 ), Zen4 );
+		EXPECT_EQ( decodeMicroarchitecture( Vendor::AMD, 0x19, 0x61, 2 ), Zen4 );
+		EXPECT_EQ( decodeMicroarchitecture( Vendor::AMD, 0x1A, 0x44, 0 ), Zen5 );
+		EXPECT_EQ( decodeMicroarchitecture( Vendor::Hygon, 0x18, 0x01, 0 ), Zen );
+		EXPECT_EQ( decodeMicroarchitecture( Vendor::Intel, 6, 0x01, 0 ), Unknown );
+		EXPECT_EQ( decodeMicroarchitecture( Vendor::Unknown, 6, 0x55, 4 ), Unknown );
+	}
+
+	TEST( CpuIdentity, NamesAreDistinct )
+	{
+		static_assert( microarchitectureName( Microarchitecture::Unknown ) == "Unknown" );
+		static_assert( microarchitectureName( Microarchitecture::Zen5 ) == "Zen5" );
+		static_assert( microarchitectureName( Microarchitecture::SkylakeServer ) == "SkylakeServer" );
+
+		for ( uint8_t a = 0; a <= static_cast<uint8_t>( Microarchitecture::Zen5 ); ++a )
+		{
+			for ( uint8_t b = 0; b < a; ++b )
+			{
+				EXPECT_NE( microarchitectureName( static_cast<Microarchitecture>( a ) ), microarchitectureName( static_cast<Microarchitecture>( b ) ) );
+			}
+		}
+	}
+
+	TEST( CpuIdentity, HostIdentityIsConsistent )
+	{
+		const CpuIdentity& id = identity();
+		EXPECT_EQ( &id, &identity() );
+		EXPECT_EQ( id.microarchitecture, decodeMicroarchitecture( id.vendor, id.family, id.model, id.stepping ) );
+		EXPECT_LT( std::strlen( id.brand ), sizeof( id.brand ) );
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+		EXPECT_EQ( id.vendor == Vendor::Intel, __builtin_cpu_is( "intel" ) != 0 );
+		EXPECT_EQ( id.vendor == Vendor::AMD, __builtin_cpu_is( "amd" ) != 0 );
+#endif
+	}
+
+	//=====================================================================
+	// Tuning parameters
+	//=====================================================================
+
+	TEST( CpuTuning, TableEntries )
+	{
+		static_assert( !tuningFor( Microarchitecture::Zen2 ).fastPdepPext );
+		static_assert( tuningFor( Microarchitecture::Zen3 ).fastPdepPext );
+		static_assert( !tuningFor( Microarchitecture::CascadeLake ).preferAvx512 );
+		static_assert( tuningFor( Microarchitecture::IceLakeServer ).preferAvx512 );
+		static_assert( tuningFor( Microarchitecture::Zen4 ).preferAvx512 );
+		static_assert( tuningFor( Microarchitecture::Zen2 ).crc32Streams == 1 );
+		static_assert( tuningFor( Microarchitecture::Zen3 ).crc32Streams == 3 );
+		static_assert( tuningFor( Microarchitecture::Skylake ).crc32Streams == 3 );
+		static_assert( tuningFor( Microarchitecture::Gracemont ).crc32Streams == 3 );
+
+		const TuningParameters defaults = tuningFor( Microarchitecture::Unknown );
+		EXPECT_TRUE( defaults.fastPdepPext );
+		EXPECT_TRUE( defaults.preferAvx512 );
+		EXPECT_GE( defaults.crc32Streams, 1 );
+	}
+
+	TEST( CpuTuning, HostTuningRespectsFeatures )
+	{
+		const TuningParameters& host = tuning();
+		const TuningParameters table = tuningFor( identity().microarchitecture );
+
+		EXPECT_EQ( host.preferAvx512, table.preferAvx512 && features().avx512f );
+		EXPECT_EQ( host.fastPdepPext, table.fastPdepPext && features().bmi2 );
+		EXPECT_EQ( host.crc32Streams, table.crc32Streams );
+	}
+} // namespace nfx::core::cpu::test
@@ -0,0 +1,211 @@
+/**
+ * @file TESTS_Checksum.cpp
+ * @brief Tests for the CRC32-C checksum API
+ * @details Tests the RFC 3720 vectors, agreement of every kernel with a bitwise reference
+ *          across lengths and alignments, extension, combination and trailing-CRC blocks
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <nfx/core/Checksum.h>
+#include <nfx/core/CPU.h>
+#include <nfx/core/Hashing.h>
+
+namespace nfx::core::checksum::test
+{
+	using namespace nfx::core::checksum;
+
+	//=====================================================================
+	// Helpers
+	//=====================================================================
+
+	/** @brief Bit-at-a-time CRC32-C, straight from the definition. */
+	static uint32_t referenceCrc32c( std::span<const std::byte> data )
+	{
+		uint32_t crc = 0xFFFFFFFF;
+		for ( const std::byte byte : data )
+		{
+			crc ^= static_cast<uint8_t>( byte );
+			for ( int bit = 0; bit < 8; ++bit )
+			{
+				crc = ( crc & 1 ) ? ( crc >> 1 ) ^ 0x82F63B78 : crc >> 1;
+			}
+		}
+
+		return crc ^ 0xFFFFFFFF;
+	}
+
+	static std::vector<std::byte> randomBytes( size_t size, uint32_t seed )
+	{
+		std::mt19937 gen( seed );
+		std::vector<std::byte> bytes( size );
+		for ( auto& byte : bytes )
+		{
+			byte = static_cast<std::byte>( gen() );
+		}
+
+		return bytes;
+	}
+
+	template <size_t N>
+	static std::array<std::byte, N> patternBytes( uint8_t first, int step )
+	{
+		std::array<std::byte, N> bytes{};
+		for ( size_t i = 0; i < N; ++i )
+		{
+			bytes[i] = static_cast<std::byte>( first + step * static_cast<int>( i ) );
+		}
+
+		return bytes;
+	}
+
+	//=====================================================================
+	// Standard vectors
+	//=====================================================================
+
+	TEST( ChecksumTest, MatchesPublishedVectors )
+	{
+		EXPECT_EQ( crc32c( std::string_view{ "123456789" } ), 0xE3069283u );
+		EXPECT_EQ( crc32c( std::string_view{} ), 0x00000000u );
+
+		// RFC 3720, appendix B.4
+		EXPECT_EQ( crc32c( patternBytes<32>( 0x00, 0 ) ), 0x8A9136AAu );
+		EXPECT_EQ( crc32c( patternBytes<32>( 0xFF, 0 ) ), 0x62A8AB43u );
+		EXPECT_EQ( crc32c( patternBytes<32>( 0x00, 1 ) ), 0x46DD794Eu );
+		EXPECT_EQ( crc32c( patternBytes<32>( 0x1F, -1 ) ), 0x113FDB5Cu );
+	}
+
+	TEST( ChecksumTest, DiffersFromHashStringViewConventions )
+	{
+		// Same polynomial; hashStringView seeds with the FNV basis and skips the final XOR
+		constexpr std::string_view text{ "123456789" };
+		EXPECT_NE( crc32c( text ), nfx::core::hashing::hashStringView( text ) );
+		EXPECT_EQ( crc32c( text ), nfx::core::hashing::hashStringView<0xFFFFFFFF>( text ) ^ 0xFFFFFFFFu );
+	}
+
+	//=====================================================================
+	// Kernels
+	//=====================================================================
+
+	TEST( ChecksumTest, EveryKernelMatchesReference )
+	{
+		const auto data = randomBytes( 3 * 4 * constants::CRC32C_STREAM_BLOCK + 300, 7 );
+		const size_t lengths[]{ 0, 1, 7, 8, 9, 15, 16, 63, 64, 255, 1000, 1535, 1536, 1537, 3072, 4096, 6143, 6144, 6145 };
+
+		for ( const size_t offset : { 0u, 1u, 3u, 7u } )
+		{
+			for ( const size_t length : lengths )
+			{
+				const std::span<const std::byte> piece{ data.data() + offset, length };
+				const uint32_t expected = referenceCrc32c( piece ) ^ 0xFFFFFFFF; // raw register
+				const uint32_t initial = 0xFFFFFFFF;
+
+				EXPECT_EQ( detail::crc32cSoftware( initial, piece.data(), piece.size() ), expected ) << length << " @" << offset;
+#if defined( __x86_64__ ) || defined( _M_X64 )
+				if ( nfx::core::cpu::hasSSE42Support() )
+				{
+					EXPECT_EQ( detail::crc32cHardware( initial, piece.data(), piece.size() ), expected ) << length;
+					EXPECT_EQ( detail::crc32cHardwareInterleaved<2>( initial, piece.data(), piece.size() ), expected ) << length;
+					EXPECT_EQ( detail::crc32cHardwareInterleaved<3>( initial, piece.data(), piece.size() ), expected ) << length;
+					EXPECT_EQ( detail::crc32cHardwareInterleaved<4>( initial, piece.data(), piece.size() ), expected ) << length;
+				}
+#endif
+				EXPECT_EQ( crc32c( piece ), expected ^ 0xFFFFFFFF ) << length;
+			}
+		}
+	}
+
+	TEST( ChecksumTest, DispatchesToBestSupportedKernel )
+	{
+		const std::string_view name = crc32cImplementation();
+#if defined( __x86_64__ ) || defined( _M_X64 )
+		EXPECT_EQ( name, nfx::core::cpu::hasSSE42Support() ? "sse42" : "software" );
+#else
+		EXPECT_EQ( name, "software" );
+#endif
+
+		// Pinning the software tier changes the kernel, not the result
+		const auto data = randomBytes( 10000, 11 );
+		const uint32_t best = crc32c( data );
+		detail::g_crc32c.resolve( nfx::core::cpu::Feature::None );
+		EXPECT_EQ( crc32cImplementation(), "software" );
+		EXPECT_EQ( crc32c( data ), best );
+		detail::g_crc32c.reset();
+	}
+
+	//=====================================================================
+	// Extension and combination
+	//=====================================================================
+
+	TEST( ChecksumTest, ExtendsAcrossPieces )
+	{
+		const auto data = randomBytes( 5000, 3 );
+		const std::span<const std::byte> all{ data };
+
+		uint32_t crc = 0;
+		for ( size_t offset = 0; offset < data.size(); offset += 777 )
+		{
+			crc = crc32cExtend( crc, all.subspan( offset, std::min<size_t>( 777, data.size() - offset ) ) );
+		}
+
+		EXPECT_EQ( crc, crc32c( all ) );
+		EXPECT_EQ( crc32cExtend( 0, all ), crc32c( all ) );
+	}
+
+	TEST( ChecksumTest, CombinesIndependentPieces )
+	{
+		const auto data = randomBytes( 20000, 5 );
+		const std::span<const std::byte> all{ data };
+
+		for ( const size_t split : { 0u, 1u, 8u, 100u, 4096u, 19999u, 20000u } )
+		{
+			const uint32_t a = crc32c( all.first( split ) );
+			const uint32_t b = crc32c( all.subspan( split ) );
+			EXPECT_EQ( crc32cCombine( a, b, data.size() - split ), crc32c( all ) ) << split;
+		}
+	}
+
+	//=====================================================================
+	// Blocks with a trailing CRC
+	//=====================================================================
+
+	TEST( ChecksumTest, StoresAndVerifiesInPlace )
+	{
+		auto block = randomBytes( 4096, 9 );
+		const uint32_t stored = storeCrc32c( block );
+
+		EXPECT_EQ( stored, crc32c( std::span<const std::byte>{ block }.first( 4092 ) ) );
+		EXPECT_EQ( block[4092], static_cast<std::byte>( stored & 0xFF ) );
+		EXPECT_EQ( block[4095], static_cast<std::byte>( stored >> 24 ) );
+		EXPECT_TRUE( verifyCrc32c( block ) );
+		EXPECT_TRUE( verifyCrc32c( std::span<const std::byte>{ block }.first( 4092 ), stored ) );
+
+		// Any single flipped bit, in the payload or in the stored CRC, is detected
+		for ( const size_t position : { 0u, 1000u, 4091u, 4092u, 4095u } )
+		{
+			block[position] ^= std::byte{ 0x10 };
+			EXPECT_FALSE( verifyCrc32c( block ) ) << position;
+			block[position] ^= std::byte{ 0x10 };
+		}
+		EXPECT_TRUE( verifyCrc32c( block ) );
+	}
+
+	TEST( ChecksumTest, ShortBlocks )
+	{
+		std::array<std::byte, 3> tiny{};
+		EXPECT_EQ( storeCrc32c( tiny ), 0u );
+		EXPECT_FALSE( verifyCrc32c( tiny ) );
+
+		// An empty payload stores CRC 0
+		std::array<std::byte, 4> empty{ std::byte{ 0xAA }, std::byte{ 0xAA }, std::byte{ 0xAA }, std::byte{ 0xAA } };
+		EXPECT_EQ( storeCrc32c( empty ), 0u );
+		EXPECT_TRUE( verifyCrc32c( empty ) );
+	}
+} // namespace nfx::core::checksum::test
@@ -0,0 +1,185 @@
+/**
+ * @file TESTS_ConsistentHashing.cpp
+ * @brief Tests for consistent hashing shard routing
+ * @details Tests covering jump consistent hash reference values, minimal key movement,
+ *          balance, weighted rendezvous hashing and batch routing
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <nfx/core/ConsistentHashing.h>
+#include <nfx/core/Hashing.h>
+
+namespace nfx::core::hashing::test
+{
+	using namespace nfx::core::hashing;
+
+	//=====================================================================
+	// Test helpers
+	//=====================================================================
+
+	static std::vector<uint64_t> makeKeyHashes( uint64_t count )
+	{
+		std::vector<uint64_t> hashes;
+		hashes.reserve( count );
+		for ( uint64_t i = 0; i < count; ++i )
+		{
+			hashes.push_back( hashInteger( i ) );
+		}
+
+		return hashes;
+	}
+
+	//=====================================================================
+	// Jump consistent hash
+	//=====================================================================
+
+	TEST( JumpConsistentHash, ReferenceValues )
+	{
+		// Values from the reference implementation in Lamping & Veach (2014)
+		EXPECT_EQ( jumpConsistentHash( 0, 1 ), 0u );
+		EXPECT_EQ( jumpConsistentHash( 1, 10 ), 6u );
+		EXPECT_EQ( jumpConsistentHash( 0xDEADBEEF, 100 ), 87u );
+		EXPECT_EQ( jumpConsistentHash( 123456789, 1000 ), 294u );
+		EXPECT_EQ( jumpConsistentHash( 0xFFFFFFFFFFFFFFFFULL, 7 ), 2u );
+
+		static_assert( jumpConsistentHash( 1, 10 ) == 6u );
+	}
+
+	TEST( JumpConsistentHash, ZeroBuckets )
+	{
+		EXPECT_EQ( jumpConsistentHash( 12345, 0 ), 0u );
+	}
+
+	TEST( JumpConsistentHash, GrowingMovesOnlyToNewBucket )
+	{
+		const auto hashes = makeKeyHashes( 100000 );
+
+		size_t moved = 0;
+		for ( const uint64_t hash : hashes )
+		{
+			const uint32_t before = jumpConsistentHash( hash, 10 );
+			const uint32_t after = jumpConsistentHash( hash, 11 );
+			if ( before != after )
+			{
+				EXPECT_EQ( after, 10u );
+				++moved;
+			}
+		}
+
+		// Expected fraction 1/11 ~ 9.1%
+		const double fraction = static_cast<double>( moved ) / static_cast<double>( hashes.size() );
+		EXPECT_NEAR( fraction, 1.0 / 11.0, 0.01 );
+	}
+
+	TEST( JumpConsistentHash, Balanced )
+	{
+		const auto hashes = makeKeyHashes( 100000 );
+		std::vector<size_t> load( 16, 0 );
+		for ( const uint64_t hash : hashes )
+		{
+			++load[jumpConsistentHash( hash, 16 )];
+		}
+
+		for ( const size_t count : load )
+		{
+			EXPECT_NEAR( static_cast<double>( count ), 100000.0 / 16.0, 100000.0 / 16.0 * 0.1 );
+		}
+	}
+
+	TEST( JumpConsistentHash, BatchMatchesSingle )
+	{
+		const auto hashes = makeKeyHashes( 1001 );
+		std::vector<uint32_t> shards( hashes.size() );
+
+		jumpConsistentHash( hashes, 37, shards );
+
+		for ( size_t i = 0; i < hashes.size(); ++i )
+		{
+			EXPECT_EQ( shards[i], jumpConsistentHash( hashes[i], 37 ) );
+		}
+	}
+
+	//=====================================================================
+	// Rendezvous hashing
+	//=====================================================================
+
+	TEST( RendezvousHash, EmptyNodes )
+	{
+		EXPECT_EQ( rendezvousHash( 42, std::span<const RendezvousNode>{} ), 0u );
+		EXPECT_EQ( rendezvousHash( 42, std::span<const uint64_t>{} ), 0u );
+	}
+
+	TEST( RendezvousHash, RemovingNodeMovesOnlyItsKeys )
+	{
+		std::vector<RendezvousNode> nodes;
+		for ( uint64_t n = 0; n < 8; ++n )
+		{
+			nodes.push_back( { hashStringView( "node-" + std::to_string( n ) ), 1.0 } );
+		}
+
+		std::vector<RendezvousNode> reduced{ nodes };
+		reduced.erase( reduced.begin() + 3 );
+
+		for ( const uint64_t hash : makeKeyHashes( 20000 ) )
+		{
+			const size_t before = rendezvousHash( hash, nodes );
+			const size_t after = rendezvousHash( hash, reduced );
+
+			if ( before != 3 )
+			{
+				// Same node, shifted index after erasing node 3
+				EXPECT_EQ( reduced[after].id, nodes[before].id );
+			}
+		}
+	}
+
+	TEST( RendezvousHash, WeightsControlShare )
+	{
+		const std::vector<RendezvousNode> nodes{ { 0x1111, 1.0 }, { 0x2222, 2.0 }, { 0x3333, 1.0 } };
+		std::vector<size_t> load( nodes.size(), 0 );
+
+		const auto hashes = makeKeyHashes( 100000 );
+		for ( const uint64_t hash : hashes )
+		{
+			++load[rendezvousHash( hash, nodes )];
+		}
+
+		EXPECT_NEAR( static_cast<double>( load[0] ) / 100000.0, 0.25, 0.02 );
+		EXPECT_NEAR( static_cast<double>( load[1] ) / 100000.0, 0.50, 0.02 );
+		EXPECT_NEAR( static_cast<double>( load[2] ) / 100000.0, 0.25, 0.02 );
+	}
+
+	TEST( RendezvousHash, UnweightedBalanced )
+	{
+		const std::vector<uint64_t> ids{ 11, 22, 33, 44 };
+		std::vector<size_t> load( ids.size(), 0 );
+		for ( const uint64_t hash : makeKeyHashes( 40000 ) )
+		{
+			++load[rendezvousHash( hash, ids )];
+		}
+
+		for ( const size_t count : load )
+		{
+			EXPECT_NEAR( static_cast<double>( count ), 10000.0, 1000.0 );
+		}
+	}
+
+	TEST( RendezvousHash, BatchMatchesSingle )
+	{
+		const std::vector<RendezvousNode> nodes{ { 0xA, 1.0 }, { 0xB, 0.5 }, { 0xC, 3.0 }, { 0xD, 1.5 }, { 0xE, 1.0 } };
+		const auto hashes = makeKeyHashes( 1000 );
+		std::vector<size_t> selected( hashes.size() );
+
+		rendezvousHash( hashes, nodes, selected );
+
+		for ( size_t i = 0; i < hashes.size(); ++i )
+		{
+			EXPECT_EQ( selected[i], rendezvousHash( hashes[i], nodes ) );
+		}
+	}
+} // namespace nfx::core::hashing::test
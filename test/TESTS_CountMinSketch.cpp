@@ -0,0 +1,254 @@
+/**
+ * @file TESTS_CountMinSketch.cpp
+ * @brief Tests for the Count-Min sketch and space-saving top-k tracker
+ * @details Tests covering conservative update bounds, batch updates, merging and
+ *          heavy-hitter detection
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <nfx/core/CountMinSketch.h>
+#include <nfx/core/Hashing.h>
+
+namespace nfx::core::sketch::test
+{
+	using namespace nfx::core::sketch;
+
+	//=====================================================================
+	// Test helpers
+	//=====================================================================
+
+	/** @brief Skewed stream: key k appears (100 / (k + 1)) + 1 times. */
+	static std::vector<uint64_t> makeSkewedStream( uint64_t keys )
+	{
+		std::vector<uint64_t> stream;
+		for ( uint64_t k = 0; k < keys; ++k )
+		{
+			const uint64_t occurrences = 100 / ( k + 1 ) + 1;
+			for ( uint64_t n = 0; n < occurrences; ++n )
+			{
+				stream.push_back( k );
+			}
+		}
+
+		return stream;
+	}
+
+	//=====================================================================
+	// Count-Min sketch
+	//=====================================================================
+
+	TEST( CountMinSketchBasic, WidthRoundedToPowerOfTwo )
+	{
+		CountMinSketch<> cms{ 1000 };
+		EXPECT_EQ( cms.width(), 1024u );
+		EXPECT_EQ( cms.depth(), 4u );
+
+		const auto sized = CountMinSketch<>::fromErrorRate( 0.001 );
+		EXPECT_GE( sized.width(), 2719u );
+	}
+
+	TEST( CountMinSketchBasic, RejectsInvalidErrorRate )
+	{
+		EXPECT_THROW( static_cast<void>( CountMinSketch<>::fromErrorRate( 0.0 ) ), std::invalid_argument );
+		EXPECT_THROW( static_cast<void>( CountMinSketch<>::fromErrorRate( -0.01 ) ), std::invalid_argument );
+		EXPECT_THROW( static_cast<void>( CountMinSketch<>::fromErrorRate( std::numeric_limits<double>::quiet_NaN() ) ), std::invalid_argument );
+		EXPECT_THROW( static_cast<void>( CountMinSketch<>::fromErrorRate( std::numeric_limits<double>::infinity() ) ), std::invalid_argument );
+
+		// Very loose bounds still get the minimum width
+		EXPECT_EQ( CountMinSketch<>::fromErrorRate( 1e300 ).width(), 16u );
+	}
+
+	TEST( CountMinSketchBasic, ExactWithoutCollisions )
+	{
+		CountMinSketch<> cms{ 1 << 16 };
+
+		for ( int i = 0; i < 5; ++i )
+		{
+			cms.add( hashing::hashInteger( uint64_t{ 7 } ) );
+		}
+		EXPECT_EQ( cms.add( hashing::hashInteger( uint64_t{ 9 } ), 3 ), 3u );
+
+		EXPECT_EQ( cms.estimate( hashing::hashInteger( uint64_t{ 7 } ) ), 5u );
+		EXPECT_EQ( cms.estimate( hashing::hashInteger( uint64_t{ 9 } ) ), 3u );
+		EXPECT_EQ( cms.estimate( hashing::hashInteger( uint64_t{ 11 } ) ), 0u );
+		EXPECT_EQ( cms.totalCount(), 8u );
+	}
+
+	TEST( CountMinSketchBasic, NeverUndercounts )
+	{
+		// Narrow sketch forces collisions
+		CountMinSketch<> cms{ 64 };
+		std::unordered_map<uint64_t, uint32_t> exact;
+
+		for ( const uint64_t key : makeSkewedStream( 2000 ) )
+		{
+			cms.add( hashing::hashInteger( key ) );
+			++exact[key];
+		}
+
+		for ( const auto& [key, count] : exact )
+		{
+			EXPECT_GE( cms.estimate( hashing::hashInteger( key ) ), count );
+		}
+	}
+
+	TEST( CountMinSketchBasic, StringKeys )
+	{
+		CountMinSketch<> cms{ 4096 };
+		cms.add( hashing::hashStringView( "hot_key" ), 100 );
+		cms.add( hashing::hashStringView( "cold_key" ) );
+
+		EXPECT_EQ( cms.estimate( hashing::hashStringView( "hot_key" ) ), 100u );
+		EXPECT_EQ( cms.estimate( hashing::hashStringView( "cold_key" ) ), 1u );
+	}
+
+	TEST( CountMinSketchBatch, BatchMatchesSingleUpdates )
+	{
+		std::vector<uint64_t> hashes;
+		for ( const uint64_t key : makeSkewedStream( 500 ) )
+		{
+			hashes.push_back( hashing::hashInteger( key ) );
+		}
+
+		CountMinSketch<> single{ 256 };
+		for ( const uint64_t hash : hashes )
+		{
+			single.add( hash );
+		}
+
+		CountMinSketch<> batch{ 256 };
+		batch.add( hashes );
+
+		EXPECT_EQ( batch.totalCount(), single.totalCount() );
+		for ( uint64_t key = 0; key < 500; ++key )
+		{
+			EXPECT_EQ( batch.estimate( hashing::hashInteger( key ) ), single.estimate( hashing::hashInteger( key ) ) );
+		}
+	}
+
+	TEST( CountMinSketchMerge, PerThreadSketchesMerge )
+	{
+		CountMinSketch<> a{ 1024 };
+		CountMinSketch<> b{ 1024 };
+		std::unordered_map<uint64_t, uint32_t> exact;
+
+		const auto stream = makeSkewedStream( 300 );
+		for ( size_t i = 0; i < stream.size(); ++i )
+		{
+			( i % 2 == 0 ? a : b ).add( hashing::hashInteger( stream[i] ) );
+			++exact[stream[i]];
+		}
+
+		ASSERT_TRUE( a.merge( b ) );
+		EXPECT_EQ( a.totalCount(), stream.size() );
+		for ( const auto& [key, count] : exact )
+		{
+			EXPECT_GE( a.estimate( hashing::hashInteger( key ) ), count );
+		}
+	}
+
+	TEST( CountMinSketchMerge, RejectsDifferentWidth )
+	{
+		CountMinSketch<> a{ 1024 };
+		CountMinSketch<> b{ 2048 };
+		b.add( 1 );
+
+		EXPECT_FALSE( a.merge( b ) );
+		EXPECT_EQ( a.totalCount(), 0u );
+	}
+
+	//=====================================================================
+	// Top-k tracker
+	//=====================================================================
+
+	TEST( TopKBasic, SpaceSavingFindsHeavyHitters )
+	{
+		// Keys 0..2 occur 300, 200 and 150 times among 1000 singletons, interleaved
+		std::vector<uint64_t> stream;
+		for ( uint64_t i = 0; i < 1000; ++i )
+		{
+			stream.push_back( 1000 + i );
+			if ( i < 300 )
+			{
+				stream.push_back( 0 );
+			}
+			if ( i < 200 )
+			{
+				stream.push_back( 1 );
+			}
+			if ( i < 150 )
+			{
+				stream.push_back( 2 );
+			}
+		}
+
+		TopK<uint64_t> topK{ 20 };
+		for ( const uint64_t key : stream )
+		{
+			topK.add( key );
+		}
+
+		// Total weight 1650 / capacity 20 = 82.5: every key above that must be tracked
+		EXPECT_EQ( topK.size(), 20u );
+		EXPECT_TRUE( topK.contains( 0 ) );
+		EXPECT_TRUE( topK.contains( 1 ) );
+		EXPECT_TRUE( topK.contains( 2 ) );
+
+		const auto entries = topK.entries();
+		ASSERT_FALSE( entries.empty() );
+		EXPECT_EQ( entries.front().key, 0u );
+		EXPECT_GE( entries.front().count, 300u );
+		EXPECT_LE( entries.front().count - entries.front().error, 300u );
+	}
+
+	TEST( TopKBasic, OfferWithCountMinEstimates )
+	{
+		CountMinSketch<> cms{ 4096 };
+		TopK<std::string> topK{ 3 };
+
+		const std::vector<std::pair<std::string, int>> traffic{ { "a", 50 }, { "b", 5 }, { "c", 40 }, { "d", 1 }, { "e", 30 } };
+		for ( const auto& [key, count] : traffic )
+		{
+			for ( int i = 0; i < count; ++i )
+			{
+				topK.offer( key, cms.add( hashing::hashStringView( key ) ) );
+			}
+		}
+
+		const auto entries = topK.entries();
+		ASSERT_EQ( entries.size(), 3u );
+		EXPECT_EQ( entries[0].key, "a" );
+		EXPECT_EQ( entries[1].key, "c" );
+		EXPECT_EQ( entries[2].key, "e" );
+		EXPECT_EQ( entries[0].count, 50u );
+	}
+
+	TEST( TopKMerge, MergeKeepsHeaviest )
+	{
+		TopK<uint64_t> a{ 4 };
+		TopK<uint64_t> b{ 4 };
+
+		a.add( 1, 100 );
+		a.add( 2, 10 );
+		b.add( 1, 50 );
+		b.add( 3, 80 );
+		b.add( 4, 5 );
+
+		a.merge( b );
+
+		const auto entries = a.entries();
+		ASSERT_EQ( entries.size(), 4u );
+		EXPECT_EQ( entries[0].key, 1u );
+		EXPECT_EQ( entries[0].count, 150u );
+		EXPECT_EQ( entries[1].key, 3u );
+		EXPECT_EQ( entries[1].count, 80u );
+	}
+} // namespace nfx::core::sketch::test
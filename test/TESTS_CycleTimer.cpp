@@ -0,0 +1,104 @@
+/**
+ * @file TESTS_CycleTimer.cpp
+ * @brief Tests for cycle-counter timing
+ * @details Tests covering counter monotonicity, calibrated frequency, cycle to nanosecond
+ *          conversion against steady_clock and the CycleTimer stopwatch
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#include <nfx/core/CycleTimer.h>
+
+namespace nfx::core::cpu::test
+{
+	using namespace nfx::core::cpu;
+
+	//=====================================================================
+	// Counter reads
+	//=====================================================================
+
+	TEST( CycleTimer, ReadsAreMonotonic )
+	{
+		uint64_t previous = readCycles<TscRead::Begin>();
+		for ( int i = 0; i < 1000; ++i )
+		{
+			const uint64_t relaxed = readCycles();
+			const uint64_t begin = readCycles<TscRead::Begin>();
+			const uint64_t serialized = readCycles<TscRead::Serialized>();
+
+			EXPECT_GE( relaxed, previous );
+			EXPECT_GE( begin, relaxed );
+			EXPECT_GE( serialized, begin );
+			previous = serialized;
+
+			if ( tscInfo().rdtscp )
+			{
+				const uint64_t end = readCycles<TscRead::End>();
+				EXPECT_GE( end, previous );
+				previous = end;
+			}
+		}
+	}
+
+	//=====================================================================
+	// Counter properties
+	//=====================================================================
+
+	TEST( CycleTimer, FrequencyIsCalibrated )
+	{
+		const TscInfo& info = tscInfo();
+		EXPECT_EQ( &info, &tscInfo() );
+
+		// Generic timers run from ~1 MHz; TSCs below 10 GHz
+		EXPECT_GT( info.frequencyHz, 1e6 );
+		EXPECT_LT( info.frequencyHz, 1e10 );
+		EXPECT_DOUBLE_EQ( info.nanosecondsPerCycle * info.frequencyHz, 1e9 );
+		EXPECT_EQ( info.reliable(), info.invariant );
+
+		if ( info.hypervisor )
+		{
+			EXPECT_GT( std::strlen( info.hypervisorVendor ), 0u );
+		}
+		else
+		{
+			EXPECT_EQ( std::strlen( info.hypervisorVendor ), 0u );
+		}
+	}
+
+	TEST( CycleTimer, ConversionMatchesSteadyClock )
+	{
+		using Clock = std::chrono::steady_clock;
+
+		const Clock::time_point clockStart = Clock::now();
+		const uint64_t cyclesStart = readCycles<TscRead::Begin>();
+		std::this_thread::sleep_for( std::chrono::milliseconds{ 30 } );
+		const uint64_t cyclesEnd = readCycles<TscRead::Begin>();
+		const Clock::time_point clockEnd = Clock::now();
+
+		const double expected = std::chrono::duration<double, std::nano>( clockEnd - clockStart ).count();
+		const double measured = cyclesToNanoseconds( cyclesEnd - cyclesStart );
+
+		EXPECT_NEAR( measured, expected, expected * 0.1 );
+	}
+
+	//=====================================================================
+	// CycleTimer class
+	//=====================================================================
+
+	TEST( CycleTimer, StopwatchMeasuresSleep )
+	{
+		CycleTimer timer;
+		std::this_thread::sleep_for( std::chrono::milliseconds{ 10 } );
+
+		const double elapsed = timer.elapsedNanoseconds();
+		EXPECT_GE( elapsed, 9e6 );
+		EXPECT_LT( elapsed, 1e9 );
+
+		timer.restart();
+		EXPECT_LT( timer.elapsedNanoseconds(), elapsed );
+	}
+} // namespace nfx::core::cpu::test
@@ -0,0 +1,252 @@
+/**
+ * @file TESTS_Dispatch.cpp
+ * @brief Tests for runtime function multiversioning
+ * @details Tests covering feature set operations, the dispatch mask and environment
+ *          override, tier selection, introspection and agreement between all tiers
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include <nfx/core/Dispatch.h>
+
+namespace nfx::core::cpu::test
+{
+	using namespace nfx::core::cpu;
+
+	//=====================================================================
+	// Test kernels
+	//=====================================================================
+
+	using SumSignature = uint64_t( std::span<const uint8_t> );
+
+	static uint64_t sumScalar( std::span<const uint8_t> bytes )
+	{
+		uint64_t total{ 0 };
+		for ( const uint8_t b : bytes )
+		{
+			total += b;
+		}
+
+		return total;
+	}
+
+	NFX_CORE_TARGET( "avx2" )
+	static uint64_t sumAvx2( std::span<const uint8_t> bytes )
+	{
+		uint64_t total{ 0 };
+		for ( const uint8_t b : bytes )
+		{
+			total += b;
+		}
+
+		return total;
+	}
+
+	NFX_CORE_TARGET( "avx512f,avx512bw" )
+	static uint64_t sumAvx512( std::span<const uint8_t> bytes )
+	{
+		uint64_t total{ 0 };
+		for ( const uint8_t b : bytes )
+		{
+			total += b;
+		}
+
+		return total;
+	}
+
+	static constinit auto s_sum = makeDispatcher<SumSignature>(
+		DispatchCandidate<SumSignature>{ "avx512", Feature::AVX512F | Feature::AVX512BW | Feature::FastAvx512, &sumAvx512 },
+		DispatchCandidate<SumSignature>{ "avx2", Feature::AVX2, &sumAvx2 },
+		DispatchCandidate<SumSignature>{ "scalar", Feature::None, &sumScalar } );
+
+	/** @brief Restores the default mask and selection after each test. */
+	class DispatchTest : public ::testing::Test
+	{
+	protected:
+		void TearDown() override
+		{
+			setDispatchMask( Feature::All );
+			s_sum.reset();
+		}
+	};
+
+	//=====================================================================
+	// Feature sets
+	//=====================================================================
+
+	TEST( DispatchFeatures, SetOperations )
+	{
+		constexpr Feature set = Feature::AVX | Feature::AVX2;
+
+		static_assert( hasAll( set, Feature::AVX2 ) );
+		static_assert( !hasAll( set, Feature::AVX512F ) );
+		static_assert( hasAll( set, Feature::None ) );
+		static_assert( ( ~Feature::None ) == Feature::All );
+		static_assert( ( set & ~Feature::AVX2 ) == Feature::AVX );
+		static_assert( featureName( Feature::AVX512BW ) == "avx512bw" );
+		static_assert( featureName( set ).empty() );
+
+		EXPECT_TRUE( hasAll( Feature::All, set ) );
+	}
+
+	TEST( DispatchFeatures, ParseFeatureList )
+	{
+		EXPECT_EQ( parseFeatureList( "" ), Feature::None );
+		EXPECT_EQ( parseFeatureList( "avx2" ), Feature::AVX2 );
+		EXPECT_EQ( parseFeatureList( "avx2, avx512f ,sse42" ), Feature::AVX2 | Feature::AVX512F | Feature::SSE42 );
+		EXPECT_EQ( parseFeatureList( "bogus,popcnt" ), Feature::POPCNT );
+		EXPECT_EQ( parseFeatureList( "fast_avx512" ), Feature::FastAvx512 );
+		EXPECT_EQ( parseFeatureList( "sha,all" ), Feature::All );
+	}
+
+	TEST( DispatchFeatures, MatchesSnapshot )
+	{
+		const Feature detected = toFeatureSet( features() );
+		EXPECT_EQ( hasAll( detected, Feature::SSE42 ), features().sse42 );
+		EXPECT_EQ( hasAll( detected, Feature::AVX2 ), features().avx2 );
+		EXPECT_EQ( hasAll( detected, Feature::AVX512BW ), features().avx512bw );
+
+		// Without a mask or environment override nothing is removed
+		EXPECT_EQ( dispatchFeatures(), detail::closeDependencies( detected | toFeatureSet( tuning() ) ) );
+		EXPECT_EQ( hasAll( dispatchFeatures(), Feature::FastAvx512 ), tuning().preferAvx512 );
+		EXPECT_EQ( hasAll( dispatchFeatures(), Feature::FastPdepPext ), tuning().fastPdepPext );
+	}
+
+	TEST( DispatchFeatures, DependenciesAreDropped )
+	{
+		const Feature closed = detail::closeDependencies( Feature::All & ~Feature::AVX );
+
+		EXPECT_FALSE( hasAll( closed, Feature::AVX2 ) );
+		EXPECT_FALSE( hasAll( closed, Feature::FMA ) );
+		EXPECT_FALSE( hasAll( closed, Feature::AVX512F ) );
+		EXPECT_FALSE( hasAll( closed, Feature::AVX512VL ) );
+		EXPECT_FALSE( hasAll( closed, Feature::FastAvx512 ) );
+		EXPECT_FALSE( hasAll( detail::closeDependencies( Feature::All & ~Feature::BMI2 ), Feature::FastPdepPext ) );
+		EXPECT_TRUE( hasAll( closed, Feature::SSE42 | Feature::BMI2 ) );
+	}
+
+	//=====================================================================
+	// Selection
+	//=====================================================================
+
+	TEST_F( DispatchTest, SelectsBestSupportedTier )
+	{
+		const Feature available = dispatchFeatures();
+		const char* expected = hasAll( available, Feature::AVX512F | Feature::AVX512BW | Feature::FastAvx512 ) ? "avx512"
+							   : hasAll( available, Feature::AVX2 )						? "avx2"
+																						: "scalar";
+
+		EXPECT_EQ( s_sum.selectedName(), expected );
+	}
+
+	TEST_F( DispatchTest, ExplicitFeatureSetForcesLowerTiers )
+	{
+		s_sum.resolve( Feature::AVX | Feature::AVX2 );
+		EXPECT_EQ( s_sum.selectedName(), "avx2" );
+
+		s_sum.resolve( Feature::None );
+		EXPECT_EQ( s_sum.selectedName(), "scalar" );
+	}
+
+	TEST( DispatchDeathTest, LastCandidateMustRequireNone )
+	{
+		const std::array<DispatchCandidate<SumSignature>, 1> candidates{ DispatchCandidate<SumSignature>{ "avx2", Feature::AVX2, &sumAvx2 } };
+		using SingleDispatcher = Dispatcher<SumSignature, 1>;
+		EXPECT_DEATH( { SingleDispatcher dispatcher{ candidates }; }, "does not require Feature::None" );
+	}
+
+	TEST_F( DispatchTest, DispatchMaskForcesBaseline )
+	{
+		setDispatchMask( Feature::SSE42 | Feature::POPCNT );
+		s_sum.reset();
+
+		EXPECT_FALSE( hasAll( dispatchFeatures(), Feature::AVX2 ) );
+		EXPECT_EQ( s_sum.selectedName(), "scalar" );
+	}
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+	TEST_F( DispatchTest, EnvironmentDisablesFeatures )
+	{
+		::setenv( constants::DISPATCH_DISABLE_ENV, "avx2", 1 );
+		s_sum.reset();
+
+		EXPECT_FALSE( hasAll( dispatchFeatures(), Feature::AVX2 ) );
+		EXPECT_FALSE( hasAll( dispatchFeatures(), Feature::AVX512F ) );
+		EXPECT_EQ( s_sum.selectedName(), "scalar" );
+
+		::unsetenv( constants::DISPATCH_DISABLE_ENV );
+	}
+#endif
+
+	//=====================================================================
+	// Build configuration report
+	//=====================================================================
+
+	TEST( DispatchBuildReportTest, CompiledFeaturesMatchPredefinedMacros )
+	{
+		constexpr Feature compiled = NFX_CORE_COMPILED_FEATURES;
+
+#if defined( __SSE4_2__ )
+		EXPECT_TRUE( hasAll( compiled, Feature::SSE42 ) );
+#endif
+		EXPECT_EQ( hasAll( compiled, Feature::AVX2 ), NFX_CORE_BUILD_AVX2 != 0 );
+		EXPECT_EQ( hasAll( compiled, Feature::AVX512F ), NFX_CORE_BUILD_AVX512F != 0 );
+		EXPECT_FALSE( hasAll( compiled, Feature::FastPdepPext ) );
+	}
+
+	TEST( DispatchBuildReportTest, MissedAndUnsupportedPartitionTheDifference )
+	{
+		const auto report = buildReport( Feature::SSE42 | Feature::FastAvx512 | Feature::All );
+		EXPECT_EQ( report.detected, toFeatureSet( features() ) );
+		EXPECT_EQ( report.missed, Feature::None );
+		EXPECT_EQ( report.unsupported, report.compiled & ~report.detected );
+		EXPECT_FALSE( hasAll( report.compiled, Feature::FastAvx512 ) );
+
+		const auto none = buildReport( Feature::None );
+		EXPECT_EQ( none.missed, none.detected );
+		EXPECT_EQ( none.unsupported, Feature::None );
+		EXPECT_EQ( none.matchesHost(), none.detected == Feature::None );
+
+		const auto exact = buildReport( toFeatureSet( features() ) );
+		EXPECT_TRUE( exact.matchesHost() );
+		EXPECT_FALSE( warnMissedFeatures( toFeatureSet( features() ), stderr ) );
+	}
+
+	TEST( DispatchBuildReportTest, DescribeFeatures )
+	{
+		EXPECT_EQ( describeFeatures( Feature::None ), "none" );
+		EXPECT_EQ( describeFeatures( Feature::SSE42 | Feature::AVX2 ), "sse42, avx2" );
+		EXPECT_EQ( describeFeatures( Feature::AVX512BW | Feature::FastPdepPext ), "avx512bw, fast_pdep" );
+	}
+
+	//=====================================================================
+	// Tier agreement
+	//=====================================================================
+
+	TEST_F( DispatchTest, AllSupportedTiersAgree )
+	{
+		std::vector<uint8_t> bytes( 4099 );
+		std::iota( bytes.begin(), bytes.end(), uint8_t{ 7 } );
+		const uint64_t expected = sumScalar( bytes );
+
+		const Feature available = dispatchFeatures();
+		for ( const auto& candidate : s_sum.candidates() )
+		{
+			if ( !hasAll( available, candidate.required ) )
+			{
+				continue;
+			}
+
+			s_sum.resolve( candidate.required );
+			EXPECT_EQ( s_sum.selectedName(), candidate.name );
+			EXPECT_EQ( s_sum( bytes ), expected ) << candidate.name;
+		}
+	}
+} // namespace nfx::core::cpu::test
@@ -0,0 +1,165 @@
+/**
+ * @file TESTS_HashedString.cpp
+ * @brief Tests for pre-hashed strings
+ * @details Tests eager, precomputed and deferred hashing, equality, the no-rehash overloads
+ *          of hashStringView / seedMix / LookupHash and heterogeneous container lookup
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <nfx/core/BatchLookup.h>
+#include <nfx/core/HashedString.h>
+#include <nfx/core/Hashing.h>
+
+namespace nfx::core::hashing::test
+{
+	using namespace nfx::core::hashing;
+
+	//=====================================================================
+	// HashedStringView
+	//=====================================================================
+
+	TEST( HashedStringTest, ViewHashesEagerly )
+	{
+		const std::string text{ "tenant:42/orders" };
+		const HashedStringView key{ text };
+
+		EXPECT_TRUE( key.hasHash() );
+		EXPECT_EQ( key.hash(), hashStringView( std::string_view{ text } ) );
+		EXPECT_EQ( key.view(), text );
+		EXPECT_EQ( key.size(), text.size() );
+		EXPECT_EQ( HashedStringView{}.hash(), hashStringView( std::string_view{} ) );
+		EXPECT_TRUE( HashedStringView{}.empty() );
+	}
+
+	TEST( HashedStringTest, ViewHashesLazilyWhenDeferred )
+	{
+		const auto key = HashedStringView::deferred( "tenant:42/orders" );
+		EXPECT_FALSE( key.hasHash() );
+
+		const HashedStringView copy = key;
+		EXPECT_FALSE( copy.hasHash() );
+		EXPECT_EQ( copy.hash(), hashStringView( std::string_view{ "tenant:42/orders" } ) );
+		EXPECT_TRUE( copy.hasHash() );
+	}
+
+	TEST( HashedStringTest, PrecomputedHashIsTrusted )
+	{
+		const HashedStringView key{ "abc", 1234u };
+		EXPECT_EQ( key.hash(), 1234u );
+		EXPECT_EQ( hashStringView( key ), 1234u );
+	}
+
+	//=====================================================================
+	// Equality
+	//=====================================================================
+
+	TEST( HashedStringTest, EqualityComparesHashThenBytes )
+	{
+		const std::string a{ "session:1" };
+		const std::string b{ "session:1" };
+
+		EXPECT_EQ( HashedStringView{ a }, HashedStringView{ b } );
+		EXPECT_NE( HashedStringView{ a }, HashedStringView{ "session:2" } );
+		EXPECT_EQ( HashedStringView{ a }, HashedStringView::deferred( b ) );
+
+		// A wrong cached hash makes equal bytes compare unequal: the hash really is checked first
+		EXPECT_NE( HashedStringView{ a }, ( HashedStringView{ b, hashStringView( std::string_view{ b } ) ^ 1 } ) );
+
+		const HashedString owned{ a };
+		EXPECT_EQ( owned, HashedString{ "session:1" } );
+		EXPECT_EQ( owned, HashedStringView{ b } );
+		EXPECT_NE( owned, HashedStringView{ "session:10" } );
+	}
+
+	//=====================================================================
+	// HashedString
+	//=====================================================================
+
+	TEST( HashedStringTest, OwnedStringKeepsHash )
+	{
+		std::string text{ "a long key that does not fit the small string buffer" };
+		const HashedString owned{ text };
+		text.clear();
+
+		EXPECT_EQ( owned.str(), "a long key that does not fit the small string buffer" );
+		EXPECT_EQ( owned.hash(), hashStringView( owned.view() ) );
+
+		const HashedStringView view = owned;
+		EXPECT_EQ( view.hash(), owned.hash() );
+		EXPECT_EQ( view.view().data(), owned.str().data() );
+
+		const HashedString copy{ view };
+		EXPECT_EQ( copy.hash(), owned.hash() );
+		EXPECT_EQ( HashedString{}.hash(), hashStringView( std::string_view{} ) );
+	}
+
+	//=====================================================================
+	// Consumers
+	//=====================================================================
+
+	TEST( HashedStringTest, ConsumersUseCachedHash )
+	{
+		// A deliberately wrong cached hash shows which path each consumer takes
+		const HashedStringView key{ "user:7", 0xABCDu };
+
+		EXPECT_EQ( hashStringView( key ), 0xABCDu );
+		EXPECT_EQ( seedMix( 3, key, 1024 ), seedMix( 3, 0xABCDu, 1024 ) );
+		EXPECT_EQ( LookupHash{}( key ), 0xABCDu );
+		EXPECT_EQ( std::hash<HashedStringView>{}( key ), 0xABCDu );
+		EXPECT_EQ( HashedStringHash{}( key ), 0xABCDu );
+
+		// An explicit seed selects the template and rehashes the bytes
+		EXPECT_EQ( hashStringView<0>( key ), hashStringView<0>( std::string_view{ "user:7" } ) );
+	}
+
+	TEST( HashedStringTest, HeterogeneousContainerLookup )
+	{
+		std::unordered_map<HashedString, int, HashedStringHash, std::equal_to<>> map;
+		map.emplace( HashedString{ "alpha" }, 1 );
+		map.emplace( HashedString{ "beta" }, 2 );
+
+		const std::string probe{ "beta" };
+		const auto it = map.find( HashedStringView{ probe } );
+		ASSERT_NE( it, map.end() );
+		EXPECT_EQ( it->second, 2 );
+		EXPECT_EQ( map.find( HashedStringView{ "gamma" } ), map.end() );
+
+		std::unordered_set<HashedStringView> set{ "x", "y", "x" };
+		EXPECT_EQ( set.size(), 2u );
+	}
+
+	TEST( HashedStringTest, PlainStringComparisonSkipsHashing )
+	{
+		// A wrong cached hash shows that only lengths and bytes are compared
+		const HashedStringView wrongHash{ "order:17", 0 };
+		EXPECT_TRUE( wrongHash == std::string_view{ "order:17" } );
+		EXPECT_TRUE( std::string_view{ "order:17" } == wrongHash );
+		EXPECT_FALSE( wrongHash == std::string_view{ "order:18" } );
+		EXPECT_FALSE( wrongHash == std::string_view{ "order:1" } );
+
+		const HashedString owned{ "order:17" };
+		const std::string text{ "order:17" };
+		EXPECT_TRUE( owned == std::string_view{ "order:17" } );
+		EXPECT_TRUE( owned == text );
+		EXPECT_TRUE( owned == "order:17" );
+		EXPECT_TRUE( "order:17" == owned );
+		EXPECT_FALSE( owned == "order:170" );
+
+		// Pre-hashed operands still compare their hashes first
+		EXPECT_FALSE( owned == wrongHash );
+
+		// Heterogeneous lookup with a plain view hashes the probe once, in HashedStringHash
+		std::unordered_set<HashedString, HashedStringHash, std::equal_to<>> set;
+		set.emplace( "alpha" );
+		set.emplace( "beta" );
+		EXPECT_NE( set.find( std::string_view{ "beta" } ), set.end() );
+		EXPECT_EQ( set.find( std::string_view{ "gamma" } ), set.end() );
+	}
+} // namespace nfx::core::hashing::test
@@ -1,12 +1,15 @@
 /**
  * @file TESTS_Hashing.cpp
  * @brief Comprehensive tests for hashing algorithms
- * @details Tests covering FNV-1a, CRC32, Larson, integer hashing, hash combining, and seed mixing
+ * @details Tests covering FNV-1a, CRC32, Larson, wide string hashing, binary key hashing, integer hashing, hash combining, and seed mixing
  */
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_set>
@@ -132,6 +135,318 @@ namespace nfx::core::hashing::test
 		EXPECT_EQ( hashFromView, hashFromString );
 	}
 
+	//=====================================================================
+	// Wide string hashing
+	//=====================================================================
+
+	/** @brief Reference UTF-8 encoder; invalid code points become U+FFFD. */
+	static void appendUtf8( std::string& out, char32_t cp )
+	{
+		if ( cp > 0x10FFFF || ( cp >= 0xD800 && cp <= 0xDFFF ) )
+		{
+			cp = 0xFFFD;
+		}
+		if ( cp < 0x80 )
+		{
+			out += static_cast<char>( cp );
+		}
+		else if ( cp < 0x800 )
+		{
+			out += static_cast<char>( 0xC0 | ( cp >> 6 ) );
+			out += static_cast<char>( 0x80 | ( cp & 0x3F ) );
+		}
+		else if ( cp < 0x10000 )
+		{
+			out += static_cast<char>( 0xE0 | ( cp >> 12 ) );
+			out += static_cast<char>( 0x80 | ( ( cp >> 6 ) & 0x3F ) );
+			out += static_cast<char>( 0x80 | ( cp & 0x3F ) );
+		}
+		else
+		{
+			out += static_cast<char>( 0xF0 | ( cp >> 18 ) );
+			out += static_cast<char>( 0x80 | ( ( cp >> 12 ) & 0x3F ) );
+			out += static_cast<char>( 0x80 | ( ( cp >> 6 ) & 0x3F ) );
+			out += static_cast<char>( 0x80 | ( cp & 0x3F ) );
+		}
+	}
+
+	/** @brief Code points cycling through every UTF-8 length, with ASCII runs of varying length. */
+	static std::u32string mixedCodePoints( size_t length, size_t seed )
+	{
+		static constexpr char32_t samples[]{ U'k', U'é', U'€', U'東', U'😀', U'߿', U'￿', U'\U0010FFFF' };
+
+		std::u32string text;
+		for ( size_t i = 0; text.size() < length; ++i )
+		{
+			text.append( ( i * 7 + seed ) % 13, U'a' + static_cast<char32_t>( i % 26 ) );
+			text += samples[( i + seed ) % 8];
+		}
+		text.resize( length );
+
+		return text;
+	}
+
+	static std::u16string toUtf16( std::u32string_view text )
+	{
+		std::u16string out;
+		for ( const char32_t cp : text )
+		{
+			if ( cp >= 0x10000 )
+			{
+				out += static_cast<char16_t>( 0xD800 + ( ( cp - 0x10000 ) >> 10 ) );
+				out += static_cast<char16_t>( 0xDC00 + ( ( cp - 0x10000 ) & 0x3FF ) );
+			}
+			else
+			{
+				out += static_cast<char16_t>( cp );
+			}
+		}
+
+		return out;
+	}
+
+	static std::string toUtf8( std::u32string_view text )
+	{
+		std::string out;
+		for ( const char32_t cp : text )
+		{
+			appendUtf8( out, cp );
+		}
+
+		return out;
+	}
+
+	template <typename CharT>
+	static std::string_view bytesOf( std::basic_string_view<CharT> text )
+	{
+		return std::string_view{ reinterpret_cast<const char*>( text.data() ), text.size() * sizeof( CharT ) };
+	}
+
+	TEST( HashingWideString, EmptyViewsReturnInitialHash )
+	{
+		EXPECT_EQ( hashStringView( std::u16string_view{} ), DEFAULT_FNV_OFFSET_BASIS );
+		EXPECT_EQ( hashStringView( std::u32string_view{} ), DEFAULT_FNV_OFFSET_BASIS );
+		EXPECT_EQ( hashStringView<0x1234u>( std::wstring_view{} ), 0x1234u );
+		EXPECT_EQ( hashStringViewAsUtf8( std::u16string_view{} ), DEFAULT_FNV_OFFSET_BASIS );
+		EXPECT_EQ( hashStringViewAsUtf8<0x1234u>( std::u32string_view{} ), 0x1234u );
+	}
+
+	TEST( HashingWideString, RawBytesMatchesByteHash )
+	{
+		for ( size_t length = 0; length <= 40; ++length )
+		{
+			const std::u32string utf32 = mixedCodePoints( length, length );
+			const std::u16string utf16 = toUtf16( utf32 );
+			const std::wstring wide( utf32.begin(), utf32.end() );
+
+			const std::u16string_view view16{ utf16 };
+			const std::u32string_view view32{ utf32 };
+			const std::wstring_view viewWide{ wide };
+
+			EXPECT_EQ( hashStringView( view16 ), hashStringView( bytesOf( view16 ) ) ) << "length " << length;
+			EXPECT_EQ( hashStringView( view32 ), hashStringView( bytesOf( view32 ) ) ) << "length " << length;
+			EXPECT_EQ( hashStringView( viewWide ), hashStringView( bytesOf( viewWide ) ) ) << "length " << length;
+			EXPECT_EQ( hashStringView<0xFFFFFFFF>( view16 ), hashStringView<0xFFFFFFFF>( bytesOf( view16 ) ) ) << "length " << length;
+		}
+	}
+
+	TEST( HashingWideString, AsUtf8MatchesUtf8Hash )
+	{
+		for ( size_t seed = 0; seed < 4; ++seed )
+		{
+			for ( size_t length = 0; length <= 70; ++length )
+			{
+				const std::u32string utf32 = mixedCodePoints( length, seed );
+				const std::u16string utf16 = toUtf16( utf32 );
+				const uint32_t expected = hashStringView( toUtf8( utf32 ) );
+
+				EXPECT_EQ( hashStringViewAsUtf8( std::u32string_view{ utf32 } ), expected ) << "length " << length;
+				EXPECT_EQ( hashStringViewAsUtf8( std::u16string_view{ utf16 } ), expected ) << "length " << length;
+				if constexpr ( sizeof( wchar_t ) == 2 )
+				{
+					const std::wstring wide( utf16.begin(), utf16.end() );
+					EXPECT_EQ( hashStringViewAsUtf8( std::wstring_view{ wide } ), expected ) << "length " << length;
+				}
+				else
+				{
+					const std::wstring wide( utf32.begin(), utf32.end() );
+					EXPECT_EQ( hashStringViewAsUtf8( std::wstring_view{ wide } ), expected ) << "length " << length;
+				}
+			}
+		}
+	}
+
+	TEST( HashingWideString, AsUtf8MatchesLiterals )
+	{
+		const std::u8string_view utf8{ u8"Zürich → 東京 😀 and a long ASCII tail to take the packed path" };
+		const std::string_view bytes{ reinterpret_cast<const char*>( utf8.data() ), utf8.size() };
+
+		EXPECT_EQ( hashStringViewAsUtf8( u"Zürich → 東京 😀 and a long ASCII tail to take the packed path" ), hashStringView( bytes ) );
+		EXPECT_EQ( hashStringViewAsUtf8( U"Zürich → 東京 😀 and a long ASCII tail to take the packed path" ), hashStringView( bytes ) );
+		EXPECT_EQ( hashStringViewAsUtf8( L"Zürich → 東京 😀 and a long ASCII tail to take the packed path" ), hashStringView( bytes ) );
+		EXPECT_EQ( hashStringViewAsUtf8<0xFFFFFFFF>( u"plain ascii key" ), hashStringView<0xFFFFFFFF>( "plain ascii key" ) );
+	}
+
+	TEST( HashingWideString, InvalidSequencesHashAsReplacement )
+	{
+		// Lone high surrogate (mid-string and at the end), lone low surrogate, reversed pair
+		const std::u16string highMid{ u'a', char16_t( 0xD83D ), u'b' };
+		const std::u16string highEnd{ u'a', char16_t( 0xD83D ) };
+		const std::u16string low{ char16_t( 0xDE00 ), u'a' };
+		const std::u16string reversed{ char16_t( 0xDE00 ), char16_t( 0xD83D ) };
+
+		EXPECT_EQ( hashStringViewAsUtf8( std::u16string_view{ highMid } ), hashStringView( "a\xEF\xBF\xBD" "b" ) );
+		EXPECT_EQ( hashStringViewAsUtf8( std::u16string_view{ highEnd } ), hashStringView( "a\xEF\xBF\xBD" ) );
+		EXPECT_EQ( hashStringViewAsUtf8( std::u16string_view{ low } ), hashStringView( "\xEF\xBF\xBD" "a" ) );
+		EXPECT_EQ( hashStringViewAsUtf8( std::u16string_view{ reversed } ), hashStringView( "\xEF\xBF\xBD\xEF\xBF\xBD" ) );
+
+		// Surrogate code points and values beyond U+10FFFF in UTF-32
+		const std::u32string invalid{ char32_t( 0xD800 ), char32_t( 0x110000 ), char32_t( 0xFFFFFFFF ) };
+		EXPECT_EQ( hashStringViewAsUtf8( std::u32string_view{ invalid } ), hashStringView( "\xEF\xBF\xBD\xEF\xBF\xBD\xEF\xBF\xBD" ) );
+
+		// A surrogate pair split across the 8-unit ASCII block boundary still decodes
+		std::u16string straddle( 7, u'x' );
+		straddle += u"😀 tail of ascii text";
+		EXPECT_EQ( hashStringViewAsUtf8( std::u16string_view{ straddle } ), hashStringView( toUtf8( U"xxxxxxx😀 tail of ascii text" ) ) );
+	}
+
+	//=====================================================================
+	// Binary key hashing
+	//=====================================================================
+
+	struct Key4
+	{
+		uint32_t id;
+	};
+
+	struct Key12
+	{
+		uint32_t source;
+		uint32_t destination;
+		uint16_t sourcePort;
+		uint16_t destinationPort;
+	};
+
+	struct Key16
+	{
+		uint64_t tenant;
+		uint32_t table;
+		uint32_t row;
+	};
+
+	struct Key24
+	{
+		uint64_t a;
+		uint64_t b;
+		uint64_t c;
+	};
+
+	struct Key32
+	{
+		uint64_t high;
+		uint64_t low;
+		uint32_t version;
+		uint32_t shard;
+		uint64_t timestamp;
+	};
+
+	struct Padded
+	{
+		uint8_t tag;
+		uint32_t value;
+	};
+
+	template <typename T>
+	concept ObjectHashable = requires( const T& value ) { hashObject( value ); };
+
+	static_assert( ObjectHashable<uint64_t> );
+	static_assert( ObjectHashable<Key12> );
+	static_assert( ObjectHashable<Key32> );
+	static_assert( ObjectHashable<std::array<uint8_t, 3>> );
+	static_assert( !ObjectHashable<Padded> );
+	static_assert( !ObjectHashable<float> );
+	static_assert( !ObjectHashable<double> );
+
+	/** @brief Fills an object's bytes with a pattern derived from `seed`. */
+	template <typename T>
+	static T patterned( uint8_t seed )
+	{
+		T value;
+		auto bytes = std::as_writable_bytes( std::span{ &value, 1 } );
+		for ( size_t i = 0; i < bytes.size(); ++i )
+		{
+			bytes[i] = static_cast<std::byte>( seed + i * 37 );
+		}
+
+		return value;
+	}
+
+	template <typename T>
+	static void expectObjectMatchesBytes()
+	{
+		const T value = patterned<T>( static_cast<uint8_t>( sizeof( T ) ) );
+		const auto bytes = std::as_bytes( std::span{ &value, 1 } );
+
+		EXPECT_EQ( hashObject( value ), hashBytes( bytes ) ) << "size " << sizeof( T );
+		EXPECT_EQ( hashObject<0xFFFFFFFF>( value ), hashBytes<0xFFFFFFFF>( bytes ) ) << "size " << sizeof( T );
+
+		// Every byte contributes
+		for ( size_t i = 0; i < sizeof( T ); ++i )
+		{
+			T changed = value;
+			reinterpret_cast<std::byte*>( &changed )[i] ^= std::byte{ 0x01 };
+			EXPECT_NE( hashObject( changed ), hashObject( value ) ) << "size " << sizeof( T ) << ", byte " << i;
+		}
+	}
+
+	TEST( HashingBinaryKey, BytesMatchesStringView )
+	{
+		std::vector<std::byte> buffer( 80 );
+		for ( size_t i = 0; i < buffer.size(); ++i )
+		{
+			buffer[i] = static_cast<std::byte>( i * 131 + 7 );
+		}
+
+		EXPECT_EQ( hashBytes( {} ), DEFAULT_FNV_OFFSET_BASIS );
+		for ( size_t offset = 0; offset < 8; ++offset )
+		{
+			for ( size_t length = 0; length <= 64; ++length )
+			{
+				const std::span<const std::byte> bytes{ buffer.data() + offset, length };
+				const std::string_view text{ reinterpret_cast<const char*>( bytes.data() ), bytes.size() };
+				EXPECT_EQ( hashBytes( bytes ), hashStringView( text ) ) << "offset " << offset << ", length " << length;
+				EXPECT_EQ( hashBytes<12345>( bytes ), hashStringView<12345>( text ) ) << "offset " << offset << ", length " << length;
+			}
+		}
+	}
+
+	TEST( HashingBinaryKey, ObjectMatchesBytes )
+	{
+		// Fast-path sizes
+		expectObjectMatchesBytes<Key4>();
+		expectObjectMatchesBytes<uint64_t>();
+		expectObjectMatchesBytes<Key12>();
+		expectObjectMatchesBytes<Key16>();
+		expectObjectMatchesBytes<Key32>();
+
+		// Generic sizes
+		expectObjectMatchesBytes<uint8_t>();
+		expectObjectMatchesBytes<uint16_t>();
+		expectObjectMatchesBytes<std::array<uint8_t, 3>>();
+		expectObjectMatchesBytes<Key24>();
+		expectObjectMatchesBytes<std::array<uint32_t, 10>>();
+	}
+
+	TEST( HashingBinaryKey, EqualObjectsHashEqual )
+	{
+		const Key12 a{ 0x0A000001, 0x0A000002, 443, 51000 };
+		const Key12 b{ 0x0A000001, 0x0A000002, 443, 51000 };
+		const Key12 swapped{ 0x0A000002, 0x0A000001, 51000, 443 };
+
+		EXPECT_EQ( hashObject( a ), hashObject( b ) );
+		EXPECT_NE( hashObject( a ), hashObject( swapped ) );
+	}
+
 	//=====================================================================
 	// Integer hashing
 	//=====================================================================
@@ -281,6 +596,171 @@ namespace nfx::core::hashing::test
 		EXPECT_TRUE( index2 < tableSize );
 	}
 
+	TEST( HashingSeedMix, SeedMix64Bounds )
+	{
+		EXPECT_EQ( seedMix64( 123, 456, 1 ), 0u );
+
+		for ( const size_t tableSize : { size_t{ 2 }, size_t{ 1024 }, size_t{ 1 } << 32, size_t{ 1 } << 40, size_t{ 1 } << 63 } )
+		{
+			for ( uint64_t key = 0; key < 1000; ++key )
+			{
+				EXPECT_LT( seedMix64( 0x1A21DA, hashInteger( key ), tableSize ), tableSize );
+			}
+		}
+	}
+
+	TEST( HashingSeedMix, SeedMix64AddressesBeyond32Bits )
+	{
+		// A 2^40-slot table: indices must reach above 2^32 and spread evenly over the top bits
+		constexpr size_t tableSize{ size_t{ 1 } << 40 };
+		std::vector<uint32_t> load( 256, 0 );
+		size_t aboveLimit = 0;
+
+		for ( uint64_t key = 0; key < 256 * 400; ++key )
+		{
+			const size_t index = seedMix64( 0, hashInteger( key ), tableSize );
+			++load[index >> 32];
+			aboveLimit += index >> 32 != 0 ? 1 : 0;
+		}
+
+		EXPECT_GT( aboveLimit, 256u * 390u );
+		for ( const uint32_t count : load )
+		{
+			EXPECT_NEAR( static_cast<double>( count ), 400.0, 100.0 );
+		}
+	}
+
+	TEST( HashingSeedMix, SeedMix64Distribution )
+	{
+		// Sequential hashes, low bits of the index: the weak case for plain multiplicative hashing
+		constexpr size_t tableSize{ 1024 };
+		std::vector<uint32_t> load( tableSize, 0 );
+		for ( uint64_t key = 0; key < tableSize * 100; ++key )
+		{
+			++load[seedMix64( 0x5EED, key, tableSize )];
+		}
+
+		double chiSquared = 0.0;
+		for ( const uint32_t count : load )
+		{
+			const double delta = static_cast<double>( count ) - 100.0;
+			chiSquared += delta * delta / 100.0;
+		}
+
+		// 1023 degrees of freedom: mean 1023, standard deviation ~45
+		EXPECT_LT( chiSquared, 1023.0 + 5 * 45.0 );
+	}
+
+	TEST( HashingSeedMix, SeedMix64DifferentSeeds )
+	{
+		constexpr size_t tableSize{ size_t{ 1 } << 36 };
+		size_t same = 0;
+		for ( uint64_t key = 0; key < 1000; ++key )
+		{
+			const uint64_t hash = hashInteger( key );
+			same += seedMix64( 0xCA7, hash, tableSize ) == seedMix64( 0xD06, hash, tableSize ) ? 1 : 0;
+		}
+
+		EXPECT_EQ( same, 0u );
+	}
+
+	//=====================================================================
+	// Range reduction
+	//=====================================================================
+
+	TEST( HashingRangeReduction, FastRangeBounds )
+	{
+		EXPECT_EQ( fastRange32( 0, 1000 ), 0u );
+		EXPECT_EQ( fastRange32( 0xFFFFFFFFu, 1000 ), 999u );
+		EXPECT_EQ( fastRange32( 0x80000000u, 1000 ), 500u );
+		EXPECT_EQ( fastRange32( 0x12345678u, 0 ), 0u );
+
+		EXPECT_EQ( fastRange64( 0, 1000003 ), 0u );
+		EXPECT_EQ( fastRange64( UINT64_MAX, 1000003 ), 1000002u );
+		EXPECT_EQ( fastRange64( 0x8000000000000000ULL, 10 ), 5u );
+		EXPECT_EQ( fastRange64( UINT64_MAX, UINT64_MAX ), UINT64_MAX - 1 );
+	}
+
+	TEST( HashingRangeReduction, FastRangeUniform )
+	{
+		constexpr uint32_t buckets{ 37 };
+		std::vector<uint32_t> load( buckets, 0 );
+		for ( uint64_t i = 0; i < 37000; ++i )
+		{
+			++load[fastRange64( hashInteger( i ), buckets )];
+		}
+
+		for ( const uint32_t count : load )
+		{
+			EXPECT_NEAR( static_cast<double>( count ), 1000.0, 150.0 );
+		}
+	}
+
+	TEST( HashingRangeReduction, FastModMatchesModulo )
+	{
+		const uint32_t divisors[]{ 1, 2, 3, 7, 10, 97, 1000, 65521, 1000003, 0x7FFFFFFFu, 0xFFFFFFFFu };
+		const uint32_t values[]{ 0, 1, 2, 6, 7, 99, 12345, 0x7FFFFFFFu, 0x80000000u, 0xFFFFFFFEu, 0xFFFFFFFFu };
+
+		for ( const uint32_t d : divisors )
+		{
+			const FastMod fastMod{ d };
+			EXPECT_EQ( fastMod.divisor(), d );
+			for ( const uint32_t v : values )
+			{
+				EXPECT_EQ( fastMod.mod( v ), v % d ) << v << " % " << d;
+			}
+			for ( uint64_t i = 0; i < 1000; ++i )
+			{
+				const uint32_t v = static_cast<uint32_t>( hashInteger( i ) );
+				EXPECT_EQ( fastMod.mod( v ), v % d );
+			}
+		}
+
+		EXPECT_EQ( FastMod{ 0 }.mod( 42 ), 0u );
+	}
+
+	TEST( HashingRangeReduction, SeedMixArbitrarySize )
+	{
+		// Prime and non-power-of-2 table sizes
+		for ( const uint32_t tableSize : { 1u, 3u, 100u, 1000u, 65521u, 1000003u } )
+		{
+			const FastMod fastSize{ tableSize };
+			for ( uint32_t key = 0; key < 500; ++key )
+			{
+				const uint32_t hash = static_cast<uint32_t>( hashInteger( key ) );
+				EXPECT_LT( seedMixRange( 0x1A21DA, hash, tableSize ), tableSize );
+				EXPECT_LT( seedMix( 0x1A21DA, hash, fastSize ), tableSize );
+			}
+		}
+
+		// Power-of-2 mask behaviour is unchanged
+		EXPECT_LT( seedMix( 0x1234, 0xABCD, 256 ), 256u );
+	}
+
+	TEST( HashingRangeReduction, SeedMixRangeDistribution )
+	{
+		constexpr uint32_t tableSize{ 1000 };
+		const FastMod fastSize{ tableSize };
+		std::vector<uint32_t> rangeLoad( tableSize, 0 );
+		std::vector<uint32_t> modLoad( tableSize, 0 );
+
+		for ( uint32_t key = 0; key < 100000; ++key )
+		{
+			const uint32_t hash = hashStringView( "key_" + std::to_string( key ) );
+			++rangeLoad[seedMixRange( 0, hash, tableSize )];
+			++modLoad[seedMix( 0, hash, fastSize )];
+		}
+
+		// Expected 100 per slot; no slot should be empty or grossly overloaded
+		for ( uint32_t i = 0; i < tableSize; ++i )
+		{
+			EXPECT_GT( rangeLoad[i], 50u );
+			EXPECT_LT( rangeLoad[i], 160u );
+			EXPECT_GT( modLoad[i], 50u );
+			EXPECT_LT( modLoad[i], 160u );
+		}
+	}
+
 	//=====================================================================
 	// Distribution Quality
 	//=====================================================================
@@ -329,12 +809,18 @@ namespace nfx::core::hashing::test
 		constexpr uint32_t compileTimeLarson = Larson( 0, 'Y' );
 		constexpr uint32_t compileTimeCombine = combine( 0x12345678, 0xABCDEF00, DEFAULT_FNV_PRIME );
 		constexpr uint32_t compileTimeSeedMix = seedMix( 0x1234, 0xABCD, 256 );
+		constexpr uint32_t compileTimeSeedMixRange = seedMixRange( 0x1234, 0xABCD, 1000 );
+		constexpr uint32_t compileTimeFastMod = FastMod{ 97 }.mod( 12345 );
+		static_assert( compileTimeFastMod == 12345 % 97 );
+		constexpr size_t compileTimeSeedMix64 = seedMix64( 0x1234, 0xABCD, size_t{ 1 } << 40 );
 
 		// Runtime versions should match
 		EXPECT_EQ( fnv1a<DEFAULT_FNV_PRIME>( DEFAULT_FNV_OFFSET_BASIS, 'X' ), compileTimeHash );
 		EXPECT_EQ( Larson( 0, 'Y' ), compileTimeLarson );
 		EXPECT_EQ( combine( 0x12345678, 0xABCDEF00, DEFAULT_FNV_PRIME ), compileTimeCombine );
 		EXPECT_EQ( seedMix( 0x1234, 0xABCD, 256 ), compileTimeSeedMix );
+		EXPECT_EQ( seedMixRange( 0x1234, 0xABCD, 1000 ), compileTimeSeedMixRange );
+		EXPECT_EQ( seedMix64( 0x1234, 0xABCD, size_t{ 1 } << 40 ), compileTimeSeedMix64 );
 	}
 
 	//=====================================================================
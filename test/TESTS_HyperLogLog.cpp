@@ -0,0 +1,325 @@
+/**
+ * @file TESTS_HyperLogLog.cpp
+ * @brief Tests for the HyperLogLog cardinality sketch
+ * @details Tests covering sparse/dense estimation accuracy, batch insertion, merging
+ *          serialization round-trips and concurrent const access
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nfx/core/Hashing.h>
+#include <nfx/core/HyperLogLog.h>
+
+namespace nfx::core::sketch::test
+{
+	using namespace nfx::core::sketch;
+
+	//=====================================================================
+	// Test helpers
+	//=====================================================================
+
+	static std::vector<uint64_t> makeHashes( uint64_t first, uint64_t count )
+	{
+		std::vector<uint64_t> hashes;
+		hashes.reserve( count );
+		for ( uint64_t i = first; i < first + count; ++i )
+		{
+			hashes.push_back( hashing::hashInteger( i ) );
+		}
+
+		return hashes;
+	}
+
+	static double relativeError( double estimate, double actual )
+	{
+		return std::abs( estimate - actual ) / actual;
+	}
+
+	//=====================================================================
+	// Basic behavior
+	//=====================================================================
+
+	TEST( HyperLogLogBasic, EmptySketch )
+	{
+		HyperLogLog<> hll;
+
+		EXPECT_TRUE( hll.isEmpty() );
+		EXPECT_TRUE( hll.isSparse() );
+		EXPECT_DOUBLE_EQ( hll.estimate(), 0.0 );
+	}
+
+	TEST( HyperLogLogBasic, DuplicatesCountOnce )
+	{
+		HyperLogLog<> hll;
+		for ( int i = 0; i < 1000; ++i )
+		{
+			hll.add( hashing::hashInteger( uint64_t{ 42 } ) );
+		}
+
+		EXPECT_FALSE( hll.isEmpty() );
+		EXPECT_NEAR( hll.estimate(), 1.0, 0.01 );
+	}
+
+	TEST( HyperLogLogBasic, ClearResetsSketch )
+	{
+		HyperLogLog<> hll;
+		hll.add( makeHashes( 0, 100000 ) );
+		EXPECT_FALSE( hll.isSparse() );
+
+		hll.clear();
+		EXPECT_TRUE( hll.isEmpty() );
+		EXPECT_TRUE( hll.isSparse() );
+		EXPECT_DOUBLE_EQ( hll.estimate(), 0.0 );
+	}
+
+	//=====================================================================
+	// Accuracy
+	//=====================================================================
+
+	TEST( HyperLogLogAccuracy, SparseIsNearlyExact )
+	{
+		HyperLogLog<> hll;
+		for ( uint64_t i = 0; i < 1000; ++i )
+		{
+			hll.add( hashing::hashInteger( i ) );
+		}
+
+		EXPECT_TRUE( hll.isSparse() );
+		EXPECT_LT( relativeError( hll.estimate(), 1000.0 ), 0.005 );
+	}
+
+	TEST( HyperLogLogAccuracy, DenseWithinStandardError )
+	{
+		// p = 14: standard error 1.04 / sqrt(16384) ~ 0.81%, allow 4 sigma
+		for ( const uint64_t cardinality : { 10000ull, 100000ull, 1000000ull } )
+		{
+			HyperLogLog<> hll;
+			hll.add( makeHashes( 0, cardinality ) );
+
+			EXPECT_LT( relativeError( hll.estimate(), static_cast<double>( cardinality ) ), 0.033 )
+				<< "cardinality " << cardinality;
+		}
+	}
+
+	TEST( HyperLogLogAccuracy, StringHashInput )
+	{
+		HyperLogLog<> hll;
+		for ( int i = 0; i < 50000; ++i )
+		{
+			hll.add( hashing::hashStringView( "user_" + std::to_string( i ) ) );
+		}
+
+		EXPECT_LT( relativeError( hll.estimate(), 50000.0 ), 0.033 );
+	}
+
+	TEST( HyperLogLogAccuracy, SingleAndBatchAddAgree )
+	{
+		const auto hashes = makeHashes( 0, 20000 );
+
+		HyperLogLog<> single;
+		for ( const uint64_t hash : hashes )
+		{
+			single.add( hash );
+		}
+
+		HyperLogLog<> batch;
+		batch.add( hashes );
+
+		EXPECT_EQ( single.serialize(), batch.serialize() );
+	}
+
+	//=====================================================================
+	// Merging
+	//=====================================================================
+
+	TEST( HyperLogLogMerge, DenseMergeEqualsUnion )
+	{
+		HyperLogLog<> a;
+		HyperLogLog<> b;
+		HyperLogLog<> all;
+
+		const auto first = makeHashes( 0, 60000 );
+		const auto second = makeHashes( 30000, 60000 );
+		a.add( first );
+		b.add( second );
+		all.add( first );
+		all.add( second );
+
+		a.merge( b );
+
+		EXPECT_EQ( a.serialize(), all.serialize() );
+		EXPECT_LT( relativeError( a.estimate(), 90000.0 ), 0.033 );
+	}
+
+	TEST( HyperLogLogMerge, SparseIntoSparse )
+	{
+		HyperLogLog<> a;
+		HyperLogLog<> b;
+		a.add( makeHashes( 0, 500 ) );
+		b.add( makeHashes( 250, 500 ) );
+
+		a.merge( b );
+
+		EXPECT_TRUE( a.isSparse() );
+		EXPECT_LT( relativeError( a.estimate(), 750.0 ), 0.005 );
+	}
+
+	TEST( HyperLogLogMerge, MixedRepresentations )
+	{
+		HyperLogLog<> sparse;
+		HyperLogLog<> dense;
+		HyperLogLog<> all;
+
+		const auto small = makeHashes( 1000000, 300 );
+		const auto large = makeHashes( 0, 50000 );
+		sparse.add( small );
+		dense.add( large );
+		all.add( large );
+		all.add( small );
+
+		HyperLogLog<> sparseThenDense{ sparse };
+		sparseThenDense.merge( dense );
+
+		HyperLogLog<> denseThenSparse{ dense };
+		denseThenSparse.merge( sparse );
+
+		EXPECT_EQ( sparseThenDense.serialize(), all.serialize() );
+		EXPECT_EQ( denseThenSparse.serialize(), all.serialize() );
+	}
+
+	TEST( HyperLogLogMerge, UnflushedSparseIntoDense )
+	{
+		// Single adds stay in the insertion buffer until it fills
+		HyperLogLog<> sparse;
+		for ( const uint64_t hash : makeHashes( 1000000, 300 ) )
+		{
+			sparse.add( hash );
+		}
+
+		HyperLogLog<> dense;
+		dense.add( makeHashes( 0, 50000 ) );
+
+		HyperLogLog<> all{ dense };
+		all.add( makeHashes( 1000000, 300 ) );
+
+		dense.merge( sparse );
+
+		EXPECT_EQ( dense.serialize(), all.serialize() );
+	}
+
+	TEST( HyperLogLogMerge, ManyShards )
+	{
+		HyperLogLog<12> total;
+		for ( uint64_t shard = 0; shard < 16; ++shard )
+		{
+			HyperLogLog<12> local;
+			local.add( makeHashes( shard * 10000, 10000 ) );
+			total.merge( local );
+		}
+
+		// p = 12: standard error ~1.6%, allow 4 sigma
+		EXPECT_LT( relativeError( total.estimate(), 160000.0 ), 0.065 );
+	}
+
+	//=====================================================================
+	// Const access
+	//=====================================================================
+
+	TEST( HyperLogLogConst, ConcurrentReadsOfBufferedSketch )
+	{
+		HyperLogLog<> hll;
+		for ( const uint64_t hash : makeHashes( 0, 700 ) )
+		{
+			hll.add( hash );
+		}
+
+		HyperLogLog<> flushed;
+		flushed.add( makeHashes( 0, 700 ) );
+
+		const HyperLogLog<>& shared = hll;
+		const auto expectedBytes = flushed.serialize();
+		const double expectedEstimate = flushed.estimate();
+
+		constexpr size_t threadCount{ 4 };
+		std::vector<int> matches( threadCount, 0 );
+		std::vector<std::thread> threads;
+		for ( size_t t = 0; t < threadCount; ++t )
+		{
+			threads.emplace_back( [&, t]() {
+				HyperLogLog<> local;
+				local.merge( shared );
+				matches[t] = shared.serialize() == expectedBytes &&
+							 shared.estimate() == expectedEstimate &&
+							 local.serialize() == expectedBytes;
+			} );
+		}
+		for ( auto& thread : threads )
+		{
+			thread.join();
+		}
+
+		for ( const int match : matches )
+		{
+			EXPECT_TRUE( match );
+		}
+	}
+
+	//=====================================================================
+	// Serialization
+	//=====================================================================
+
+	TEST( HyperLogLogSerialization, SparseRoundTrip )
+	{
+		HyperLogLog<> hll;
+		hll.add( makeHashes( 0, 700 ) );
+
+		const auto bytes = hll.serialize();
+		const auto restored = HyperLogLog<>::deserialize( bytes );
+
+		ASSERT_TRUE( restored.has_value() );
+		EXPECT_TRUE( restored->isSparse() );
+		EXPECT_DOUBLE_EQ( restored->estimate(), hll.estimate() );
+		EXPECT_EQ( restored->serialize(), bytes );
+
+		// Varint deltas keep the sparse form well under 4 bytes per entry
+		EXPECT_LT( bytes.size(), 700u * 4u );
+	}
+
+	TEST( HyperLogLogSerialization, DenseRoundTrip )
+	{
+		HyperLogLog<> hll;
+		hll.add( makeHashes( 0, 100000 ) );
+
+		const auto bytes = hll.serialize();
+		EXPECT_EQ( bytes.size(), 3u + HyperLogLog<>::REGISTER_COUNT / 4 * 3 );
+
+		const auto restored = HyperLogLog<>::deserialize( bytes );
+		ASSERT_TRUE( restored.has_value() );
+		EXPECT_FALSE( restored->isSparse() );
+		EXPECT_DOUBLE_EQ( restored->estimate(), hll.estimate() );
+	}
+
+	TEST( HyperLogLogSerialization, RejectsMalformedInput )
+	{
+		HyperLogLog<> hll;
+		hll.add( makeHashes( 0, 100000 ) );
+		auto bytes = hll.serialize();
+
+		EXPECT_FALSE( HyperLogLog<>::deserialize( {} ).has_value() );
+		EXPECT_FALSE( HyperLogLog<12>::deserialize( bytes ).has_value() );
+
+		auto truncated = bytes;
+		truncated.pop_back();
+		EXPECT_FALSE( HyperLogLog<>::deserialize( truncated ).has_value() );
+
+		auto badVersion = bytes;
+		badVersion[0] = std::byte{ 0xFF };
+		EXPECT_FALSE( HyperLogLog<>::deserialize( badVersion ).has_value() );
+	}
+} // namespace nfx::core::sketch::test
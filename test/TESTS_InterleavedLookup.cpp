@@ -0,0 +1,221 @@
+/**
+ * @file TESTS_InterleavedLookup.cpp
+ * @brief Tests for coroutine-interleaved lookups
+ * @details Tests that interleaveLookups() agrees with sequential lookups for every width,
+ *          handles lookups that suspend several times or not at all, and recycles frames
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/core/Hashing.h>
+#include <nfx/core/InterleavedLookup.h>
+
+namespace nfx::core::hashing::test
+{
+	using namespace nfx::core::hashing;
+
+	//=====================================================================
+	// Test helpers
+	//=====================================================================
+
+	/** @brief Linear-probing string table addressed with hashStringView and seedMix. */
+	class StringTable
+	{
+	public:
+		struct Entry
+		{
+			std::string key;
+			uint32_t value{ 0 };
+			bool used{ false };
+		};
+
+		explicit StringTable( size_t size )
+			: m_entries( size )
+		{
+		}
+
+		void insert( std::string_view key, uint32_t value )
+		{
+			uint32_t slot = slotOf( key );
+			while ( m_entries[slot].used )
+			{
+				slot = ( slot + 1 ) & mask();
+			}
+			m_entries[slot] = { std::string{ key }, value, true };
+		}
+
+		std::optional<uint32_t> find( std::string_view key ) const
+		{
+			for ( uint32_t slot = slotOf( key ); m_entries[slot].used; slot = ( slot + 1 ) & mask() )
+			{
+				if ( m_entries[slot].key == key )
+				{
+					return m_entries[slot].value;
+				}
+			}
+
+			return std::nullopt;
+		}
+
+		/** @brief Coroutine lookup; suspends before every bucket it reads when `everyProbe` is set. */
+		LookupTask<std::optional<uint32_t>> findAsync( std::string_view key, bool everyProbe ) const
+		{
+			uint32_t slot = slotOf( key );
+			co_await prefetchAndSuspend( &m_entries[slot] );
+			for ( ; m_entries[slot].used; slot = ( slot + 1 ) & mask() )
+			{
+				if ( m_entries[slot].key == key )
+				{
+					co_return m_entries[slot].value;
+				}
+				if ( everyProbe )
+				{
+					co_await prefetchAndSuspend( &m_entries[( slot + 1 ) & mask()] );
+				}
+			}
+
+			co_return std::nullopt;
+		}
+
+	private:
+		uint32_t slotOf( std::string_view key ) const noexcept
+		{
+			return seedMix( 7, hashStringView( key ), m_entries.size() );
+		}
+
+		uint32_t mask() const noexcept
+		{
+			return static_cast<uint32_t>( m_entries.size() - 1 );
+		}
+
+		std::vector<Entry> m_entries;
+	};
+
+	static std::vector<std::string> makeKeys( size_t count, std::string_view prefix )
+	{
+		std::vector<std::string> keys;
+		for ( size_t i = 0; i < count; ++i )
+		{
+			keys.push_back( std::string{ prefix } + std::to_string( i * 31 ) );
+		}
+
+		return keys;
+	}
+
+	//=====================================================================
+	// Agreement with sequential lookups
+	//=====================================================================
+
+	TEST( InterleavedLookupTest, MatchesSequentialForEveryWidth )
+	{
+		// 75% load so probe sequences are long enough to suspend several times
+		StringTable table{ 256 };
+		const auto present = makeKeys( 192, "key:" );
+		for ( uint32_t i = 0; i < present.size(); ++i )
+		{
+			table.insert( present[i], i );
+		}
+
+		auto keys = makeKeys( 50, "absent:" );
+		keys.insert( keys.end(), present.begin(), present.end() );
+		const std::vector<std::string_view> views( keys.begin(), keys.end() );
+
+		for ( const bool everyProbe : { false, true } )
+		{
+			const auto lookup = [&]( std::string_view key ) { return table.findAsync( key, everyProbe ); };
+			for ( const size_t width : { size_t{ 0 }, size_t{ 1 }, size_t{ 3 }, constants::INTERLEAVE_WIDTH, size_t{ 64 }, size_t{ 1000 } } )
+			{
+				std::vector<std::optional<uint32_t>> results( views.size(), 12345u );
+				interleaveLookups( std::span<const std::string_view>{ views }, std::span{ results }, lookup, width );
+
+				for ( size_t i = 0; i < views.size(); ++i )
+				{
+					ASSERT_EQ( results[i], table.find( views[i] ) ) << "width " << width << ", key " << views[i];
+				}
+			}
+		}
+	}
+
+	TEST( InterleavedLookupTest, LookupsThatNeverSuspend )
+	{
+		const std::vector<uint64_t> keys{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+		std::vector<uint64_t> results( keys.size() );
+
+		interleaveLookups( std::span<const uint64_t>{ keys }, std::span{ results },
+			[]( uint64_t key ) -> LookupTask<uint64_t> { co_return key * key; }, 4 );
+
+		for ( size_t i = 0; i < keys.size(); ++i )
+		{
+			EXPECT_EQ( results[i], keys[i] * keys[i] );
+		}
+	}
+
+	TEST( InterleavedLookupTest, ShortResultSpanLimitsWork )
+	{
+		const std::vector<uint64_t> keys( 20, 1 );
+		std::vector<uint64_t> results( 5 );
+		size_t started{ 0 };
+
+		interleaveLookups( std::span<const uint64_t>{ keys }, std::span{ results },
+			[&]( uint64_t key ) -> LookupTask<uint64_t> {
+				++started;
+				co_await prefetchAndSuspend( &key );
+				co_return key;
+			} );
+
+		EXPECT_EQ( started, results.size() );
+	}
+
+	//=====================================================================
+	// LookupTask
+	//=====================================================================
+
+	TEST( InterleavedLookupTest, TaskRunsEagerlyToFirstSuspension )
+	{
+		// The coroutine reads its captures through the lambda, so the lambda must outlive it
+		int stage{ 0 };
+		const auto lookup = [&]() -> LookupTask<int> {
+			stage = 1;
+			co_await prefetchAndSuspend( &stage );
+			stage = 2;
+			co_return 42;
+		};
+		auto task = lookup();
+
+		EXPECT_EQ( stage, 1 );
+		EXPECT_FALSE( task.done() );
+
+		task.resume();
+		EXPECT_EQ( stage, 2 );
+		ASSERT_TRUE( task.done() );
+		EXPECT_EQ( task.result(), 42 );
+
+		LookupTask<int> moved{ std::move( task ) };
+		EXPECT_TRUE( task.done() ); // Empty after move
+		EXPECT_EQ( moved.result(), 42 );
+	}
+
+	TEST( InterleavedLookupTest, FramesAreRecycled )
+	{
+		const auto make = []( int value ) -> LookupTask<int> {
+			co_await prefetchAndSuspend( &value );
+			co_return value;
+		};
+
+		const void* first = nullptr;
+		{
+			auto task = make( 1 );
+			first = &task.result();
+		}
+
+		// Same coroutine, same size class: the freed frame is handed out again
+		auto task = make( 2 );
+		EXPECT_EQ( &task.result(), first );
+	}
+} // namespace nfx::core::hashing::test
@@ -0,0 +1,113 @@
+/**
+ * @file TESTS_KeyEquality.cpp
+ * @brief Tests for short-key equality
+ * @details Tests bytesEqual() against memcmp for every length and mismatch position,
+ *          reads that end at a protected page, keysEqual() and the fused hash check
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined( __linux__ )
+#	include <sys/mman.h>
+#	include <unistd.h>
+#endif
+
+#include <nfx/core/Hashing.h>
+#include <nfx/core/KeyEquality.h>
+
+namespace nfx::core::hashing::test
+{
+	using namespace nfx::core::hashing;
+
+	//=====================================================================
+	// bytesEqual
+	//=====================================================================
+
+	TEST( KeyEqualityTest, MatchesMemcmpForEveryLengthAndMismatch )
+	{
+		// Odd offsets so no load is aligned
+		std::vector<uint8_t> left( 160 + 3 );
+		std::vector<uint8_t> right( 160 + 5 );
+		for ( size_t length = 0; length <= 150; ++length )
+		{
+			uint8_t* a = left.data() + 3;
+			uint8_t* b = right.data() + 5;
+			for ( size_t i = 0; i < length; ++i )
+			{
+				a[i] = b[i] = static_cast<uint8_t>( i * 37 + length );
+			}
+			// Bytes past the end differ, so over-reads must be masked out
+			a[length] = 0x00;
+			b[length] = 0xFF;
+
+			ASSERT_TRUE( bytesEqual( a, b, length ) ) << "length " << length;
+
+			for ( size_t mismatch = 0; mismatch < length; ++mismatch )
+			{
+				b[mismatch] ^= 0x80;
+				ASSERT_FALSE( bytesEqual( a, b, length ) ) << "length " << length << ", mismatch at " << mismatch;
+				b[mismatch] ^= 0x80;
+			}
+		}
+	}
+
+#if defined( __linux__ )
+	TEST( KeyEqualityTest, KeysEndingAtProtectedPageAreSafe )
+	{
+		// Second page is inaccessible: any read past a key ending at the boundary faults
+		const size_t page = static_cast<size_t>( ::sysconf( _SC_PAGESIZE ) );
+		auto* region = static_cast<uint8_t*>( ::mmap( nullptr, 2 * page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 ) );
+		ASSERT_NE( region, MAP_FAILED );
+		ASSERT_EQ( ::mprotect( region + page, page, PROT_NONE ), 0 );
+
+		std::vector<uint8_t> other( 128, 'k' );
+		std::memset( region, 'k', page );
+		for ( size_t length = 1; length <= 80; ++length )
+		{
+			const uint8_t* tail = region + page - length;
+			EXPECT_TRUE( bytesEqual( tail, other.data(), length ) );
+			EXPECT_TRUE( bytesEqual( other.data() + 1, tail, length ) );
+		}
+
+		::munmap( region, 2 * page );
+	}
+#endif
+
+	//=====================================================================
+	// keysEqual and hashedKeysEqual
+	//=====================================================================
+
+	TEST( KeyEqualityTest, KeysEqual )
+	{
+		EXPECT_TRUE( keysEqual( "", "" ) );
+		EXPECT_TRUE( keysEqual( "user:1234", std::string{ "user:1234" } ) );
+		EXPECT_FALSE( keysEqual( "user:1234", "user:1235" ) );
+		EXPECT_FALSE( keysEqual( "user:123", "user:1234" ) );
+		EXPECT_FALSE( keysEqual( "", "a" ) );
+
+		const std::string longKey( 200, 'x' );
+		std::string other = longKey;
+		EXPECT_TRUE( keysEqual( longKey, other ) );
+		other[199] = 'y';
+		EXPECT_FALSE( keysEqual( longKey, other ) );
+	}
+
+	TEST( KeyEqualityTest, HashedKeysEqualChecksHashLengthAndBytes )
+	{
+		const std::string_view stored{ "session:42:alpha" };
+		const uint32_t storedHash = hashStringView( stored );
+
+		EXPECT_TRUE( hashedKeysEqual( storedHash, stored, hashStringView( "session:42:alpha" ), "session:42:alpha" ) );
+		EXPECT_FALSE( hashedKeysEqual( storedHash, stored, hashStringView( "session:42:alphA" ), "session:42:alphA" ) );
+
+		// Equal hashes do not short-circuit the byte compare, and a differing hash rejects equal bytes
+		EXPECT_FALSE( hashedKeysEqual( storedHash, stored, storedHash, "session:42:omega" ) );
+		EXPECT_FALSE( hashedKeysEqual( storedHash, stored, storedHash, "session:42:alpha!" ) );
+		EXPECT_FALSE( hashedKeysEqual( storedHash ^ 1, stored, storedHash, stored ) );
+	}
+} // namespace nfx::core::hashing::test
@@ -0,0 +1,149 @@
+/**
+ * @file TESTS_StringInterner.cpp
+ * @brief Tests for the string interning pool
+ * @details Tests deduplication, handle stability across table growth, ids, lookups
+ *          without interning, long strings and concurrent interning
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include <nfx/core/HashedString.h>
+#include <nfx/core/Hashing.h>
+#include <nfx/core/StringInterner.h>
+
+namespace nfx::core::strings::test
+{
+	using namespace nfx::core::strings;
+
+	//=====================================================================
+	// Interning
+	//=====================================================================
+
+	TEST( StringInternerTest, DeduplicatesByContent )
+	{
+		StringInterner interner;
+		std::string first{ "config.timeout_ms" };
+		const InternedString a = interner.intern( first );
+		first[0] = 'X'; // The interner owns a copy
+
+		const InternedString b = interner.intern( std::string{ "config.timeout_ms" } );
+		const InternedString c = interner.intern( "config.retries" );
+
+		EXPECT_EQ( a, b );
+		EXPECT_NE( a, c );
+		EXPECT_EQ( a.view().data(), b.view().data() );
+		EXPECT_EQ( a.view(), "config.timeout_ms" );
+		EXPECT_STREQ( a.c_str(), "config.timeout_ms" );
+		EXPECT_EQ( a.hash(), nfx::core::hashing::hashStringView( std::string_view{ "config.timeout_ms" } ) );
+		EXPECT_EQ( interner.size(), 2u );
+	}
+
+	TEST( StringInternerTest, EmptyAndNullHandles )
+	{
+		StringInterner interner;
+		const InternedString empty = interner.intern( "" );
+
+		EXPECT_TRUE( static_cast<bool>( empty ) );
+		EXPECT_EQ( empty.size(), 0u );
+		EXPECT_EQ( empty, interner.intern( std::string_view{} ) );
+
+		const InternedString null;
+		EXPECT_FALSE( static_cast<bool>( null ) );
+		EXPECT_NE( null, empty );
+		EXPECT_STREQ( null.c_str(), "" );
+	}
+
+	TEST( StringInternerTest, HandlesSurviveGrowthAndIdsAreDense )
+	{
+		StringInterner interner{ 16 };
+		std::vector<InternedString> handles;
+		std::vector<const char*> addresses;
+		for ( int i = 0; i < 20000; ++i )
+		{
+			handles.push_back( interner.intern( "metric." + std::to_string( i ) ) );
+			addresses.push_back( handles.back().view().data() );
+		}
+
+		ASSERT_EQ( interner.size(), 20000u );
+		for ( uint32_t i = 0; i < handles.size(); ++i )
+		{
+			ASSERT_EQ( handles[i].id(), i );
+			ASSERT_EQ( interner.at( i ), handles[i] );
+			ASSERT_EQ( handles[i].view().data(), addresses[i] );
+			ASSERT_EQ( handles[i].view(), "metric." + std::to_string( i ) );
+			ASSERT_EQ( interner.intern( "metric." + std::to_string( i ) ), handles[i] );
+		}
+	}
+
+	TEST( StringInternerTest, FindDoesNotIntern )
+	{
+		StringInterner interner;
+		const InternedString stored = interner.intern( "present" );
+
+		EXPECT_EQ( interner.find( "present" ), stored );
+		EXPECT_FALSE( interner.find( "absent" ).has_value() );
+		EXPECT_EQ( interner.size(), 1u );
+	}
+
+	TEST( StringInternerTest, PreHashedStringsAndLongStrings )
+	{
+		StringInterner interner;
+		const nfx::core::hashing::HashedStringView hashed{ "telemetry.cpu.user" };
+		const InternedString a = interner.intern( hashed );
+		EXPECT_EQ( a, interner.intern( "telemetry.cpu.user" ) );
+		EXPECT_EQ( static_cast<nfx::core::hashing::HashedStringView>( a ), hashed );
+		EXPECT_EQ( std::hash<InternedString>{}( a ), hashed.hash() );
+
+		const std::string huge( 3 * constants::INTERNER_BLOCK_SIZE, 'q' );
+		const InternedString big = interner.intern( huge );
+		EXPECT_EQ( big.view(), huge );
+		EXPECT_EQ( interner.intern( huge ), big );
+		EXPECT_EQ( interner.intern( "telemetry.cpu.user" ), a );
+		EXPECT_GE( interner.memoryUsage(), huge.size() );
+	}
+
+	//=====================================================================
+	// Concurrency
+	//=====================================================================
+
+	TEST( StringInternerTest, ConcurrentInterningAgrees )
+	{
+		StringInterner interner{ 16 };
+		constexpr int threadCount = 8;
+		constexpr int keyCount = 5000;
+		std::vector<std::vector<InternedString>> seen( threadCount );
+
+		std::vector<std::thread> threads;
+		for ( int t = 0; t < threadCount; ++t )
+		{
+			threads.emplace_back( [&, t]() {
+				// Every thread interns the same keys in a different order
+				for ( int i = 0; i < keyCount; ++i )
+				{
+					const int key = ( i * ( 2 * t + 1 ) ) % keyCount;
+					seen[t].push_back( interner.intern( "key:" + std::to_string( key ) ) );
+				}
+			} );
+		}
+		for ( auto& thread : threads )
+		{
+			thread.join();
+		}
+
+		EXPECT_EQ( interner.size(), static_cast<size_t>( keyCount ) );
+		for ( int t = 0; t < threadCount; ++t )
+		{
+			for ( int i = 0; i < keyCount; ++i )
+			{
+				const int key = ( i * ( 2 * t + 1 ) ) % keyCount;
+				ASSERT_EQ( seen[t][i], *interner.find( "key:" + std::to_string( key ) ) );
+			}
+		}
+	}
+} // namespace nfx::core::strings::test